@@ -0,0 +1,654 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_BENCH_GITHUB_ROUTES_HPP
+#define BOOST_URL_BENCH_GITHUB_ROUTES_HPP
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+/*
+    Routes modeled after the GitHub REST API.
+
+    The table has the shape of a large real
+    world API: deep literal prefixes, many
+    replacement fields at the same level
+    with different names, and a few routes
+    which capture paths with slashes.
+*/
+
+inline
+std::vector<std::string>
+github_routes()
+{
+    struct family
+    {
+        char const* prefix;
+        std::initializer_list<char const*> routes;
+    };
+
+    static std::initializer_list<char const*> const actions = {
+        "/artifacts",
+        "/artifacts/{artifact_id}",
+        "/artifacts/{artifact_id}/{archive_format}",
+        "/cache/usage",
+        "/caches",
+        "/caches/{cache_id}",
+        "/jobs/{job_id}",
+        "/jobs/{job_id}/logs",
+        "/jobs/{job_id}/rerun",
+        "/oidc/customization/sub",
+        "/organization-secrets",
+        "/organization-variables",
+        "/permissions",
+        "/permissions/access",
+        "/permissions/selected-actions",
+        "/permissions/workflow",
+        "/runners",
+        "/runners/downloads",
+        "/runners/generate-jitconfig",
+        "/runners/registration-token",
+        "/runners/remove-token",
+        "/runners/{runner_id}",
+        "/runners/{runner_id}/labels",
+        "/runners/{runner_id}/labels/{name}",
+        "/runs",
+        "/runs/{run_id}",
+        "/runs/{run_id}/approvals",
+        "/runs/{run_id}/approve",
+        "/runs/{run_id}/artifacts",
+        "/runs/{run_id}/attempts/{attempt_number}",
+        "/runs/{run_id}/attempts/{attempt_number}/jobs",
+        "/runs/{run_id}/attempts/{attempt_number}/logs",
+        "/runs/{run_id}/cancel",
+        "/runs/{run_id}/deployment_protection_rule",
+        "/runs/{run_id}/force-cancel",
+        "/runs/{run_id}/jobs",
+        "/runs/{run_id}/logs",
+        "/runs/{run_id}/pending_deployments",
+        "/runs/{run_id}/rerun",
+        "/runs/{run_id}/rerun-failed-jobs",
+        "/runs/{run_id}/timing",
+        "/secrets",
+        "/secrets/public-key",
+        "/secrets/{secret_name}",
+        "/variables",
+        "/variables/{name}",
+        "/workflows",
+        "/workflows/{workflow_id}",
+        "/workflows/{workflow_id}/disable",
+        "/workflows/{workflow_id}/dispatches",
+        "/workflows/{workflow_id}/enable",
+        "/workflows/{workflow_id}/runs",
+        "/workflows/{workflow_id}/timing",
+    };
+
+    static std::initializer_list<char const*> const packages = {
+        "/packages",
+        "/packages/{package_type}/{package_name}",
+        "/packages/{package_type}/{package_name}/restore",
+        "/packages/{package_type}/{package_name}/versions",
+        "/packages/{package_type}/{package_name}/versions/{package_version_id}",
+        "/packages/{package_type}/{package_name}/versions/{package_version_id}/restore",
+    };
+
+    static family const families[] = {
+    { "/repos/{owner}/{repo}/actions", actions },
+    { "/repos/{owner}/{repo}", {
+        "",
+        "/activity",
+        "/assignees",
+        "/assignees/{assignee}",
+        "/attestations",
+        "/autolinks",
+        "/autolinks/{autolink_id}",
+        "/automated-security-fixes",
+        "/branches",
+        "/branches/{branch}",
+        "/branches/{branch}/protection",
+        "/branches/{branch}/protection/enforce_admins",
+        "/branches/{branch}/protection/required_pull_request_reviews",
+        "/branches/{branch}/protection/required_signatures",
+        "/branches/{branch}/protection/required_status_checks",
+        "/branches/{branch}/protection/required_status_checks/contexts",
+        "/branches/{branch}/protection/restrictions",
+        "/branches/{branch}/protection/restrictions/apps",
+        "/branches/{branch}/protection/restrictions/teams",
+        "/branches/{branch}/protection/restrictions/users",
+        "/branches/{branch}/rename",
+        "/check-runs",
+        "/check-runs/{check_run_id}",
+        "/check-runs/{check_run_id}/annotations",
+        "/check-runs/{check_run_id}/rerequest",
+        "/check-suites",
+        "/check-suites/preferences",
+        "/check-suites/{check_suite_id}",
+        "/check-suites/{check_suite_id}/check-runs",
+        "/check-suites/{check_suite_id}/rerequest",
+        "/code-scanning/alerts",
+        "/code-scanning/alerts/{alert_number}",
+        "/code-scanning/alerts/{alert_number}/instances",
+        "/code-scanning/analyses",
+        "/code-scanning/analyses/{analysis_id}",
+        "/code-scanning/codeql/databases",
+        "/code-scanning/codeql/databases/{language}",
+        "/code-scanning/default-setup",
+        "/code-scanning/sarifs",
+        "/code-scanning/sarifs/{sarif_id}",
+        "/codeowners/errors",
+        "/codespaces",
+        "/codespaces/devcontainers",
+        "/codespaces/machines",
+        "/codespaces/new",
+        "/codespaces/secrets",
+        "/codespaces/secrets/public-key",
+        "/codespaces/secrets/{secret_name}",
+        "/collaborators",
+        "/collaborators/{username}",
+        "/collaborators/{username}/permission",
+        "/comments",
+        "/comments/{comment_id}",
+        "/comments/{comment_id}/reactions",
+        "/comments/{comment_id}/reactions/{reaction_id}",
+        "/commits",
+        "/commits/{commit_sha}/branches-where-head",
+        "/commits/{commit_sha}/comments",
+        "/commits/{commit_sha}/pulls",
+        "/commits/{ref}",
+        "/commits/{ref}/check-runs",
+        "/commits/{ref}/check-suites",
+        "/commits/{ref}/status",
+        "/commits/{ref}/statuses",
+        "/community/profile",
+        "/compare/{basehead}",
+        "/contents/{path*}",
+        "/contributors",
+        "/dependabot/alerts",
+        "/dependabot/alerts/{alert_number}",
+        "/dependabot/secrets",
+        "/dependabot/secrets/public-key",
+        "/dependabot/secrets/{secret_name}",
+        "/dependency-graph/compare/{basehead}",
+        "/dependency-graph/sbom",
+        "/dependency-graph/snapshots",
+        "/deployments",
+        "/deployments/{deployment_id}",
+        "/deployments/{deployment_id}/statuses",
+        "/deployments/{deployment_id}/statuses/{status_id}",
+        "/dispatches",
+        "/environments",
+        "/environments/{environment_name}",
+        "/environments/{environment_name}/deployment-branch-policies",
+        "/environments/{environment_name}/deployment-branch-policies/{branch_policy_id}",
+        "/environments/{environment_name}/deployment_protection_rules",
+        "/environments/{environment_name}/secrets",
+        "/environments/{environment_name}/secrets/{secret_name}",
+        "/environments/{environment_name}/variables",
+        "/environments/{environment_name}/variables/{name}",
+        "/events",
+        "/forks",
+        "/generate",
+        "/git/blobs",
+        "/git/blobs/{file_sha}",
+        "/git/commits",
+        "/git/commits/{commit_sha}",
+        "/git/matching-refs/{ref+}",
+        "/git/ref/{ref+}",
+        "/git/refs",
+        "/git/refs/{ref+}",
+        "/git/tags",
+        "/git/tags/{tag_sha}",
+        "/git/trees",
+        "/git/trees/{tree_sha}",
+        "/hooks",
+        "/hooks/{hook_id}",
+        "/hooks/{hook_id}/config",
+        "/hooks/{hook_id}/deliveries",
+        "/hooks/{hook_id}/deliveries/{delivery_id}",
+        "/hooks/{hook_id}/deliveries/{delivery_id}/attempts",
+        "/hooks/{hook_id}/pings",
+        "/hooks/{hook_id}/tests",
+        "/import",
+        "/import/authors",
+        "/import/authors/{author_id}",
+        "/import/large_files",
+        "/import/lfs",
+        "/installation",
+        "/interaction-limits",
+        "/invitations",
+        "/invitations/{invitation_id}",
+        "/issues",
+        "/issues/comments",
+        "/issues/comments/{comment_id}",
+        "/issues/comments/{comment_id}/reactions",
+        "/issues/comments/{comment_id}/reactions/{reaction_id}",
+        "/issues/events",
+        "/issues/events/{event_id}",
+        "/issues/{issue_number}",
+        "/issues/{issue_number}/assignees",
+        "/issues/{issue_number}/assignees/{assignee}",
+        "/issues/{issue_number}/comments",
+        "/issues/{issue_number}/events",
+        "/issues/{issue_number}/labels",
+        "/issues/{issue_number}/labels/{name}",
+        "/issues/{issue_number}/lock",
+        "/issues/{issue_number}/reactions",
+        "/issues/{issue_number}/reactions/{reaction_id}",
+        "/issues/{issue_number}/timeline",
+        "/keys",
+        "/keys/{key_id}",
+        "/labels",
+        "/labels/{name}",
+        "/languages",
+        "/license",
+        "/merge-upstream",
+        "/merges",
+        "/milestones",
+        "/milestones/{milestone_number}",
+        "/milestones/{milestone_number}/labels",
+        "/notifications",
+        "/pages",
+        "/pages/builds",
+        "/pages/builds/latest",
+        "/pages/builds/{build_id}",
+        "/pages/deployment",
+        "/pages/health",
+        "/private-vulnerability-reporting",
+        "/projects",
+        "/properties/values",
+        "/pulls",
+        "/pulls/comments",
+        "/pulls/comments/{comment_id}",
+        "/pulls/comments/{comment_id}/reactions",
+        "/pulls/comments/{comment_id}/reactions/{reaction_id}",
+        "/pulls/{pull_number}",
+        "/pulls/{pull_number}/codespaces",
+        "/pulls/{pull_number}/comments",
+        "/pulls/{pull_number}/comments/{comment_id}/replies",
+        "/pulls/{pull_number}/commits",
+        "/pulls/{pull_number}/files",
+        "/pulls/{pull_number}/merge",
+        "/pulls/{pull_number}/requested_reviewers",
+        "/pulls/{pull_number}/reviews",
+        "/pulls/{pull_number}/reviews/{review_id}",
+        "/pulls/{pull_number}/reviews/{review_id}/comments",
+        "/pulls/{pull_number}/reviews/{review_id}/dismissals",
+        "/pulls/{pull_number}/reviews/{review_id}/events",
+        "/pulls/{pull_number}/update-branch",
+        "/readme",
+        "/readme/{dir}",
+        "/releases",
+        "/releases/assets/{asset_id}",
+        "/releases/generate-notes",
+        "/releases/latest",
+        "/releases/tags/{tag}",
+        "/releases/{release_id}",
+        "/releases/{release_id}/assets",
+        "/releases/{release_id}/reactions",
+        "/releases/{release_id}/reactions/{reaction_id}",
+        "/rules/branches/{branch}",
+        "/rulesets",
+        "/rulesets/rule-suites",
+        "/rulesets/rule-suites/{rule_suite_id}",
+        "/rulesets/{ruleset_id}",
+        "/secret-scanning/alerts",
+        "/secret-scanning/alerts/{alert_number}",
+        "/secret-scanning/alerts/{alert_number}/locations",
+        "/security-advisories",
+        "/security-advisories/reports",
+        "/security-advisories/{ghsa_id}",
+        "/security-advisories/{ghsa_id}/cve",
+        "/stargazers",
+        "/stats/code_frequency",
+        "/stats/commit_activity",
+        "/stats/contributors",
+        "/stats/participation",
+        "/stats/punch_card",
+        "/statuses/{sha}",
+        "/subscribers",
+        "/subscription",
+        "/tags",
+        "/tags/protection",
+        "/tags/protection/{tag_protection_id}",
+        "/tarball/{ref}",
+        "/teams",
+        "/topics",
+        "/traffic/clones",
+        "/traffic/popular/paths",
+        "/traffic/popular/referrers",
+        "/traffic/views",
+        "/transfer",
+        "/vulnerability-alerts",
+        "/zipball/{ref}",
+    } },
+    { "/orgs/{org}/actions", {
+        "/cache/usage",
+        "/cache/usage-by-repository",
+        "/oidc/customization/sub",
+        "/permissions",
+        "/permissions/repositories",
+        "/permissions/repositories/{repository_id}",
+        "/permissions/selected-actions",
+        "/permissions/workflow",
+        "/runner-groups",
+        "/runner-groups/{runner_group_id}",
+        "/runner-groups/{runner_group_id}/repositories",
+        "/runner-groups/{runner_group_id}/repositories/{repository_id}",
+        "/runner-groups/{runner_group_id}/runners",
+        "/runner-groups/{runner_group_id}/runners/{runner_id}",
+        "/runners",
+        "/runners/downloads",
+        "/runners/generate-jitconfig",
+        "/runners/registration-token",
+        "/runners/remove-token",
+        "/runners/{runner_id}",
+        "/runners/{runner_id}/labels",
+        "/runners/{runner_id}/labels/{name}",
+        "/secrets",
+        "/secrets/public-key",
+        "/secrets/{secret_name}",
+        "/secrets/{secret_name}/repositories",
+        "/secrets/{secret_name}/repositories/{repository_id}",
+        "/variables",
+        "/variables/{name}",
+        "/variables/{name}/repositories",
+        "/variables/{name}/repositories/{repository_id}",
+    } },
+    { "/orgs/{org}", packages },
+    { "/orgs/{org}", {
+        "",
+        "/blocks",
+        "/blocks/{username}",
+        "/code-scanning/alerts",
+        "/codespaces",
+        "/codespaces/access",
+        "/codespaces/access/selected_users",
+        "/codespaces/secrets",
+        "/codespaces/secrets/public-key",
+        "/codespaces/secrets/{secret_name}",
+        "/codespaces/secrets/{secret_name}/repositories",
+        "/codespaces/secrets/{secret_name}/repositories/{repository_id}",
+        "/copilot/billing",
+        "/copilot/billing/seats",
+        "/copilot/billing/selected_teams",
+        "/copilot/billing/selected_users",
+        "/dependabot/alerts",
+        "/dependabot/secrets",
+        "/dependabot/secrets/public-key",
+        "/dependabot/secrets/{secret_name}",
+        "/dependabot/secrets/{secret_name}/repositories",
+        "/dependabot/secrets/{secret_name}/repositories/{repository_id}",
+        "/docker/conflicts",
+        "/events",
+        "/failed_invitations",
+        "/hooks",
+        "/hooks/{hook_id}",
+        "/hooks/{hook_id}/config",
+        "/hooks/{hook_id}/deliveries",
+        "/hooks/{hook_id}/deliveries/{delivery_id}",
+        "/hooks/{hook_id}/deliveries/{delivery_id}/attempts",
+        "/hooks/{hook_id}/pings",
+        "/installation",
+        "/installations",
+        "/interaction-limits",
+        "/invitations",
+        "/invitations/{invitation_id}",
+        "/invitations/{invitation_id}/teams",
+        "/issues",
+        "/members",
+        "/members/{username}",
+        "/members/{username}/codespaces",
+        "/members/{username}/codespaces/{codespace_name}",
+        "/members/{username}/codespaces/{codespace_name}/stop",
+        "/members/{username}/copilot",
+        "/memberships/{username}",
+        "/migrations",
+        "/migrations/{migration_id}",
+        "/migrations/{migration_id}/archive",
+        "/migrations/{migration_id}/repos/{repo_name}/lock",
+        "/migrations/{migration_id}/repositories",
+        "/outside_collaborators",
+        "/outside_collaborators/{username}",
+        "/personal-access-token-requests",
+        "/personal-access-token-requests/{pat_request_id}",
+        "/personal-access-token-requests/{pat_request_id}/repositories",
+        "/personal-access-tokens",
+        "/personal-access-tokens/{pat_id}",
+        "/personal-access-tokens/{pat_id}/repositories",
+        "/projects",
+        "/properties/schema",
+        "/properties/schema/{custom_property_name}",
+        "/properties/values",
+        "/public_members",
+        "/public_members/{username}",
+        "/repos",
+        "/rulesets",
+        "/rulesets/rule-suites",
+        "/rulesets/rule-suites/{rule_suite_id}",
+        "/rulesets/{ruleset_id}",
+        "/secret-scanning/alerts",
+        "/security-advisories",
+        "/security-managers",
+        "/security-managers/teams/{team_slug}",
+        "/settings/billing/actions",
+        "/settings/billing/packages",
+        "/settings/billing/shared-storage",
+        "/teams",
+        "/teams/{team_slug}",
+        "/teams/{team_slug}/discussions",
+        "/teams/{team_slug}/discussions/{discussion_number}",
+        "/teams/{team_slug}/discussions/{discussion_number}/comments",
+        "/teams/{team_slug}/discussions/{discussion_number}/comments/{comment_number}",
+        "/teams/{team_slug}/discussions/{discussion_number}/comments/{comment_number}/reactions",
+        "/teams/{team_slug}/discussions/{discussion_number}/reactions",
+        "/teams/{team_slug}/invitations",
+        "/teams/{team_slug}/members",
+        "/teams/{team_slug}/memberships/{username}",
+        "/teams/{team_slug}/projects",
+        "/teams/{team_slug}/projects/{project_id}",
+        "/teams/{team_slug}/repos",
+        "/teams/{team_slug}/repos/{owner}/{repo}",
+        "/teams/{team_slug}/teams",
+        "/{security_product}/{enablement}",
+    } },
+    { "/users/{username}", packages },
+    { "/users/{username}", {
+        "",
+        "/docker/conflicts",
+        "/events",
+        "/events/orgs/{org}",
+        "/events/public",
+        "/followers",
+        "/following",
+        "/following/{target_user}",
+        "/gists",
+        "/gpg_keys",
+        "/hovercard",
+        "/installation",
+        "/keys",
+        "/orgs",
+        "/projects",
+        "/received_events",
+        "/received_events/public",
+        "/repos",
+        "/settings/billing/actions",
+        "/settings/billing/packages",
+        "/settings/billing/shared-storage",
+        "/social_accounts",
+        "/ssh_signing_keys",
+        "/starred",
+        "/subscriptions",
+    } },
+    { "/user", packages },
+    { "/user", {
+        "",
+        "/blocks",
+        "/blocks/{username}",
+        "/codespaces",
+        "/codespaces/secrets",
+        "/codespaces/secrets/public-key",
+        "/codespaces/secrets/{secret_name}",
+        "/codespaces/secrets/{secret_name}/repositories",
+        "/codespaces/secrets/{secret_name}/repositories/{repository_id}",
+        "/codespaces/{codespace_name}",
+        "/codespaces/{codespace_name}/exports",
+        "/codespaces/{codespace_name}/exports/{export_id}",
+        "/codespaces/{codespace_name}/machines",
+        "/codespaces/{codespace_name}/publish",
+        "/codespaces/{codespace_name}/start",
+        "/codespaces/{codespace_name}/stop",
+        "/docker/conflicts",
+        "/email/visibility",
+        "/emails",
+        "/followers",
+        "/following",
+        "/following/{username}",
+        "/gpg_keys",
+        "/gpg_keys/{gpg_key_id}",
+        "/installations",
+        "/installations/{installation_id}/repositories",
+        "/installations/{installation_id}/repositories/{repository_id}",
+        "/interaction-limits",
+        "/issues",
+        "/keys",
+        "/keys/{key_id}",
+        "/marketplace_purchases",
+        "/marketplace_purchases/stubbed",
+        "/memberships/orgs",
+        "/memberships/orgs/{org}",
+        "/migrations",
+        "/migrations/{migration_id}",
+        "/migrations/{migration_id}/archive",
+        "/migrations/{migration_id}/repos/{repo_name}/lock",
+        "/migrations/{migration_id}/repositories",
+        "/orgs",
+        "/projects",
+        "/public_emails",
+        "/repos",
+        "/repository_invitations",
+        "/repository_invitations/{invitation_id}",
+        "/social_accounts",
+        "/ssh_signing_keys",
+        "/ssh_signing_keys/{ssh_signing_key_id}",
+        "/starred",
+        "/starred/{owner}/{repo}",
+        "/subscriptions",
+        "/teams",
+        "/{account_id}",
+    } },
+    { "", {
+        "/",
+        "/app",
+        "/app-manifests/{code}/conversions",
+        "/app/hook/config",
+        "/app/hook/deliveries",
+        "/app/hook/deliveries/{delivery_id}",
+        "/app/hook/deliveries/{delivery_id}/attempts",
+        "/app/installation-requests",
+        "/app/installations",
+        "/app/installations/{installation_id}",
+        "/app/installations/{installation_id}/access_tokens",
+        "/app/installations/{installation_id}/suspended",
+        "/applications/{client_id}/grant",
+        "/applications/{client_id}/token",
+        "/applications/{client_id}/token/scoped",
+        "/apps/{app_slug}",
+        "/assignments/{assignment_id}",
+        "/assignments/{assignment_id}/accepted_assignments",
+        "/assignments/{assignment_id}/grades",
+        "/classrooms",
+        "/classrooms/{classroom_id}",
+        "/classrooms/{classroom_id}/assignments",
+        "/codes_of_conduct",
+        "/codes_of_conduct/{key}",
+        "/emojis",
+        "/enterprises/{enterprise}/dependabot/alerts",
+        "/enterprises/{enterprise}/secret-scanning/alerts",
+        "/enterprises/{enterprise}/{security_product}/{enablement}",
+        "/events",
+        "/feeds",
+        "/gists",
+        "/gists/public",
+        "/gists/starred",
+        "/gists/{gist_id}",
+        "/gists/{gist_id}/comments",
+        "/gists/{gist_id}/comments/{comment_id}",
+        "/gists/{gist_id}/commits",
+        "/gists/{gist_id}/forks",
+        "/gists/{gist_id}/star",
+        "/gists/{gist_id}/{sha}",
+        "/gitignore/templates",
+        "/gitignore/templates/{name}",
+        "/installation/repositories",
+        "/installation/token",
+        "/issues",
+        "/licenses",
+        "/licenses/{license}",
+        "/markdown",
+        "/markdown/raw",
+        "/marketplace_listing/accounts/{account_id}",
+        "/marketplace_listing/plans",
+        "/marketplace_listing/plans/{plan_id}/accounts",
+        "/marketplace_listing/stubbed/accounts/{account_id}",
+        "/marketplace_listing/stubbed/plans",
+        "/marketplace_listing/stubbed/plans/{plan_id}/accounts",
+        "/meta",
+        "/networks/{owner}/{repo}/events",
+        "/notifications",
+        "/notifications/threads/{thread_id}",
+        "/notifications/threads/{thread_id}/subscription",
+        "/octocat",
+        "/organizations",
+        "/projects/columns/cards/{card_id}",
+        "/projects/columns/cards/{card_id}/moves",
+        "/projects/columns/{column_id}",
+        "/projects/columns/{column_id}/cards",
+        "/projects/columns/{column_id}/moves",
+        "/projects/{project_id}",
+        "/projects/{project_id}/collaborators",
+        "/projects/{project_id}/collaborators/{username}",
+        "/projects/{project_id}/collaborators/{username}/permission",
+        "/projects/{project_id}/columns",
+        "/rate_limit",
+        "/repositories",
+        "/search/code",
+        "/search/commits",
+        "/search/issues",
+        "/search/labels",
+        "/search/repositories",
+        "/search/topics",
+        "/search/users",
+        "/teams/{team_id}",
+        "/teams/{team_id}/discussions",
+        "/teams/{team_id}/discussions/{discussion_number}",
+        "/teams/{team_id}/discussions/{discussion_number}/comments",
+        "/teams/{team_id}/invitations",
+        "/teams/{team_id}/members",
+        "/teams/{team_id}/members/{username}",
+        "/teams/{team_id}/memberships/{username}",
+        "/teams/{team_id}/projects",
+        "/teams/{team_id}/projects/{project_id}",
+        "/teams/{team_id}/repos",
+        "/teams/{team_id}/repos/{owner}/{repo}",
+        "/teams/{team_id}/teams",
+        "/users",
+        "/versions",
+        "/zen",
+    } },
+    };
+
+    std::vector<std::string> v;
+    for (auto const& f: families)
+        for (auto r: f.routes)
+            v.push_back(std::string(f.prefix) + r);
+    return v;
+}
+
+#endif
@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+/*
+    This benchmark builds an ip_matcher from the
+    special-purpose networks which SSRF filters
+    deny, plus a number of random IPv4 and IPv6
+    networks, and reports the time to match
+    addresses and the hosts of parsed urls,
+    after the time to compile the rules.
+
+    Usage: boost_url_bench_ip_matcher [rules] [iterations]
+*/
+
+#include <boost/url/ip_matcher.hpp>
+#include <boost/url/url_view.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+
+int
+main(int argc, char** argv)
+{
+    std::size_t rules = 5000;
+    std::size_t iterations = 20;
+    if (argc > 1)
+        rules = std::strtoul(argv[1], nullptr, 10);
+    if (argc > 2)
+        iterations = std::strtoul(argv[2], nullptr, 10);
+
+    urls::ip_matcher m;
+    for (char const* s : {
+        "0.0.0.0/8", "10.0.0.0/8", "100.64.0.0/10",
+        "127.0.0.0/8", "169.254.0.0/16", "172.16.0.0/12",
+        "192.0.0.0/24", "192.168.0.0/16", "198.18.0.0/15",
+        "224.0.0.0/4", "240.0.0.0/4", "::/128", "::1/128",
+        "64:ff9b::/96", "fc00::/7", "fe80::/10", "ff00::/8" })
+        m.insert(s);
+
+    // random networks, with lengths
+    // as in real block lists
+    std::mt19937 g(42);
+    for (std::size_t i = 0; i < rules; ++i)
+    {
+        if (i % 4 != 3)
+        {
+            m.insert(urls::ipv4_network(
+                urls::ipv4_address(
+                    static_cast<std::uint32_t>(g())),
+                16 + g() % 17), i % 8 != 0);
+        }
+        else
+        {
+            urls::ipv6_address::bytes_type b;
+            for (auto& c : b)
+                c = static_cast<unsigned char>(g());
+            b[0] = 0x20 | (b[0] & 0x1f);
+            m.insert(urls::ipv6_network(
+                urls::ipv6_address(b),
+                32 + g() % 97), i % 8 != 0);
+        }
+    }
+    std::printf("%zu rules\n", m.size());
+
+    std::vector<urls::ipv4_address> a4;
+    std::vector<urls::ipv6_address> a6;
+    std::vector<std::string> strs;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        a4.emplace_back(static_cast<std::uint32_t>(g()));
+        urls::ipv6_address::bytes_type b;
+        for (auto& c : b)
+            c = static_cast<unsigned char>(g());
+        b[0] = 0x20 | (b[0] & 0x1f);
+        a6.emplace_back(b);
+        strs.push_back(i % 2 ?
+            "http://" + a4.back().to_string() + "/x" :
+            "http://[" + a6.back().to_string() + "]/x");
+    }
+    std::vector<urls::url_view> urls_;
+    for (auto const& s : strs)
+        urls_.emplace_back(s);
+
+    using clock = std::chrono::steady_clock;
+    auto report = [iterations](
+        char const* name,
+        std::size_t n,
+        clock::time_point a,
+        clock::time_point b)
+    {
+        std::printf("%-24s %8.2f ns/match\n", name,
+            std::chrono::duration<double, std::nano>(
+                b - a).count() / double(n * iterations));
+    };
+
+    // the first match compiles the rules
+    auto t0 = clock::now();
+    std::size_t hits = m.matches(a4[0]);
+    auto t1 = clock::now();
+    std::printf("%-24s %8.2f ms\n", "compile",
+        std::chrono::duration<double, std::milli>(
+            t1 - t0).count());
+
+    t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto const& a : a4)
+            hits += m.matches(a);
+    t1 = clock::now();
+    report("ipv4_address", a4.size(), t0, t1);
+
+    t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto const& a : a6)
+            hits += m.matches(a);
+    t1 = clock::now();
+    report("ipv6_address", a6.size(), t0, t1);
+
+    t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto const& u : urls_)
+            hits += m.matches(u);
+    t1 = clock::now();
+    report("url_view host", urls_.size(), t0, t1);
+
+    std::printf("%zu matches\n", hits);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+/*
+    This benchmark parses and formats a corpus
+    of IPv6 literals in the forms found in urls,
+    and reports the throughput of
+    parse_ipv6_address and ipv6_address::to_buffer
+    next to the inet_pton and inet_ntop of the
+    platform, where they are available.
+
+    Before anything is timed, the results are
+    compared for every input.
+
+    Usage: boost_url_bench_ipv6_address [iterations]
+*/
+
+#include <boost/url/ipv6_address.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#if ! defined(_WIN32)
+# include <arpa/inet.h>
+# define BOOST_URL_BENCH_HAS_INET
+#endif
+
+namespace urls = boost::urls;
+namespace core = boost::core;
+
+//------------------------------------------------
+
+static
+std::string
+hex(unsigned w, bool upper)
+{
+    char buf[8];
+    std::snprintf(buf, sizeof(buf),
+        upper ? "%X" : "%x", w);
+    return buf;
+}
+
+// Literals written by people and programs:
+// canonical, full with leading zeroes,
+// compressed in the middle, link-local,
+// loopback, and IPv4-mapped
+static
+std::vector<std::string>
+make_inputs(std::size_t n)
+{
+    std::mt19937 g(42);
+    std::vector<std::string> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        unsigned w[8];
+        for (auto& x : w)
+            x = g() % 0x10000;
+        std::string s;
+        switch (g() % 6)
+        {
+        case 0:
+            // canonical
+            s = urls::ipv6_address(
+                "2001:db8::" + hex(w[6], false) +
+                ":" + hex(w[7], false)).to_string();
+            break;
+        case 1:
+        {
+            // full form
+            char buf[48];
+            std::snprintf(buf, sizeof(buf),
+                "%04x:%04x:%04x:%04x:%04x:%04x:%04x:%04x",
+                w[0], w[1], w[2], w[3],
+                w[4], w[5], w[6], w[7]);
+            s = buf;
+            break;
+        }
+        case 2:
+            s = hex(w[0], true) + ":" + hex(w[1], true) +
+                ":" + hex(w[2], true) + "::" +
+                hex(w[5], true) + ":" + hex(w[6], true) +
+                ":" + hex(w[7], true);
+            break;
+        case 3:
+            s = "fe80::" + hex(w[4], false) + ":" +
+                hex(w[5], false) + ":" + hex(w[6], false) +
+                ":" + hex(w[7], false);
+            break;
+        case 4:
+            s = g() % 2 ? "::1" : "::";
+            break;
+        default:
+            s = "::ffff:" + std::to_string(w[0] % 256) +
+                "." + std::to_string(w[1] % 256) +
+                "." + std::to_string(w[2] % 256) +
+                "." + std::to_string(w[3] % 256);
+            break;
+        }
+        v.push_back(std::move(s));
+    }
+    return v;
+}
+
+//------------------------------------------------
+
+int
+main(int argc, char** argv)
+{
+    std::size_t iterations = 20;
+    if (argc > 1)
+        iterations = std::strtoul(argv[1], nullptr, 10);
+
+    auto const strs = make_inputs(100000);
+    std::vector<urls::ipv6_address> addrs;
+    addrs.reserve(strs.size());
+    for (auto const& s : strs)
+    {
+        auto rv = urls::parse_ipv6_address(s);
+        if (! rv)
+        {
+            std::printf("parse failed: %s\n", s.c_str());
+            return EXIT_FAILURE;
+        }
+        addrs.push_back(*rv);
+#ifdef BOOST_URL_BENCH_HAS_INET
+        unsigned char b[16];
+        char buf0[urls::ipv6_address::max_str_len];
+        char buf1[INET6_ADDRSTRLEN];
+        if (inet_pton(AF_INET6, s.c_str(), b) != 1 ||
+            std::memcmp(b, rv->to_bytes().data(), 16) != 0 ||
+            rv->to_buffer(buf0, sizeof(buf0)) !=
+                inet_ntop(AF_INET6, b, buf1, sizeof(buf1)))
+        {
+            std::printf("mismatch: %s\n", s.c_str());
+            return EXIT_FAILURE;
+        }
+#endif
+    }
+    std::printf("%zu inputs\n", strs.size());
+
+    using clock = std::chrono::steady_clock;
+    double const total =
+        double(strs.size() * iterations);
+    auto report = [total](
+        char const* name,
+        clock::time_point a,
+        clock::time_point b)
+    {
+        std::printf("%-24s %12.0f addrs/s\n", name, total /
+            std::chrono::duration<double>(b - a).count());
+    };
+
+    std::size_t sink = 0;
+    auto t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto const& s : strs)
+            sink += urls::parse_ipv6_address(
+                s)->to_bytes()[15];
+    auto t1 = clock::now();
+    report("parse_ipv6_address", t0, t1);
+
+    char buf[urls::ipv6_address::max_str_len];
+    t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto const& a : addrs)
+            sink += a.to_buffer(buf, sizeof(buf)).size();
+    t1 = clock::now();
+    report("ipv6_address::to_buffer", t0, t1);
+
+#ifdef BOOST_URL_BENCH_HAS_INET
+    unsigned char b[16];
+    t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto const& s : strs)
+        {
+            inet_pton(AF_INET6, s.c_str(), b);
+            sink += b[15];
+        }
+    t1 = clock::now();
+    report("inet_pton", t0, t1);
+
+    char buf1[INET6_ADDRSTRLEN];
+    t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto const& a : addrs)
+            sink += std::strlen(inet_ntop(AF_INET6,
+                a.to_bytes().data(), buf1, sizeof(buf1)));
+    t1 = clock::now();
+    report("inet_ntop", t0, t1);
+#endif
+
+    if (sink == 0)
+        std::printf("\n");
+    return EXIT_SUCCESS;
+}
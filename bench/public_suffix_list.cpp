@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+/*
+    This benchmark compiles a Public Suffix
+    List and reports the size of the compiled
+    list and the throughput of registrable
+    domain lookups, against scanning the
+    rules of the list for every host.
+
+    Usage: boost_url_bench_public_suffix_list <public_suffix_list.dat>
+*/
+
+#include <boost/url/public_suffix_list.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace core = boost::core;
+
+// The suffix of host with the most labels
+// among the plain rules, by scanning them
+static
+core::string_view
+scan(
+    std::vector<std::string> const& rules,
+    core::string_view host)
+{
+    core::string_view best;
+    for (auto const& r: rules)
+    {
+        if (r.size() > best.size() &&
+            host.ends_with(r) && (
+                host.size() == r.size() ||
+                host[host.size() - r.size() - 1] == '.'))
+            best = host.substr(host.size() - r.size());
+    }
+    return best;
+}
+
+int
+main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::printf(
+            "Usage: %s <public_suffix_list.dat>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    std::ifstream f(argv[1]);
+    if (!f)
+    {
+        std::printf("Cannot open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    std::string const text(
+        (std::istreambuf_iterator<char>(f)),
+        std::istreambuf_iterator<char>());
+
+    using clock = std::chrono::steady_clock;
+    auto t0 = clock::now();
+    auto const psl =
+        urls::public_suffix_list::compile(text);
+    auto t1 = clock::now();
+    std::printf("compile: %.1f ms, %zu bytes\n",
+        std::chrono::duration<double, std::milli>(
+            t1 - t0).count(),
+        psl.data().size());
+
+    // hosts under the plain rules
+    std::vector<std::string> rules;
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        std::size_t eol = text.find('\n', pos);
+        if (eol == std::string::npos)
+            eol = text.size();
+        std::string line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+        if (line.empty() ||
+            line.compare(0, 2, "//") == 0 ||
+            line[0] == '!' || line[0] == '*' ||
+            static_cast<unsigned char>(line[0]) >= 0x80)
+            continue;
+        rules.push_back(line);
+    }
+    std::mt19937 g(42);
+    std::vector<std::string> hosts;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        auto const& r = rules[g() % rules.size()];
+        switch (g() % 3)
+        {
+        case 0:
+            hosts.push_back("example." + r);
+            break;
+        case 1:
+            hosts.push_back("www.example." + r);
+            break;
+        default:
+            hosts.push_back("a.b.cdn.example." + r);
+            break;
+        }
+    }
+
+    std::size_t sink = 0;
+    t0 = clock::now();
+    for (int it = 0; it < 10; ++it)
+        for (auto const& h: hosts)
+            sink += psl.registrable_domain(h).size();
+    t1 = clock::now();
+    double const a = 10.0 * hosts.size() /
+        std::chrono::duration<double>(t1 - t0).count();
+
+    // the scan is slow, so use fewer hosts
+    std::size_t const n = 1000;
+    std::size_t mismatches = 0;
+    t0 = clock::now();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto s = scan(rules, hosts[i]);
+        sink += s.size();
+        if (s != psl.public_suffix(hosts[i]))
+            ++mismatches;
+    }
+    t1 = clock::now();
+    double const b = n /
+        std::chrono::duration<double>(t1 - t0).count();
+
+    std::printf("trie:    %12.0f lookups/s\n", a);
+    std::printf("scan:    %12.0f lookups/s\n", b);
+    std::printf("speedup: %12.0fx\n", a / b);
+
+    // wildcard and exception rules are
+    // not handled by the scan
+    std::printf("differences with the scan: %zu of %zu\n",
+        mismatches, n);
+    if (sink == 0)
+        std::printf("\n");
+    return EXIT_SUCCESS;
+}
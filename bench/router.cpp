@@ -0,0 +1,337 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+/*
+    This benchmark replays request paths
+    through router lookups and reports the
+    latency percentiles and the number of
+    allocations per lookup.
+
+    Two route tables are loaded:
+
+    @li A table modeled after the GitHub
+    REST API, with about 600 routes.
+
+    @li Synthetic tables with up to 10k
+    routes, mixing literal, {param},
+    optional and {*} segments.
+
+    Before anything is timed, every request
+    is checked against the route it was
+    generated from, so the benchmark also
+    works as a stress test for the router.
+
+    Usage: boost_url_bench_router [iterations]
+*/
+
+#include "github_routes.hpp"
+
+#include <boost/url/router.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace core = boost::core;
+
+//------------------------------------------------
+//
+// Allocation counting
+//
+//------------------------------------------------
+
+static std::size_t alloc_count = 0;
+
+void*
+operator new(std::size_t n)
+{
+    ++alloc_count;
+    if (void* p = std::malloc(n ? n : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+//------------------------------------------------
+
+namespace {
+
+constexpr std::size_t no_route = std::size_t(-1);
+
+// A request path and the index of
+// the route it should resolve to
+struct request
+{
+    std::string path;
+    std::size_t route;
+};
+
+struct table
+{
+    char const* name;
+    std::vector<std::string> routes;
+    std::vector<request> requests;
+};
+
+// Replace the replacement fields of a
+// route with values. Fields with the `*`
+// and `+` modifiers receive two segments.
+std::string
+instantiate(core::string_view route)
+{
+    std::string s;
+    std::size_t n = 0;
+    std::size_t i = 0;
+    while (i < route.size())
+    {
+        if (route[i] != '{')
+        {
+            s.push_back(route[i++]);
+            continue;
+        }
+        auto const j = route.find('}', i);
+        char const m = route[j - 1];
+        s += "v" + std::to_string(n++);
+        if (m == '*' || m == '+')
+            s += "/v" + std::to_string(n++);
+        i = j + 1;
+    }
+    return s;
+}
+
+table
+make_github_table()
+{
+    table t;
+    t.name = "github";
+    t.routes = github_routes();
+    for (std::size_t i = 0; i < t.routes.size(); ++i)
+        t.requests.push_back({
+            instantiate(t.routes[i]), i});
+    t.requests.push_back({"/repos/o/r/unknown", no_route});
+    t.requests.push_back({"/orgs/o/teams/t/unknown", no_route});
+    return t;
+}
+
+// n routes under 100 services. The leaves
+// cycle through literal, {param}, {param?}
+// and {*} routes, and every service has a
+// {*} fallback.
+table
+make_synthetic_table(
+    char const* name,
+    std::size_t n)
+{
+    table t;
+    t.name = name;
+    std::size_t const services = 100;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::string const res =
+            "/svc" + std::to_string(i % services) +
+            "/res" + std::to_string(i);
+        std::size_t const k = t.routes.size();
+        switch (i % 4)
+        {
+        case 0:
+            t.routes.push_back(res);
+            t.requests.push_back({res, k});
+            break;
+        case 1:
+            t.routes.push_back(res + "/{id}");
+            t.requests.push_back({res + "/42", k});
+            break;
+        case 2:
+            t.routes.push_back(res + "/{id}/items/{item?}");
+            t.requests.push_back({res + "/42/items/abc", k});
+            t.requests.push_back({res + "/42/items", k});
+            break;
+        default:
+            t.routes.push_back(res + "/files/{*}");
+            t.requests.push_back({res + "/files/a/b/c.txt", k});
+            t.requests.push_back({res + "/files", k});
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < services; ++i)
+    {
+        std::string const svc =
+            "/svc" + std::to_string(i);
+        t.requests.push_back({
+            svc + "/unknown/path", t.routes.size()});
+        t.routes.push_back(svc + "/{*}");
+    }
+    t.requests.push_back({"/unknown", no_route});
+    t.requests.push_back({"/unknown/svc0", no_route});
+    return t;
+}
+
+using clock_type = std::chrono::steady_clock;
+
+double
+ns_between(
+    clock_type::time_point t0,
+    clock_type::time_point t1)
+{
+    return std::chrono::duration<
+        double, std::nano>(t1 - t0).count();
+}
+
+// the cost of reading the clock, which
+// is included in every latency sample
+double
+clock_overhead()
+{
+    std::vector<double> v(10000);
+    for (auto& x: v)
+    {
+        auto const t0 = clock_type::now();
+        auto const t1 = clock_type::now();
+        x = ns_between(t0, t1);
+    }
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+double
+percentile(
+    std::vector<double> const& sorted,
+    double p)
+{
+    auto const i = static_cast<std::size_t>(
+        p * static_cast<double>(sorted.size() - 1));
+    return sorted[i];
+}
+
+void
+run(table const& t, std::size_t iterations)
+{
+    urls::router<std::size_t> r;
+    for (std::size_t i = 0; i < t.routes.size(); ++i)
+        r.insert(t.routes[i], i);
+    if (r.size() != t.routes.size())
+    {
+        std::fprintf(stderr,
+            "%s: %zu routes inserted, %zu expected\n",
+            t.name, r.size(), t.routes.size());
+        std::exit(EXIT_FAILURE);
+    }
+
+    // check every request, which also
+    // freezes the table
+    urls::matches m;
+    for (auto const& q: t.requests)
+    {
+        std::size_t const* v = r.find(
+            core::string_view(q.path), m);
+        std::size_t const i = v ? *v : no_route;
+        if (i != q.route)
+        {
+            std::fprintf(stderr,
+                "%s: \"%s\" routed to \"%s\", expected \"%s\"\n",
+                t.name, q.path.c_str(),
+                i == no_route ? "none" : t.routes[i].c_str(),
+                q.route == no_route ? "none" : t.routes[q.route].c_str());
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    // replay the requests in random order
+    // so the branch predictor cannot
+    // learn the sequence
+    std::vector<urls::segments_encoded_view> paths;
+    paths.reserve(t.requests.size());
+    for (auto const& q: t.requests)
+        paths.emplace_back(core::string_view(q.path));
+    std::mt19937 rng(42);
+    std::shuffle(paths.begin(), paths.end(), rng);
+
+    std::vector<double> samples;
+    samples.reserve(iterations * paths.size());
+    std::size_t found = 0;
+    std::size_t const allocs0 = alloc_count;
+    for (std::size_t k = 0; k < iterations; ++k)
+    {
+        for (auto const& p: paths)
+        {
+            auto const t0 = clock_type::now();
+            found += r.find(p, m) != nullptr;
+            auto const t1 = clock_type::now();
+            samples.push_back(ns_between(t0, t1));
+        }
+    }
+    std::size_t const allocs = alloc_count - allocs0;
+
+    // the mean without the clock in the loop
+    auto const t0 = clock_type::now();
+    for (std::size_t k = 0; k < iterations; ++k)
+        for (auto const& p: paths)
+            found += r.find(p, m) != nullptr;
+    auto const t1 = clock_type::now();
+
+    double const lookups = static_cast<double>(
+        iterations * paths.size());
+    std::sort(samples.begin(), samples.end());
+    std::printf(
+        "%-12s %7zu %9zu %9.1f %9.1f %9.1f %9.1f %8.3f\n",
+        t.name,
+        t.routes.size(),
+        paths.size(),
+        ns_between(t0, t1) / lookups,
+        percentile(samples, 0.50),
+        percentile(samples, 0.99),
+        samples.back(),
+        static_cast<double>(allocs) / lookups);
+
+    // keep the lookups from being optimized out
+    if (found == 0)
+        std::exit(EXIT_FAILURE);
+}
+
+} // (anon)
+
+int
+main(int argc, char** argv)
+{
+    std::size_t iterations = 20;
+    if (argc > 1)
+        iterations = std::strtoul(argv[1], nullptr, 10);
+
+    std::vector<table> tables;
+    tables.push_back(make_github_table());
+    tables.push_back(make_synthetic_table("synthetic1k", 1000));
+    tables.push_back(make_synthetic_table("synthetic10k", 10000));
+
+    std::printf("clock overhead: %.1f ns (included in percentiles)\n",
+        clock_overhead());
+    std::printf(
+        "%-12s %7s %9s %9s %9s %9s %9s %8s\n",
+        "table", "routes", "requests", "mean ns",
+        "p50 ns", "p99 ns", "max ns", "allocs");
+    for (auto const& t: tables)
+        run(t, iterations);
+}
@@ -0,0 +1,282 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+/*
+    This benchmark sanitizes a mix of valid and
+    sloppy user-submitted links, and reports the
+    throughput of sanitize_urls, of sanitize_url
+    into a new url for each input, and of the
+    approach of the sanitize example before it
+    used the library: splitting the input and
+    calling a setter for each component of a
+    new url.
+
+    Before anything is timed, the results are
+    compared for every input.
+
+    Usage: boost_url_bench_sanitize [iterations]
+*/
+
+#include <boost/url/sanitize.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/url.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace core = boost::core;
+
+//------------------------------------------------
+
+// Split the input at its delimiters and
+// set each component of a new url
+struct components
+{
+    core::string_view scheme;
+    core::string_view user;
+    core::string_view password;
+    core::string_view host;
+    core::string_view port;
+    core::string_view path;
+    core::string_view query;
+    core::string_view fragment;
+};
+
+static
+void
+split_relative(
+    core::string_view s,
+    components& out)
+{
+    auto const n = s.find_first_of("?#");
+    out.path = s.substr(0, n);
+    if (n == core::string_view::npos)
+        return;
+    core::string_view qf = s.substr(n);
+    if (qf.front() == '?')
+    {
+        auto const m = qf.find('#');
+        out.query = qf.substr(1, m - 1);
+        if (m != core::string_view::npos)
+            out.fragment = qf.substr(m + 1);
+        return;
+    }
+    out.fragment = qf.substr(1);
+}
+
+static
+void
+split_authority(
+    core::string_view s,
+    components& out)
+{
+    auto const n = s.find_first_of("/?#");
+    core::string_view hostinfo = s.substr(0, n);
+    auto const at = hostinfo.find_last_of('@');
+    if (at != core::string_view::npos)
+    {
+        core::string_view ui = hostinfo.substr(0, at);
+        auto const c = ui.find(':');
+        out.user = ui.substr(0, c);
+        if (c != core::string_view::npos)
+            out.password = ui.substr(c + 1);
+        hostinfo = hostinfo.substr(at + 1);
+    }
+    auto const c = hostinfo.find(':');
+    out.host = hostinfo.substr(0, c);
+    if (c != core::string_view::npos)
+        out.port = hostinfo.substr(c + 1);
+    split_relative(s.substr(
+        hostinfo.data() + hostinfo.size() - s.data()), out);
+}
+
+static
+void
+split(
+    core::string_view s,
+    components& out)
+{
+    if (s.starts_with("//"))
+        return split_authority(s.substr(2), out);
+    auto const c = s.find_first_of(":/?#");
+    if (c != core::string_view::npos && s[c] == ':')
+    {
+        out.scheme = s.substr(0, c);
+        s = s.substr(c + 1);
+        if (s.starts_with("//"))
+            return split_authority(s.substr(2), out);
+        return split_relative(s, out);
+    }
+    core::string_view seg = s.substr(0, s.find('/'));
+    auto const d = seg.find_first_of(".:");
+    if (d != core::string_view::npos &&
+        d != seg.size() - 1 &&
+        urls::parse_authority(seg))
+        return split_authority(s, out);
+    split_relative(s, out);
+}
+
+static
+urls::url
+sanitize_setters(core::string_view s)
+{
+    // a valid relative-ref might still
+    // have an authority to infer
+    auto rv = urls::parse_uri_reference(s);
+    if (rv && (rv->has_scheme() || rv->has_authority()))
+        return *rv;
+    components o;
+    split(s, o);
+    urls::url u;
+    if (o.scheme.data())
+        u.set_scheme(o.scheme);
+    if (o.user.data())
+        u.set_encoded_user(o.user);
+    if (o.password.data())
+        u.set_encoded_password(o.password);
+    if (o.host.data())
+        u.set_encoded_host(o.host);
+    if (o.port.data())
+        u.set_port(o.port);
+    if (o.path.data())
+        u.set_encoded_path(o.path);
+    if (o.query.data())
+        u.set_encoded_query(o.query);
+    if (o.fragment.data())
+        u.set_encoded_fragment(o.fragment);
+    return u;
+}
+
+//------------------------------------------------
+
+static char const* const hosts[] = {
+    "www.boost.org", "github.com", "example.com",
+    "docs.python.org", "en.wikipedia.org",
+};
+
+static char const* const paths[] = {
+    "/", "/doc/libs/release/libs/url/index.html",
+    "/wiki/Main Page", "/search", "/a b/c d/",
+    "/users/42/repos",
+};
+
+static char const* const queries[] = {
+    "", "?q=boost url", "?id=1&sort=desc",
+    "?utm_source=news&utm_medium=email",
+    "?a=[1]&b=\"x\"",
+};
+
+static
+std::vector<std::string>
+make_inputs(std::size_t n)
+{
+    std::mt19937 g(42);
+    auto pick = [&g](char const* const* a, std::size_t size)
+    {
+        return std::string(a[g() % size]);
+    };
+    std::vector<std::string> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::string h = pick(hosts, 5);
+        std::string p = pick(paths, 6);
+        std::string q = pick(queries, 5);
+        switch (g() % 4)
+        {
+        case 0:
+            v.push_back("https://" + h + p + q);
+            break;
+        case 1:
+            v.push_back(h + p + q);
+            break;
+        case 2:
+            v.push_back("http://user@" + h + ":8080" + p + q + "#top");
+            break;
+        default:
+            v.push_back("//" + h + p + q);
+            break;
+        }
+    }
+    return v;
+}
+
+//------------------------------------------------
+
+int
+main(int argc, char** argv)
+{
+    std::size_t iterations = 5;
+    if (argc > 1)
+        iterations = std::strtoul(argv[1], nullptr, 10);
+
+    auto const strs = make_inputs(100000);
+    std::vector<core::string_view> in(
+        strs.begin(), strs.end());
+    std::vector<urls::url> out(in.size());
+
+    std::size_t changed = urls::sanitize_urls(
+        in.data(), in.size(), out.data());
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        if (out[i].buffer() != sanitize_setters(in[i]).buffer())
+        {
+            std::printf("mismatch: %s\n", strs[i].c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    std::printf("%zu inputs, %zu sanitized\n",
+        in.size(), changed);
+
+    using clock = std::chrono::steady_clock;
+    std::size_t sink = 0;
+    auto t0 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        sink += urls::sanitize_urls(
+            in.data(), in.size(), out.data());
+    auto t1 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+    {
+        for (auto s : in)
+        {
+            urls::url u;
+            urls::sanitize_url(s, u);
+            sink += u.size();
+        }
+    }
+    auto t2 = clock::now();
+    for (std::size_t it = 0; it < iterations; ++it)
+        for (auto s : in)
+            sink += sanitize_setters(s).size();
+    auto t3 = clock::now();
+
+    double const total =
+        double(in.size() * iterations);
+    auto rate = [total](
+        clock::time_point a,
+        clock::time_point b)
+    {
+        return total /
+            std::chrono::duration<double>(b - a).count();
+    };
+    std::printf("%-24s %12.0f urls/s\n",
+        "sanitize_urls", rate(t0, t1));
+    std::printf("%-24s %12.0f urls/s\n",
+        "sanitize_url, new url", rate(t1, t2));
+    std::printf("%-24s %12.0f urls/s\n",
+        "setters, new url", rate(t2, t3));
+    if (sink == 0)
+        std::printf("\n");
+    return EXIT_SUCCESS;
+}
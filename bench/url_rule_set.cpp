@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+/*
+    This benchmark classifies urls with a set
+    of glob rules like the ones in the finicky
+    example, and reports the throughput of
+    url_rule_set against checking every rule
+    one at a time.
+
+    Before anything is timed, the results of
+    both are compared for every url, so the
+    benchmark also works as a stress test for
+    the rule set.
+
+    Usage: boost_url_bench_url_rule_set [iterations]
+*/
+
+#include <boost/url/url_rule_set.hpp>
+#include <boost/url/url_view.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace core = boost::core;
+
+using part = urls::url_rule_set::part;
+
+//------------------------------------------------
+
+// Match one glob with backtracking,
+// the way a single rule is checked
+static
+bool
+glob(
+    char const* p, char const* pe,
+    char const* s, char const* se)
+{
+    while (p != pe)
+    {
+        if (*p == '*')
+        {
+            bool const any =
+                p + 1 != pe && p[1] == '*';
+            while (p != pe && *p == '*')
+                ++p;
+            for (char const* it = s;; ++it)
+            {
+                if (glob(p, pe, it, se))
+                    return true;
+                if (it == se ||
+                    (!any && *it == '/'))
+                    return false;
+            }
+        }
+        if (s == se)
+            return false;
+        if (*p == '?')
+        {
+            if (*s == '/')
+                return false;
+        }
+        else if (*p != *s)
+        {
+            return false;
+        }
+        ++p;
+        ++s;
+    }
+    return s == se;
+}
+
+struct rule
+{
+    part p;
+    std::string pattern;
+};
+
+static
+core::string_view
+part_string(
+    urls::url_view const& u,
+    part p)
+{
+    switch (p)
+    {
+    case part::host:
+        return u.encoded_host();
+    case part::path:
+        return u.encoded_path();
+    default:
+        return u.buffer();
+    }
+}
+
+static
+std::size_t
+find_first(
+    std::vector<rule> const& rules,
+    urls::url_view const& u)
+{
+    for (std::size_t i = 0; i < rules.size(); ++i)
+    {
+        core::string_view s =
+            part_string(u, rules[i].p);
+        auto const& pt = rules[i].pattern;
+        if (glob(
+                pt.data(), pt.data() + pt.size(),
+                s.data(), s.data() + s.size()))
+            return i;
+    }
+    return urls::url_rule_set::npos;
+}
+
+//------------------------------------------------
+
+static char const* const domains[] = {
+    "apple", "google", "example", "github",
+    "zoom", "slack", "atlassian", "figma",
+    "notion", "spotify", "youtube", "linear",
+};
+
+static
+std::vector<rule>
+make_rules(std::size_t n)
+{
+    std::vector<rule> v;
+    std::size_t i = 0;
+    while (v.size() < n)
+    {
+        std::string d = domains[
+            i % (sizeof(domains) / sizeof(*domains))];
+        std::string k = std::to_string(i);
+        switch (i % 4)
+        {
+        case 0:
+            v.push_back({part::url,
+                "**/*" + d + k + ".com/*"});
+            break;
+        case 1:
+            v.push_back({part::host,
+                "*." + d + k + ".com"});
+            break;
+        case 2:
+            v.push_back({part::path,
+                "/" + d + k + "/**"});
+            break;
+        default:
+            v.push_back({part::url,
+                "https://" + d + k + ".org/*/?"});
+            break;
+        }
+        ++i;
+    }
+    return v;
+}
+
+static
+std::vector<std::string>
+make_urls(
+    std::size_t rules,
+    std::size_t n)
+{
+    std::mt19937 g(42);
+    std::vector<std::string> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        // a few urls match no rule
+        std::size_t k = g() % (rules + rules / 8);
+        std::string d = domains[
+            k % (sizeof(domains) / sizeof(*domains))];
+        d += std::to_string(k);
+        switch (g() % 4)
+        {
+        case 0:
+            v.push_back("https://www." + d +
+                ".com/index.html?q=1");
+            break;
+        case 1:
+            v.push_back("http://mail." + d +
+                ".com/inbox/42");
+            break;
+        case 2:
+            v.push_back("https://cdn.net/" + d +
+                "/static/app.js");
+            break;
+        default:
+            v.push_back("https://" + d + ".org/docs/a");
+            break;
+        }
+    }
+    return v;
+}
+
+//------------------------------------------------
+
+int
+main(int argc, char** argv)
+{
+    std::size_t iterations = 5;
+    if (argc > 1)
+        iterations = std::strtoul(argv[1], nullptr, 10);
+
+    std::printf("%8s %14s %14s %10s\n",
+        "rules", "rule set/s", "one by one/s", "speedup");
+    for (std::size_t n: {16, 64, 256, 1024})
+    {
+        auto const rules = make_rules(n);
+        auto const strs = make_urls(n, 50000);
+        std::vector<urls::url_view> us;
+        us.reserve(strs.size());
+        for (auto const& s: strs)
+            us.emplace_back(s);
+
+        urls::url_rule_set rs;
+        for (auto const& r: rules)
+            rs.add(r.p, r.pattern);
+
+        for (auto const& u: us)
+        {
+            if (rs.find_first(u) != find_first(rules, u))
+            {
+                std::printf("mismatch: %s\n",
+                    u.buffer().data());
+                return EXIT_FAILURE;
+            }
+        }
+
+        using clock = std::chrono::steady_clock;
+        std::size_t sink = 0;
+        auto t0 = clock::now();
+        for (std::size_t it = 0; it < iterations; ++it)
+            for (auto const& u: us)
+                sink += rs.find_first(u);
+        auto t1 = clock::now();
+        for (std::size_t it = 0; it < iterations; ++it)
+            for (auto const& u: us)
+                sink += find_first(rules, u);
+        auto t2 = clock::now();
+
+        double const total =
+            double(us.size() * iterations);
+        double const a = total /
+            std::chrono::duration<double>(t1 - t0).count();
+        double const b = total /
+            std::chrono::duration<double>(t2 - t1).count();
+        std::printf("%8zu %14.0f %14.0f %9.1fx\n",
+            n, a, b, a / b);
+        if (sink == 0)
+            std::printf("\n");
+    }
+    return EXIT_SUCCESS;
+}
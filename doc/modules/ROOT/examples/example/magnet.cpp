@@ -15,6 +15,8 @@
 
 #include <boost/url/url_view.hpp>
 #include <boost/url/url.hpp>
+#include <boost/url/decode.hpp>
+#include <boost/url/filtered_params.hpp>
 #include <boost/url/optional.hpp>
 #include <boost/url/parse.hpp>
 #include <boost/url/pct_string_view.hpp>
@@ -22,8 +24,8 @@
 #include <boost/url/grammar/digit_chars.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/core/detail/string_view.hpp>
-#include "filter_view.hpp"
 #include <iostream>
+#include <string>
 
 namespace urls = boost::urls;
 namespace core = boost::core;
@@ -39,7 +41,7 @@ namespace core = boost::core;
 struct is_exact_topic
 {
     bool
-    operator()(urls::param_view p);
+    operator()(urls::param_pct_view p) const noexcept;
 };
 
 /** Callable to identify a magnet url parameter
@@ -49,7 +51,9 @@ struct is_exact_topic
 
     These urls are percent-encoded twice,
     which means we need to decode it once
-    before attempting to parse it.
+    before attempting to parse it. Values are
+    decoded into a buffer on the stack unless
+    they are unusually long.
 
     This callable is used as a filter for
     the keys_view.
@@ -63,37 +67,39 @@ public:
         : k_(key) {}
 
     bool
-    operator()(urls::param_view p);
+    operator()(urls::param_pct_view p) const;
 };
 
 /** Callable to convert param values to urls
 
     This callable converts the value of a
-    query parameter into a urls::url_view.
+    query parameter into a urls::url_view
+    which references the magnet link.
 
     This callable is used as a transform
     function for the topics_view.
  */
 struct param_view_to_url
 {
-    urls::url
-    operator()(urls::param_view p);
+    urls::url_view
+    operator()(urls::param_pct_view p) const noexcept;
 };
 
-/** Callable to convert param values to std::string
+/** Callable to convert param values to decoded strings
 
     This callable converts the value of a
-    query parameter into a std::string.
+    query parameter into a urls::decode_view,
+    which decodes the value while it is read.
 
     This callable is used as a transform
     function for the keys_view.
  */
 struct to_decoded_value
 {
-    std::string
-    operator()(urls::param_view p)
+    urls::decode_view
+    operator()(urls::param_pct_view p) const noexcept
     {
-        return p.value;
+        return *p.value;
     }
 };
 
@@ -112,7 +118,7 @@ struct to_decoded_value
 struct param_view_to_infohash
 {
     core::string_view
-    operator()(urls::param_view p);
+    operator()(urls::param_pct_view p) const noexcept;
 };
 
 /** Callable to convert param values to protocols
@@ -130,7 +136,7 @@ struct param_view_to_infohash
 struct to_protocol
 {
     core::string_view
-    operator()(urls::param_view p);
+    operator()(urls::param_pct_view p) const noexcept;
 };
 
 struct magnet_link_rule_t;
@@ -174,25 +180,22 @@ class magnet_link_view
 public:
     /// A view of all exact topics in the magnet_link
     using topics_view =
-        filter_view<
-            urls::params_view,
-            urls::url,
+        urls::filtered_params<
+            urls::params_encoded_view,
             is_exact_topic,
             param_view_to_url>;
 
     /// A view of all info_hashes in the magnet_link
     using info_hashes_view =
-        filter_view<
-            urls::params_view,
-            std::string,
+        urls::filtered_params<
+            urls::params_encoded_view,
             is_exact_topic,
             param_view_to_infohash>;
 
     /// A view of all protocols in the magnet_link
     using protocols_view =
-        filter_view<
-            urls::params_view,
-            std::string,
+        urls::filtered_params<
+            urls::params_encoded_view,
             is_exact_topic,
             to_protocol>;
 
@@ -203,9 +206,8 @@ public:
         parameter keys.
     */
     using keys_view =
-        filter_view<
-            urls::params_view,
-            std::string,
+        urls::filtered_params<
+            urls::params_encoded_view,
             is_url_with_key,
             to_decoded_value>;
 
@@ -361,44 +363,54 @@ private:
 
 bool
 is_exact_topic::
-operator()(urls::param_view p)
+operator()(urls::param_pct_view p) const noexcept
 {
-    // These comparisons use the lazy
-    // operator== for urls::pct_string_view
-    // For instance, the comparison also works
-    // if the underlying key is "%78%74"/
-    if (p.key == "xt")
+    // These comparisons decode the key
+    // while it is read. For instance, the
+    // comparison also works if the
+    // underlying key is "%78%74".
+    urls::decode_view k = *p.key;
+    if (k == "xt")
         return true;
     return
-        p.key.size() > 3 &&
-        *std::next(p.key.begin(), 0) == 'x' &&
-        *std::next(p.key.begin(), 1) == 't' &&
-        *std::next(p.key.begin(), 2) == '.' &&
+        k.size() > 3 &&
+        k.starts_with("xt.") &&
         std::all_of(
-            std::next(p.key.begin(), 3),
-            p.key.end(),
+            std::next(k.begin(), 3),
+            k.end(),
             urls::grammar::digit_chars);
 }
 
 bool
 is_url_with_key::
-operator()(urls::param_view p)
+operator()(urls::param_pct_view p) const
 {
-    if (p.key != k_)
-        return false;
-    boost::system::error_code ec;
-    std::string buf(
-        p.value.begin(), p.value.end());
-    if (ec.failed())
+    if (*p.key != k_)
         return false;
+    char buf[2048];
+    std::string s;
+    core::string_view v;
+    if (p.value.decoded_size() <= sizeof(buf))
+    {
+        auto n = urls::decode(
+            buf, sizeof(buf), p.value);
+        if (!n)
+            return false;
+        v = core::string_view(buf, *n);
+    }
+    else
+    {
+        s = p.value.decode();
+        v = s;
+    }
     boost::system::result<urls::url_view> r =
-        urls::parse_uri(buf);
+        urls::parse_uri(v);
     return r.has_value();
 }
 
-urls::url
+urls::url_view
 param_view_to_url::
-operator()(urls::param_view p)
+operator()(urls::param_pct_view p) const noexcept
 {
     // `param_view_to_url` is used in topics_view,
     // where the URL is not
@@ -408,13 +420,12 @@ operator()(urls::param_view p)
     auto ur =
         urls::parse_uri(p.value);
     BOOST_ASSERT(ur);
-    urls::url u = *ur;
-    return u;
+    return *ur;
 }
 
 core::string_view
 param_view_to_infohash::
-operator()(urls::param_view p)
+operator()(urls::param_pct_view p) const noexcept
 {
     urls::url_view topic =
         urls::parse_uri(p.value).value();
@@ -427,7 +438,7 @@ operator()(urls::param_view p)
 
 core::string_view
 to_protocol::
-operator()(urls::param_view p)
+operator()(urls::param_pct_view p) const noexcept
 {
     urls::url_view topic =
         urls::parse_uri(p.value).value();
@@ -440,48 +451,48 @@ auto
 magnet_link_view::exact_topics() const noexcept
     -> topics_view
 {
-    return {u_.params()};
+    return topics_view(u_.encoded_params());
 }
 
 auto
 magnet_link_view::info_hashes() const noexcept
     -> info_hashes_view
 {
-    return {u_.params()};
+    return info_hashes_view(u_.encoded_params());
 }
 
 auto
 magnet_link_view::protocols() const noexcept
     -> protocols_view
 {
-    return {u_.params()};
+    return protocols_view(u_.encoded_params());
 }
 
 auto
 magnet_link_view::address_trackers() const
     -> keys_view
 {
-    return {
-        u_.params(),
-        is_url_with_key{"tr"}};
+    return keys_view(
+        u_.encoded_params(),
+        is_url_with_key{"tr"});
 }
 
 auto
 magnet_link_view::exact_sources() const
     -> keys_view
 {
-    return {
-        u_.params(),
-        is_url_with_key{"xs"}};
+    return keys_view(
+        u_.encoded_params(),
+        is_url_with_key{"xs"});
 }
 
 auto
 magnet_link_view::acceptable_sources() const
     -> keys_view
 {
-    return {
-        u_.params(),
-        is_url_with_key{"as"}};
+    return keys_view(
+        u_.encoded_params(),
+        is_url_with_key{"as"});
 }
 
 boost::optional<std::string>
@@ -498,9 +509,9 @@ auto
 magnet_link_view::manifest_topics() const
     -> keys_view
 {
-    return {
-        u_.params(),
-        is_url_with_key{"mt"}};
+    return keys_view(
+        u_.encoded_params(),
+        is_url_with_key{"mt"});
 }
 
 boost::optional<urls::pct_string_view>
@@ -513,9 +524,9 @@ auto
 magnet_link_view::web_seed() const
     -> keys_view
 {
-    return {
-        u_.params(),
-        is_url_with_key{"ws"}};
+    return keys_view(
+        u_.encoded_params(),
+        is_url_with_key{"ws"});
 }
 
 boost::optional<urls::pct_string_view>
@@ -602,7 +613,7 @@ magnet_link_rule_t::parse(
     // 2) Check if exact topics are valid urls
     // and that we have at least one. This is the
     // only mandatory field in magnet links.
-    auto ps = m.u_.params();
+    auto ps = m.u_.encoded_params();
     auto pit = ps.begin();
     auto pend = ps.end();
     pit = std::find_if(pit, pend, is_exact_topic{});
@@ -614,7 +625,7 @@ magnet_link_rule_t::parse(
 
     // all topics should parse as valid urls
     if (!std::all_of(pit, pend, [](
-        urls::param_view p)
+        urls::param_pct_view p)
     {
         if (!is_exact_topic{}(p))
             return true;
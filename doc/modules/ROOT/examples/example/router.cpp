@@ -15,11 +15,7 @@
     function.
 */
 
-#ifndef BOOST_URL_SOURCE
-#define BOOST_URL_SOURCE
-#endif
-
-#include "router.hpp"
+#include <boost/url/router.hpp>
 
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
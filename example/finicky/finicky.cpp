@@ -17,13 +17,16 @@
 */
 
 #include <boost/url/url.hpp>
+#include <boost/url/url_rule_set.hpp>
 #include <boost/url/parse.hpp>
 #include <boost/system/result.hpp>
 #include <boost/json/stream_parser.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <boost/regex.hpp>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 namespace urls = boost::urls;
 namespace json = boost::json;
@@ -48,105 +51,151 @@ read_json( std::istream& is, boost::system::error_code& ec )
     return p.release();
 }
 
-bool
-glob_match(
-    core::string_view pattern,
-    core::string_view str)
+using part = urls::url_rule_set::part;
+
+core::string_view
+part_string(
+    urls::url_view_base const& u,
+    part p)
 {
-    // regex
-    if (str.starts_with("/") &&
-        str.ends_with("/"))
+    switch (p)
     {
-        const boost::regex pr(pattern.begin() + 1, pattern.end() - 1);
-        return boost::regex_match(std::string(str), pr);
+    default:
+    case part::url:       return u.buffer();
+    case part::scheme:    return u.scheme();
+    case part::authority: return u.encoded_authority();
+    case part::userinfo:  return u.encoded_userinfo();
+    case part::user:      return u.encoded_user();
+    case part::password:  return u.encoded_password();
+    case part::host:      return u.encoded_host();
+    case part::port:      return u.port();
+    case part::path:      return u.encoded_path();
+    case part::query:     return u.encoded_query();
+    case part::fragment:  return u.encoded_fragment();
     }
+}
 
-    // literal
-    if (!pattern.contains('*'))
-    {
-        return pattern == str;
-    }
+/*  The match fields of a list of rules,
+    compiled once when the configuration
+    is loaded.
+
+    Glob patterns of every rule go into one
+    url_rule_set, which checks all of them
+    with a single scan of the url. Patterns
+    between slashes are regular expressions,
+    which are compiled once as well.
+*/
+class matcher
+{
+    urls::url_rule_set rs_;
+
+    // the config rule of each glob
+    std::vector<std::size_t> owners_;
 
-    // glob
-    std::string p = pattern;
-    std::size_t i = p.find('*');
-    while (i != std::string::npos)
+    struct regex_rule
     {
-        auto e = std::min(p.find_first_not_of('*', i), p.size());
-        std::size_t n = e - i;
-        if (n == 1)
-        {
-            p.replace(i, e, "[^/]*");
-            i += 5;
-        }
-        else
+        boost::regex re;
+        part p;
+        std::size_t owner;
+    };
+
+    std::vector<regex_rule> regexes_;
+
+public:
+    void
+    add(
+        part p,
+        core::string_view pattern,
+        std::size_t owner)
+    {
+        if (pattern.size() > 1 &&
+            pattern.starts_with("/") &&
+            pattern.ends_with("/"))
         {
-            p.replace(i, e, ".*");
-            i += 2;
+            regexes_.push_back({
+                boost::regex(
+                    pattern.begin() + 1,
+                    pattern.end() - 1),
+                p, owner});
+            return;
         }
-        i = p.find('*', i);
+        rs_.add(p, pattern);
+        owners_.push_back(owner);
     }
-    const boost::regex pr(p);
-    return boost::regex_match(std::string(str), pr);
-}
 
-bool
-url_match(
-    json::value& mv,
-    urls::url const& u)
-{
-    if (mv.is_string())
-    {
-        json::string& p = mv.as_string();
-        return glob_match(u.buffer(), p);
-    }
-    else if (mv.is_array())
+    // Add the "match" field of a config rule
+    void
+    add(
+        json::value const& mv,
+        std::size_t owner)
     {
-        json::array& m = mv.as_array();
-        for (auto& mi: m)
+        if (mv.is_string())
         {
-            if (!mi.is_string())
-                throw std::invalid_argument(
-                    "handle match is not a string");
-            if (glob_match(mi.as_string(), u.buffer()))
-                return true;
+            add(part::url, mv.as_string(), owner);
         }
-    }
-    else if (mv.is_object())
-    {
-        json::object& m = mv.as_object();
-        std::pair<core::string_view, core::string_view>
-            field_values[] = {
-                {"protocol",  u.scheme()},
-                {"authority", u.encoded_authority()},
-                {"username",  u.encoded_user()},
-                {"user",      u.encoded_user()},
-                {"password",  u.encoded_password()},
-                {"userinfo",  u.encoded_userinfo()},
-                {"host",      u.encoded_host()},
-                {"port",      u.port()},
-                {"path",      u.encoded_path()},
-                {"pathname",  u.encoded_path()},
-                {"query",     u.encoded_query()},
-                {"search",    u.encoded_query()},
-                {"fragment",  u.encoded_fragment()},
-                {"hash",      u.encoded_fragment()},
-            };
-        for (auto& p: field_values)
+        else if (mv.is_array())
+        {
+            for (auto& mi: mv.as_array())
+            {
+                if (!mi.is_string())
+                    throw std::invalid_argument(
+                        "handle match is not a string");
+                add(part::url, mi.as_string(), owner);
+            }
+        }
+        else if (mv.is_object())
         {
-            auto it = m.find(p.first);
-            if (it != m.end())
+            std::pair<core::string_view, part>
+                fields[] = {
+                    {"protocol",  part::scheme},
+                    {"authority", part::authority},
+                    {"username",  part::user},
+                    {"user",      part::user},
+                    {"password",  part::password},
+                    {"userinfo",  part::userinfo},
+                    {"host",      part::host},
+                    {"port",      part::port},
+                    {"path",      part::path},
+                    {"pathname",  part::path},
+                    {"query",     part::query},
+                    {"search",    part::query},
+                    {"fragment",  part::fragment},
+                    {"hash",      part::fragment},
+                };
+            json::object const& m = mv.as_object();
+            for (auto& f: fields)
             {
+                auto it = m.find(f.first);
+                if (it == m.end())
+                    continue;
                 if (!it->value().is_string())
                     throw std::invalid_argument(
                         "match fields should be a strings");
-                if (glob_match(p.second, p.first))
-                    return true;
+                add(f.second, it->value().as_string(), owner);
             }
         }
     }
-    return false;
-}
+
+    // Return the rules which match u,
+    // in increasing order
+    std::vector<std::size_t>
+    match(urls::url_view_base const& u) const
+    {
+        std::vector<std::size_t> v;
+        rs_.match(u, v);
+        for (auto& i: v)
+            i = owners_[i];
+        for (auto const& r: regexes_)
+        {
+            core::string_view s = part_string(u, r.p);
+            if (boost::regex_match(s.begin(), s.end(), r.re))
+                v.push_back(r.owner);
+        }
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        return v;
+    }
+};
 
 #define CHECK(c, msg)             \
     if (!(c))                     \
@@ -200,14 +249,15 @@ int main(int argc, char** argv)
             rsit->value().is_array(),
             "rewrite rules should be an array");
         auto& rs = rsit->value().as_array();
-        for (auto& rv: rs)
+
+        // Compile the match fields once
+        matcher m;
+        for (std::size_t i = 0; i < rs.size(); ++i)
         {
             CHECK(
-                rv.is_object(),
+                rs[i].is_object(),
                 "individual rewrite rule should be an object");
-            json::object& r = rv.as_object();
-
-            // Look for match
+            json::object& r = rs[i].as_object();
             auto mit = r.find("match");
             CHECK(
                 mit != r.end(),
@@ -215,8 +265,17 @@ int main(int argc, char** argv)
             CHECK(
                 mit->value().is_object() || mit->value().is_string(),
                 "rewrite match field is not an object");
-            if (!url_match(mit->value(), u))
-                continue;
+            m.add(mit->value(), i);
+        }
+
+        // Each rewrite applies to the url as
+        // rewritten by the rules before it
+        std::vector<std::size_t> hits = m.match(u);
+        std::size_t next = 0;
+        while (next < hits.size())
+        {
+            std::size_t i = hits[next];
+            json::object& r = rs[i].as_object();
 
             // Apply replacement rule
             auto uit = r.find("url");
@@ -233,7 +292,7 @@ int main(int argc, char** argv)
                 json::string& uo = uit->value().as_string();
                 auto ru1 = urls::parse_uri(uo);
                 CHECK(ru1, "url " << uo.c_str() << " is invalid");
-                u = *ru;
+                u = *ru1;
             }
             else
             {
@@ -345,6 +404,12 @@ int main(int argc, char** argv)
                         it->value().as_string().subview());
                 }
             }
+
+            // Match the rules after this one
+            // against the new url
+            hits = m.match(u);
+            next = std::upper_bound(
+                hits.begin(), hits.end(), i) - hits.begin();
         }
     }
 
@@ -356,12 +421,13 @@ int main(int argc, char** argv)
             hsit->value().is_array(),
             "handler rules should be an array");
         auto& hs = hsit->value().as_array();
-        for (auto& hv: hs)
+        matcher m;
+        for (std::size_t i = 0; i < hs.size(); ++i)
         {
             CHECK(
-                hv.is_object(),
+                hs[i].is_object(),
                 "individual handlers should be an object");
-            json::object& h = hv.as_object();
+            json::object& h = hs[i].as_object();
 
             auto mit = h.find("match");
             CHECK(
@@ -378,13 +444,16 @@ int main(int argc, char** argv)
             CHECK(
                 hbit->value().is_string(),
                 "browser field is not a string");
+            m.add(mit->value(), i);
+        }
 
-            // Look for match and change browser
-            if (url_match(mit->value(), u))
-            {
-                browser = hbit->value().as_string().subview();
-                break;
-            }
+        // The first matching handler
+        // changes the browser
+        std::vector<std::size_t> hits = m.match(u);
+        if (!hits.empty())
+        {
+            json::object& h = hs[hits.front()].as_object();
+            browser = h.at("browser").as_string().subview();
         }
     }
 
@@ -16,8 +16,11 @@
 
 #include <boost/url/url.hpp>
 #include <boost/url/parse.hpp>
+#include <boost/url/public_suffix_list.hpp>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string>
 
 namespace urls = boost::urls;
 
@@ -41,41 +44,26 @@ int main(int argc, char** argv)
             "public_suffix_list.dat" :
             argv[2];
     std::ifstream fin(filename);
-    if (fin.bad())
+    if (!fin)
     {
         std::cerr << "Cannot open " << filename << "\n";
         return EXIT_FAILURE;
     }
 
-    std::string comment;
-    std::string suffix;
-    std::string line;
-    while (std::getline(fin, line))
-    {
-        boost::core::string_view sv(line);
-        if (sv.starts_with("//") && suffix.empty())
-        {
-            comment.append(sv.substr(3));
-            comment.append("\n");
-        }
-        else if (line.empty())
-        {
-            if (suffix.empty())
-                comment.clear();
-            else
-                break;
-        }
-        else if (u.encoded_host().ends_with(line))
-        {
-            suffix = line;
-        }
-    }
+    // Compile the list once. Programs which
+    // look up many hosts can save psl.data()
+    // to a file and load it without parsing.
+    std::string const text(
+        (std::istreambuf_iterator<char>(fin)),
+        std::istreambuf_iterator<char>());
+    urls::public_suffix_list const psl =
+        urls::public_suffix_list::compile(text);
 
     std::cout <<
-        "url:    \n" << u                << "\n\n"
-        "host:   \n" << u.encoded_host() << "\n\n"
-        "suffix: \n" << suffix           << "\n\n"
-        "detail: \n" << comment          << "\n\n";
+        "url:    \n" << u                           << "\n\n"
+        "host:   \n" << u.encoded_host()            << "\n\n"
+        "suffix: \n" << psl.public_suffix(u)        << "\n\n"
+        "domain: \n" << psl.registrable_domain(u)   << "\n\n";
 
     return EXIT_SUCCESS;
 }
@@ -13,31 +13,46 @@
 #include <boost/url/grammar.hpp>
 
 #include <boost/url/authority_view.hpp>
+#include <boost/url/compiled_format.hpp>
+#include <boost/url/concurrent_router.hpp>
 #include <boost/url/decode.hpp>
 #include <boost/url/decode_view.hpp>
 #include <boost/url/encode.hpp>
 #include <boost/url/encoding_opts.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/error_types.hpp>
+#include <boost/url/filtered_params.hpp>
 #include <boost/url/format.hpp>
 #include <boost/url/host_type.hpp>
 #include <boost/url/ignore_case.hpp>
+#include <boost/url/ip_matcher.hpp>
 #include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv4_network.hpp>
 #include <boost/url/ipv6_address.hpp>
+#include <boost/url/ipv6_network.hpp>
+#include <boost/url/matches.hpp>
 #include <boost/url/optional.hpp>
 #include <boost/url/param.hpp>
 #include <boost/url/params_base.hpp>
+#include <boost/url/params_encoded_array.hpp>
 #include <boost/url/params_encoded_base.hpp>
 #include <boost/url/params_encoded_ref.hpp>
 #include <boost/url/params_encoded_view.hpp>
+#include <boost/url/params_index.hpp>
+#include <boost/url/params_key_set.hpp>
 #include <boost/url/params_ref.hpp>
 #include <boost/url/params_view.hpp>
 #include <boost/url/parse.hpp>
 #include <boost/url/parse_path.hpp>
 #include <boost/url/parse_query.hpp>
 #include <boost/url/pct_string_view.hpp>
+#include <boost/url/prepared_base.hpp>
+#include <boost/url/public_suffix_list.hpp>
+#include <boost/url/router.hpp>
+#include <boost/url/sanitize.hpp>
 #include <boost/url/scheme.hpp>
 #include <boost/url/segments_base.hpp>
+#include <boost/url/segments_encoded_array.hpp>
 #include <boost/url/segments_encoded_base.hpp>
 #include <boost/url/segments_encoded_ref.hpp>
 #include <boost/url/segments_encoded_view.hpp>
@@ -46,8 +61,12 @@
 #include <boost/url/static_url.hpp>
 #include <boost/url/string_view.hpp>
 #include <boost/core/detail/string_view.hpp>
+#include <boost/url/uri_template.hpp>
 #include <boost/url/url.hpp>
 #include <boost/url/url_base.hpp>
+#include <boost/url/url_rule_set.hpp>
+#include <boost/url/url_map.hpp>
+#include <boost/url/url_set.hpp>
 #include <boost/url/url_view.hpp>
 #include <boost/url/url_view_base.hpp>
 #include <boost/url/urls.hpp>
@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_COMPILED_FORMAT_HPP
+#define BOOST_URL_COMPILED_FORMAT_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/format.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/detail/compiled_pattern.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <initializer_list>
+
+namespace boost {
+namespace urls {
+
+/** A format URL string parsed once
+
+    This class holds a format URL string which
+    was split into its URL components when
+    constructed. The literal text of each
+    component is stored already percent-encoded,
+    and each replacement field is stored with
+    its argument id and format spec.
+
+    Formatting arguments with a compiled
+    format gives the same result as calling
+    @ref format with the original string, but
+    the format string is not parsed again:
+    the arguments are measured once, and the
+    URL is written in a single pass.
+
+    @par Example
+    @code
+    compiled_format const fmt( "https://{}/users/{id}/repos?page={page}" );
+
+    url u = fmt.format( "api.example.com", arg( "id", 42 ), arg( "page", 3 ) );
+    assert( u.buffer() == "https://api.example.com/users/42/repos?page=3" );
+    @endcode
+
+    @see
+        @ref format,
+        @ref format_to.
+*/
+class compiled_format
+{
+    detail::compiled_pattern p_;
+
+    BOOST_URL_DECL
+    void
+    vformat_to(
+        url_base& u,
+        detail::format_args args) const;
+
+public:
+    /** Constructor
+
+        This function parses the format URL
+        string `fmt` and stores a copy of it.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        `fmt` contains an invalid format string.
+
+        @param fmt The format URL string.
+    */
+    BOOST_URL_DECL
+    explicit
+    compiled_format(
+        core::string_view fmt);
+
+    /** Return the format URL string
+    */
+    core::string_view
+    str() const noexcept
+    {
+        return p_.fmt;
+    }
+
+    /** Format arguments into a URL
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @return A URL holding the formatted result.
+
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        The result contains an invalid URL after
+        replacements are applied.
+
+        @see
+            @ref format.
+    */
+    template <BOOST_URL_CONSTRAINT(std::convertible_to<format_arg>)... Args>
+    url
+    format(Args&&... args) const
+    {
+        url u;
+        vformat_to(u, detail::make_format_args(
+            std::forward<Args>(args)...));
+        return u;
+    }
+
+    /** Format arguments into a URL
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @return A URL holding the formatted result.
+
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        The result contains an invalid URL after
+        replacements are applied.
+
+        @see
+            @ref format.
+    */
+    url
+    format(std::initializer_list<format_arg> args) const
+    {
+        url u;
+        vformat_to(u, detail::format_args(
+            args.begin(), args.end()));
+        return u;
+    }
+
+    /** Format arguments into a URL
+
+        The result is written into `u`, whose
+        capacity is reused.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param u An object that derives from @ref url_base.
+
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        `u` contains an invalid URL after
+        replacements are applied.
+
+        @see
+            @ref format_to.
+    */
+    template <BOOST_URL_CONSTRAINT(std::convertible_to<format_arg>)... Args>
+    void
+    format_to(
+        url_base& u,
+        Args&&... args) const
+    {
+        vformat_to(u, detail::make_format_args(
+            std::forward<Args>(args)...));
+    }
+
+    /** Format arguments into a URL
+
+        The result is written into `u`, whose
+        capacity is reused.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param u An object that derives from @ref url_base.
+
+        @param args Arguments to be formatted.
+
+        @throws system_error
+        `u` contains an invalid URL after
+        replacements are applied.
+
+        @see
+            @ref format_to.
+    */
+    void
+    format_to(
+        url_base& u,
+        std::initializer_list<format_arg> args) const
+    {
+        vformat_to(u, detail::format_args(
+            args.begin(), args.end()));
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_CONCURRENT_ROUTER_HPP
+#define BOOST_URL_CONCURRENT_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/router.hpp>
+#include <boost/url/detail/concurrent_router.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A URL router which can be updated while it is in use
+
+    This container holds an immutable
+    @ref router which is replaced as a whole.
+    Lookups go through a @ref snapshot, which
+    keeps the version of the routes it was
+    taken from alive until it is destroyed.
+
+    Taking a snapshot is wait-free: it never
+    blocks, no matter what other readers
+    and writers are doing. Replacing the
+    routes publishes the new version with an
+    atomic exchange, then waits until every
+    snapshot of the old version is destroyed
+    before destroying it, like an RCU grace
+    period.
+
+    @par Example
+    @code
+    concurrent_router< handler > cr;
+
+    // any number of threads
+    {
+        auto s = cr.load();
+        matches m;
+        handler const* h = s->find( path, m );
+        if( h )
+            (*h)( m );
+    }
+
+    // reload the routes without
+    // stopping the readers
+    router< handler > r;
+    r.insert( "/user/{name}", user_handler );
+    cr.store( std::move( r ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe.
+
+    A thread must not call @ref store while
+    it holds a snapshot, or it waits for
+    itself forever.
+
+    @tparam T type of resource associated with
+    each path template
+
+    @see
+        @ref router.
+*/
+template <class T>
+class concurrent_router
+    : private detail::concurrent_router_base
+{
+    static
+    router<T> const*
+    make(router<T>&& r);
+
+public:
+    /** A read-only view of one version of the routes
+
+        The version is kept alive until the
+        snapshot is destroyed. Snapshots should
+        be short-lived, because they delay the
+        writers which replace the routes.
+
+        The snapshot must not outlive the
+        @ref concurrent_router it was taken
+        from.
+    */
+    class snapshot
+    {
+        friend class concurrent_router;
+
+        concurrent_router const* cr_ = nullptr;
+        router<T> const* r_ = nullptr;
+        std::size_t idx_ = 0;
+
+        snapshot(
+            concurrent_router const& cr) noexcept;
+
+    public:
+        snapshot(snapshot const&) = delete;
+        snapshot& operator=(snapshot const&) = delete;
+
+        /// Constructor
+        snapshot(snapshot&& other) noexcept;
+
+        /// Destructor
+        ~snapshot();
+
+        /// Return the routes
+        router<T> const&
+        operator*() const noexcept
+        {
+            return *r_;
+        }
+
+        /// Return the routes
+        router<T> const*
+        operator->() const noexcept
+        {
+            return r_;
+        }
+    };
+
+    /** Constructor
+
+        Default constructed routers
+        have no routes.
+    */
+    concurrent_router();
+
+    /** Constructor
+
+        The router is frozen before it is
+        published.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param r The routes
+    */
+    explicit
+    concurrent_router(router<T>&& r);
+
+    concurrent_router(
+        concurrent_router const&) = delete;
+    concurrent_router& operator=(
+        concurrent_router const&) = delete;
+
+    /** Destructor
+
+        @par Preconditions
+        No snapshot of this router exists.
+    */
+    ~concurrent_router();
+
+    /** Return a snapshot of the current routes
+
+        @par Complexity
+        Constant. This function is wait-free.
+    */
+    snapshot
+    load() const noexcept
+    {
+        return snapshot(*this);
+    }
+
+    /** Replace the routes
+
+        The new routes are frozen and published
+        with an atomic exchange. The function
+        then waits until every snapshot of the
+        previous routes is destroyed, and
+        destroys them.
+
+        Concurrent calls are serialized.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param r The new routes
+    */
+    void
+    store(router<T>&& r);
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/concurrent_router.hpp>
+
+#endif
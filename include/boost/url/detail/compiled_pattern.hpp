@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_COMPILED_PATTERN_HPP
+#define BOOST_URL_DETAIL_COMPILED_PATTERN_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/format_args.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class url_base;
+
+namespace detail {
+
+/* A format string split into its URL components once.
+
+   Each component is a sequence of pieces,
+   which are either literals already encoded
+   with the charset of the component, or
+   replacement fields with their argument id
+   and the position of their format spec.
+ */
+struct compiled_pattern : parts_base
+{
+    enum class kind : unsigned char
+    {
+        literal,
+        // {} or {:spec}
+        next,
+        // {0} or {0:spec}
+        index,
+        // {name} or {name:spec}
+        name
+    };
+
+    struct piece
+    {
+        kind k = kind::literal;
+
+        // literal: [pos, pos + n) in lits
+        // field: the spec starts at fmt[pos]
+        // and a name is fmt[name, name + n)
+        std::size_t pos = 0;
+        std::size_t n = 0;
+        std::size_t name = 0;
+
+        // argument index for kind::index
+        std::size_t id = 0;
+    };
+
+    std::string fmt;
+    std::string lits;
+    std::vector<piece> pieces;
+
+    // the pieces of the component `id` are
+    // [first[id + 1], first[id + 2])
+    std::size_t first[id_end + 2] = {};
+
+    bool has_scheme = false;
+    bool has_authority = false;
+    bool has_user = false;
+    bool has_pass = false;
+    bool ip_literal = false;
+    bool has_port = false;
+    bool has_path = false;
+    bool has_query = false;
+    bool has_frag = false;
+};
+
+BOOST_URL_DECL
+void
+compile_pattern(
+    compiled_pattern& cp,
+    core::string_view fmt);
+
+BOOST_URL_DECL
+void
+apply_compiled(
+    url_base& u,
+    compiled_pattern const& cp,
+    format_args const& args);
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_CONCURRENT_ROUTER_HPP
+#define BOOST_URL_DETAIL_CONCURRENT_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A pointer to an immutable object which is
+// published with an atomic exchange.
+//
+// Readers announce themselves in one of two
+// counters, selected by the parity of the
+// version, before loading the pointer. The
+// writer publishes the new pointer, drains
+// the counter new readers are about to use,
+// flips the version and drains the other
+// counter. After that, no reader can hold
+// the old pointer, which is returned to the
+// writer to be destroyed.
+class concurrent_router_base
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::atomic<void const*> p_;
+    std::atomic<std::size_t> version_{0};
+    mutable std::atomic<std::size_t> readers_[2];
+    std::mutex m_;
+#else
+    void const* p_;
+#endif
+
+protected:
+    BOOST_URL_DECL
+    explicit
+    concurrent_router_base(
+        void const* p) noexcept;
+
+    concurrent_router_base(
+        concurrent_router_base const&) = delete;
+    concurrent_router_base& operator=(
+        concurrent_router_base const&) = delete;
+
+    // enter a read-side critical section
+    // and return the current pointer
+    BOOST_URL_DECL
+    void const*
+    lock(std::size_t& idx) const noexcept;
+
+    // leave a read-side critical section
+    BOOST_URL_DECL
+    void
+    unlock(std::size_t idx) const noexcept;
+
+    // publish p and return the previous
+    // pointer once no reader can hold it
+    BOOST_URL_DECL
+    void const*
+    exchange(void const* p) noexcept;
+
+    // the current pointer, when there
+    // are no concurrent writers
+    BOOST_URL_DECL
+    void const*
+    get() const noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
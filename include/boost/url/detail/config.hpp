@@ -181,6 +181,13 @@
 #define BOOST_URL_HAS_CONCEPTS
 #endif
 
+// Compile-time checked format strings need
+// consteval and class type template arguments
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L && \
+    defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+#define BOOST_URL_HAS_FORMAT_STRING
+#endif
+
 #ifdef  BOOST_URL_HAS_CONCEPTS
 #define BOOST_URL_CONSTRAINT(C) C
 #else
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_DIGEST_SINK_HPP
+#define BOOST_URL_DETAIL_DIGEST_SINK_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Collects the bytes of a normalized URL,
+// which are produced one at a time, and
+// hands them to a hash algorithm in blocks.
+// The algorithm is called as h(p, n) and
+// is erased so the compiled normalization
+// functions work with any of them.
+class digest_sink
+{
+public:
+    template<class HashAlgorithm>
+    explicit
+    digest_sink(HashAlgorithm& h) noexcept
+        : h_(&h)
+        , fn_(&invoke<HashAlgorithm>)
+    {
+    }
+
+    digest_sink(digest_sink const&) = delete;
+    digest_sink& operator=(digest_sink const&) = delete;
+
+    ~digest_sink()
+    {
+        flush();
+    }
+
+    void
+    put(char c) noexcept
+    {
+        if(n_ == sizeof(buf_))
+            flush();
+        buf_[n_++] = c;
+    }
+
+    void
+    put(core::string_view s) noexcept
+    {
+        for(char c : s)
+            put(c);
+    }
+
+    // Pass the buffered bytes to the algorithm
+    void
+    flush() noexcept
+    {
+        if(n_ == 0)
+            return;
+        fn_(h_, buf_, n_);
+        n_ = 0;
+    }
+
+private:
+    template<class HashAlgorithm>
+    static
+    void
+    invoke(
+        void* h,
+        char const* p,
+        std::size_t n) noexcept
+    {
+        (*static_cast<HashAlgorithm*>(h))(
+            static_cast<void const*>(p), n);
+    }
+
+    void* h_;
+    void (*fn_)(void*, char const*, std::size_t);
+    char buf_[64];
+    std::size_t n_ = 0;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -41,6 +41,11 @@ throw_length_error(
     source_location const& loc =
         BOOST_URL_POS);
 
+BOOST_URL_DECL void BOOST_NORETURN
+throw_out_of_range(
+    source_location const& loc =
+        BOOST_URL_POS);
+
 } // detail
 } // urls
 } // boost
@@ -97,6 +97,12 @@ struct named_arg
     {}
 };
 
+template <class T>
+struct is_named_arg : std::false_type {};
+
+template <class T>
+struct is_named_arg<named_arg<T>> : std::true_type {};
+
 // A type erased format argument
 class format_arg
 {
@@ -12,6 +12,10 @@
 
 namespace boost {
 namespace urls {
+
+class ipv4_address;
+class ipv6_address;
+
 namespace detail {
 
 template<
@@ -412,6 +416,172 @@ public:
     }
 };
 
+// formatter for a single floating point
+// number, which is written in the shortest
+// form that round-trips by default
+class float_formatter_impl
+{
+    char fill = ' ';
+    char align = '\0';
+    char sign = '-';
+    bool zeros = false;
+    char type = '\0';
+    int precision = -1;
+    std::size_t width = 0;
+    std::size_t width_idx = std::size_t(-1);
+    core::string_view width_name;
+
+    template <class T>
+    std::size_t
+    measure_impl(
+        T v,
+        measure_context& ctx,
+        grammar::lut_chars const& cs) const;
+
+    template <class T>
+    char*
+    format_impl(
+        T v,
+        format_context& ctx,
+        grammar::lut_chars const& cs) const;
+
+public:
+    // enough for any double with
+    // the largest precision
+    static constexpr int max_precision = 99;
+    static constexpr std::size_t max_size = 512;
+
+    BOOST_URL_DECL
+    char const*
+    parse(format_parse_context& ctx);
+
+    BOOST_URL_DECL
+    std::size_t
+    measure(
+        float v,
+        measure_context& ctx,
+        grammar::lut_chars const& cs) const;
+
+    BOOST_URL_DECL
+    std::size_t
+    measure(
+        double v,
+        measure_context& ctx,
+        grammar::lut_chars const& cs) const;
+
+    BOOST_URL_DECL
+    char*
+    format(
+        float v,
+        format_context& ctx,
+        grammar::lut_chars const& cs) const;
+
+    BOOST_URL_DECL
+    char*
+    format(
+        double v,
+        format_context& ctx,
+        grammar::lut_chars const& cs) const;
+};
+
+template <class T>
+struct formatter<
+    T, typename std::enable_if<
+        mp11::mp_contains<mp11::mp_list<
+            float,
+            double,
+            long double>, T>::value>::type>
+{
+private:
+    // long double is written with
+    // the precision of a double
+    using value_type = typename std::conditional<
+        std::is_same<T, float>::value,
+        float, double>::type;
+
+    float_formatter_impl impl_;
+
+public:
+    char const*
+    parse(format_parse_context& ctx)
+    {
+        return impl_.parse(ctx);
+    }
+
+    std::size_t
+    measure(
+        T v,
+        measure_context& ctx,
+        grammar::lut_chars const& cs) const
+    {
+        return impl_.measure(
+            static_cast<value_type>(v), ctx, cs);
+    }
+
+    char*
+    format(T v, format_context& ctx, grammar::lut_chars const& cs) const
+    {
+        return impl_.format(
+            static_cast<value_type>(v), ctx, cs);
+    }
+};
+
+// formatters for ip addresses, which are
+// written to a buffer on the stack
+template <>
+struct formatter<ipv4_address>
+{
+    formatter<core::string_view> impl_;
+
+public:
+    char const*
+    parse(format_parse_context& ctx)
+    {
+        return impl_.parse(ctx);
+    }
+
+    BOOST_URL_DECL
+    std::size_t
+    measure(
+        ipv4_address const& a,
+        measure_context& ctx,
+        grammar::lut_chars const& cs) const;
+
+    BOOST_URL_DECL
+    char*
+    format(
+        ipv4_address const& a,
+        format_context& ctx,
+        grammar::lut_chars const& cs) const;
+};
+
+template <>
+struct formatter<ipv6_address>
+{
+    formatter<core::string_view> impl_;
+
+public:
+    char const*
+    parse(format_parse_context& ctx)
+    {
+        return impl_.parse(ctx);
+    }
+
+    BOOST_URL_DECL
+    std::size_t
+    measure(
+        ipv6_address const& a,
+        measure_context& ctx,
+        grammar::lut_chars const& cs) const;
+
+    BOOST_URL_DECL
+    char*
+    format(
+        ipv6_address const& a,
+        format_context& ctx,
+        grammar::lut_chars const& cs) const;
+};
+
 } // detail
 } // url
 } // boost
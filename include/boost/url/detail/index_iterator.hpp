@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_INDEX_ITERATOR_HPP
+#define BOOST_URL_DETAIL_INDEX_ITERATOR_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A random access iterator over a
+// container which provides operator[]
+// returning elements by value.
+template<class Container, class Reference>
+class index_iterator
+{
+    Container const* c_ = nullptr;
+    std::size_t i_ = 0;
+
+public:
+    using value_type = Reference;
+    using reference = Reference;
+    using pointer = Reference;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    index_iterator() = default;
+
+    index_iterator(
+        Container const& c,
+        std::size_t i) noexcept
+        : c_(&c)
+        , i_(i)
+    {
+    }
+
+    std::size_t
+    index() const noexcept
+    {
+        return i_;
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        return (*c_)[i_];
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+        return (*c_)[i_];
+    }
+
+    reference
+    operator[](
+        difference_type n) const noexcept
+    {
+        return (*c_)[i_ + n];
+    }
+
+    index_iterator&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    index_iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++i_;
+        return tmp;
+    }
+
+    index_iterator&
+    operator--() noexcept
+    {
+        BOOST_ASSERT(i_ > 0);
+        --i_;
+        return *this;
+    }
+
+    index_iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    index_iterator&
+    operator+=(
+        difference_type n) noexcept
+    {
+        i_ += n;
+        return *this;
+    }
+
+    index_iterator&
+    operator-=(
+        difference_type n) noexcept
+    {
+        i_ -= n;
+        return *this;
+    }
+
+    friend
+    index_iterator
+    operator+(
+        index_iterator it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    index_iterator
+    operator+(
+        difference_type n,
+        index_iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    index_iterator
+    operator-(
+        index_iterator it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        index_iterator const& a,
+        index_iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.c_ == b.c_);
+        return static_cast<difference_type>(a.i_) -
+            static_cast<difference_type>(b.i_);
+    }
+
+    friend
+    bool
+    operator==(
+        index_iterator const& a,
+        index_iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.c_ == b.c_);
+        return a.i_ == b.i_;
+    }
+
+    friend
+    bool
+    operator!=(
+        index_iterator const& a,
+        index_iterator const& b) noexcept
+    {
+        return ! (a == b);
+    }
+
+    friend
+    bool
+    operator<(
+        index_iterator const& a,
+        index_iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.c_ == b.c_);
+        return a.i_ < b.i_;
+    }
+
+    friend
+    bool
+    operator>(
+        index_iterator const& a,
+        index_iterator const& b) noexcept
+    {
+        return b < a;
+    }
+
+    friend
+    bool
+    operator<=(
+        index_iterator const& a,
+        index_iterator const& b) noexcept
+    {
+        return ! (b < a);
+    }
+
+    friend
+    bool
+    operator>=(
+        index_iterator const& a,
+        index_iterator const& b) noexcept
+    {
+        return ! (a < b);
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
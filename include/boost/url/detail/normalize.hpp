@@ -13,7 +13,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/core/detail/string_view.hpp>
-#include <boost/url/detail/fnv_1a.hpp>
+#include <boost/url/detail/digest_sink.hpp>
 #include <boost/url/segments_encoded_view.hpp>
 
 namespace boost {
@@ -56,12 +56,12 @@ BOOST_URL_DECL
 void
 digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 void
 digest(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 // check if core::string_view lhs starts with core::string_view
 // rhs as if they are both percent-decoded. If
@@ -95,7 +95,7 @@ BOOST_URL_DECL
 void
 ci_digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 // compare two ascii core::string_views
 BOOST_URL_DECL
@@ -117,7 +117,7 @@ BOOST_URL_DECL
 void
 ci_digest(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 BOOST_URL_DECL
 std::size_t
@@ -126,6 +126,20 @@ remove_dot_segments(
     char const* end,
     core::string_view input) noexcept;
 
+// Resume remove_dot_segments on an absolute
+// `input` when [dest0, dest) already holds
+// the output of a prefix path without dot
+// segments and without its trailing slash.
+// `input` may alias the output buffer
+// at or after `dest`.
+BOOST_URL_DECL
+std::size_t
+remove_dot_segments(
+    char* dest0,
+    char* dest,
+    char const* end,
+    core::string_view input) noexcept;
+
 void
 pop_last_segment(
     core::string_view& str,
@@ -141,7 +155,7 @@ void
 normalized_path_digest(
     core::string_view str,
     bool remove_unmatched,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 BOOST_URL_DECL
 int
@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_PRED_BITS_HPP
+#define BOOST_URL_DETAIL_PRED_BITS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/*  The results of a predicate, one bit per element
+
+    The predicate is applied to every element
+    before the url is modified, so that an
+    exception thrown by it leaves the url
+    unchanged. Up to 256 results are stored
+    in place, without allocating.
+*/
+class pred_bits
+{
+    std::uint64_t small_[4] = {};
+    std::vector<std::uint64_t> big_;
+    std::uint64_t* p_ = small_;
+
+public:
+    explicit
+    pred_bits(std::size_t n)
+    {
+        if(n > 256)
+        {
+            big_.resize((n + 63) / 64);
+            p_ = big_.data();
+        }
+    }
+
+    pred_bits(pred_bits const&) = delete;
+    pred_bits& operator=(pred_bits const&) = delete;
+
+    void
+    set(std::size_t i) noexcept
+    {
+        p_[i / 64] |= std::uint64_t(1) << (i % 64);
+    }
+
+    bool
+    test(std::size_t i) const noexcept
+    {
+        return (p_[i / 64] >> (i % 64)) & 1;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
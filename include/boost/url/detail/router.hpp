@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_ROUTER_HPP
+#define BOOST_URL_DETAIL_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A type-erased rule which constrains
+// a replacement field
+struct route_rule
+{
+    virtual ~route_rule() = default;
+
+    // return true if the encoded
+    // segment matches the rule
+    virtual
+    bool
+    match(core::string_view s) const noexcept = 0;
+};
+
+template<class Rule>
+struct route_rule_impl : route_rule
+{
+    Rule r;
+
+    explicit
+    route_rule_impl(Rule const& r_)
+        : r(r_)
+    {
+    }
+
+    bool
+    match(core::string_view s) const noexcept override
+    {
+        return grammar::parse(s, r).has_value();
+    }
+};
+
+// The type-erased routing table. The routes
+// are inserted into a tree, which is frozen
+// into a flat trie by the first lookup after
+// an insertion. Resources are referred to by
+// their index in the array of the router.
+class router_base
+{
+    struct impl;
+    impl* impl_ = nullptr;
+
+protected:
+    static constexpr std::size_t npos =
+        std::size_t(-1);
+
+    BOOST_URL_DECL
+    router_base();
+
+    BOOST_URL_DECL
+    ~router_base();
+
+    router_base(router_base const&) = delete;
+    router_base& operator=(router_base const&) = delete;
+
+    BOOST_URL_DECL
+    router_base(router_base&& other) noexcept;
+
+    BOOST_URL_DECL
+    router_base&
+    operator=(router_base&& other) noexcept;
+
+    // insert a route and return the index of
+    // its resource, which is `n` unless the
+    // route already exists
+    BOOST_URL_DECL
+    std::size_t
+    insert_impl(
+        core::string_view pattern,
+        std::size_t n);
+
+    // add a rule which constrains the
+    // replacement fields named after it
+    BOOST_URL_DECL
+    void
+    add_rule_impl(
+        core::string_view name,
+        std::unique_ptr<route_rule> r);
+
+    // freeze the routes into the flat trie
+    BOOST_URL_DECL
+    void
+    freeze_impl();
+
+    // return the index of the resource and
+    // the number of matches, or npos
+    BOOST_URL_DECL
+    std::size_t
+    find_impl(
+        segments_encoded_view path,
+        core::string_view* matches,
+        core::string_view* ids,
+        std::uint64_t* values,
+        std::size_t capacity,
+        std::size_t& n) const;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
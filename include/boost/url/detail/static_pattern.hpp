@@ -0,0 +1,542 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_STATIC_PATTERN_HPP
+#define BOOST_URL_DETAIL_STATIC_PATTERN_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/grammar/alnum_chars.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/vchars.hpp>
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/url/rfc/detail/charsets.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+/* The component boundaries of a format string.
+
+   This is the result of parsing a format
+   string with the same rules as
+   `parse_pattern`, but the parser is
+   `constexpr`, so that format strings can
+   be validated and split at compile time.
+
+   The component `id` is the range
+   [first[id + 1], last[id + 1]) of the
+   format string. A host which is an IP
+   literal includes its brackets.
+ */
+struct static_pattern
+{
+    std::size_t first[parts_base::id_end + 1] = {};
+    std::size_t last[parts_base::id_end + 1] = {};
+
+    bool has_authority = false;
+    bool has_user = false;
+    bool has_pass = false;
+    bool has_port = false;
+    bool has_query = false;
+    bool has_frag = false;
+
+    // number of positional arguments
+    // the replacement fields refer to
+    std::size_t nargs = 0;
+
+    // a replacement field refers to
+    // an argument by name
+    bool named = false;
+};
+
+class static_pattern_parser
+{
+    char const* s_;
+    std::size_t n_;
+    std::size_t i_ = 0;
+    std::size_t next_ = 0;
+    char const* err_ = nullptr;
+
+    struct state
+    {
+        std::size_t i;
+        std::size_t next;
+        std::size_t nargs;
+        bool named;
+    };
+
+    constexpr
+    state
+    save() const noexcept
+    {
+        return { i_, next_, p.nargs, p.named };
+    }
+
+    constexpr
+    void
+    restore(state const& st) noexcept
+    {
+        i_ = st.i;
+        next_ = st.next;
+        p.nargs = st.nargs;
+        p.named = st.named;
+    }
+
+    constexpr
+    bool
+    fail(char const* msg) noexcept
+    {
+        if(! err_)
+            err_ = msg;
+        return false;
+    }
+
+    constexpr
+    bool
+    at(char c) const noexcept
+    {
+        return i_ < n_ && s_[i_] == c;
+    }
+
+    constexpr
+    void
+    use(std::size_t id) noexcept
+    {
+        if(p.nargs < id + 1)
+            p.nargs = id + 1;
+    }
+
+    // arg_id ::= integer | identifier
+    // returns 0 for no id, 1 for an
+    // integer in `id`, 2 for a name
+    constexpr
+    int
+    arg_id(std::size_t& id) noexcept
+    {
+        if(i_ == n_)
+            return 0;
+        char c = s_[i_];
+        if( grammar::alpha_chars(c) ||
+            c == '_')
+        {
+            ++i_;
+            while( i_ < n_ && (
+                grammar::alnum_chars(s_[i_]) ||
+                s_[i_] == '_'))
+                ++i_;
+            return 2;
+        }
+        if(! grammar::digit_chars(c))
+            return 0;
+        id = 0;
+        if(c == '0')
+        {
+            ++i_;
+            if( i_ < n_ &&
+                grammar::digit_chars(s_[i_]))
+                return -1;
+            return 1;
+        }
+        while( i_ < n_ &&
+            grammar::digit_chars(s_[i_]))
+        {
+            // far more arguments than
+            // any call can have
+            if(id > 9999)
+                return -1;
+            id = id * 10 + (s_[i_] - '0');
+            ++i_;
+        }
+        return 1;
+    }
+
+    // format_spec ::= (chars | "{" [arg_id] "}")*
+    // up to the closing "}" of the field
+    constexpr
+    bool
+    format_spec() noexcept
+    {
+        constexpr auto spec_chars =
+            grammar::vchars +
+            grammar::lut_chars(' ') - "{}";
+
+        // the formatters only read a
+        // dynamic width after an alignment
+        bool align = false;
+        if( i_ + 1 < n_ &&
+            s_[i_] != '{' &&
+            s_[i_] != '}' && (
+                s_[i_ + 1] == '<' ||
+                s_[i_ + 1] == '>' ||
+                s_[i_ + 1] == '^'))
+            align = true;
+        else if( at('<') || at('>') || at('^'))
+            align = true;
+
+        for(;;)
+        {
+            while( i_ < n_ &&
+                spec_chars(s_[i_]))
+                ++i_;
+            if(! at('{'))
+                break;
+            ++i_;
+            std::size_t id = 0;
+            int const k = arg_id(id);
+            if( k < 0 ||
+                ! at('}'))
+                return fail("invalid format spec");
+            ++i_;
+            if(! align)
+                continue;
+            if(k == 0)
+                use(next_++);
+            else if(k == 1)
+                use(id);
+            else
+                p.named = true;
+        }
+        return true;
+    }
+
+    // replacement_field ::= "{" [arg_id] [":" format_spec] "}"
+    constexpr
+    bool
+    replacement_field() noexcept
+    {
+        if(! at('{'))
+            return false;
+        ++i_;
+        std::size_t id = 0;
+        int const k = arg_id(id);
+        if(k < 0)
+            return fail("invalid argument id");
+        if(k == 0)
+            use(next_++);
+        else if(k == 1)
+            use(id);
+        else
+            p.named = true;
+        if(at(':'))
+        {
+            ++i_;
+            if(! format_spec())
+                return false;
+        }
+        if(! at('}'))
+            return fail("invalid replacement field");
+        ++i_;
+        return true;
+    }
+
+    // literal chars from `cs` and valid escapes
+    template<class CharSet>
+    constexpr
+    bool
+    pct_literal(CharSet const& cs) noexcept
+    {
+        while(i_ < n_)
+        {
+            char const c = s_[i_];
+            if(cs(c))
+            {
+                ++i_;
+                continue;
+            }
+            if(c != '%')
+                break;
+            if( n_ - i_ < 3 ||
+                ! grammar::hexdig_chars(s_[i_ + 1]) ||
+                ! grammar::hexdig_chars(s_[i_ + 2]))
+                return fail("invalid percent-encoding");
+            i_ += 3;
+        }
+        return true;
+    }
+
+    // (literal | replacement_field)*
+    template<class CharSet>
+    constexpr
+    bool
+    fmt_string(CharSet const& cs) noexcept
+    {
+        for(;;)
+        {
+            if(! pct_literal(cs))
+                return false;
+            if(! at('{'))
+                return true;
+            if(! replacement_field())
+                return false;
+        }
+    }
+
+    constexpr
+    void
+    set(int id, std::size_t first) noexcept
+    {
+        p.first[id + 1] = first;
+        p.last[id + 1] = i_;
+    }
+
+    // scheme ":"
+    constexpr
+    bool
+    scheme() noexcept
+    {
+        constexpr grammar::lut_chars scheme_chars(
+            "0123456789" "+-."
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            "abcdefghijklmnopqrstuvwxyz");
+        std::size_t const start = i_;
+        if(i_ == n_)
+            return false;
+        if(at('{'))
+        {
+            if(! replacement_field())
+                return false;
+        }
+        else if(grammar::alpha_chars(s_[i_]))
+        {
+            ++i_;
+        }
+        else
+        {
+            return false;
+        }
+        for(;;)
+        {
+            while( i_ < n_ &&
+                scheme_chars(s_[i_]))
+                ++i_;
+            if(! at('{'))
+                break;
+            if(! replacement_field())
+                return false;
+        }
+        if(! at(':'))
+            return false;
+        set(parts_base::id_scheme, start);
+        ++i_;
+        return true;
+    }
+
+    // [ userinfo "@" ] host [ ":" port ]
+    constexpr
+    bool
+    authority() noexcept
+    {
+        // [ userinfo "@" ]
+        {
+            auto const st = save();
+            std::size_t const start = i_;
+            if(! fmt_string(user_chars))
+                return false;
+            std::size_t const user_end = i_;
+            bool has_pass = false;
+            std::size_t pass_start = 0;
+            if(at(':'))
+            {
+                ++i_;
+                has_pass = true;
+                pass_start = i_;
+                if(! fmt_string(password_chars))
+                    return false;
+            }
+            if(at('@'))
+            {
+                p.has_user = true;
+                p.first[parts_base::id_user + 1] = start;
+                p.last[parts_base::id_user + 1] = user_end;
+                if(has_pass)
+                {
+                    p.has_pass = true;
+                    set(parts_base::id_pass, pass_start);
+                }
+                ++i_;
+            }
+            else
+            {
+                restore(st);
+            }
+        }
+
+        // host
+        {
+            std::size_t const start = i_;
+            if(! at('['))
+            {
+                if(! fmt_string(host_chars))
+                    return false;
+            }
+            else
+            {
+                auto const st = save();
+                ++i_;
+                if(! fmt_string(host_chars + ':'))
+                    return false;
+                if(at(']'))
+                    ++i_;
+                else
+                    restore(st);
+            }
+            set(parts_base::id_host, start);
+        }
+
+        // [ ":" port ]
+        if(at(':'))
+        {
+            ++i_;
+            p.has_port = true;
+            std::size_t const start = i_;
+            for(;;)
+            {
+                while( i_ < n_ &&
+                    grammar::digit_chars(s_[i_]))
+                    ++i_;
+                if(! at('{'))
+                    break;
+                if(! replacement_field())
+                    return false;
+            }
+            set(parts_base::id_port, start);
+        }
+        return true;
+    }
+
+    constexpr
+    bool
+    parse_impl() noexcept
+    {
+        // [ scheme ":" ]
+        {
+            auto const st = save();
+            if(! scheme())
+            {
+                if(err_)
+                    return false;
+                restore(st);
+            }
+        }
+        if(i_ == n_)
+            return true;
+
+        if(n_ - i_ == 1)
+        {
+            char const c = s_[i_];
+            std::size_t const start = i_;
+            if(c == '/')
+            {
+                ++i_;
+                set(parts_base::id_path, start);
+                return true;
+            }
+            bool const has_scheme =
+                p.last[0] != p.first[0];
+            if(! has_scheme && c == ':')
+                return false;
+            if(! pchars(c))
+                return false;
+            ++i_;
+            set(parts_base::id_path, start);
+            return true;
+        }
+
+        // "//" authority
+        if( s_[i_] == '/' &&
+            s_[i_ + 1] == '/')
+        {
+            i_ += 2;
+            p.has_authority = true;
+            if(! authority())
+                return false;
+        }
+
+        if( i_ == n_ || (
+            p.has_authority &&
+            ! at('/') &&
+            ! at('?') &&
+            ! at('#')))
+            return true;
+
+        // path
+        {
+            std::size_t const start = i_;
+            if(! fmt_string(path_chars))
+                return false;
+            set(parts_base::id_path, start);
+        }
+
+        // [ "?" query ]
+        if(at('?'))
+        {
+            ++i_;
+            p.has_query = true;
+            std::size_t const start = i_;
+            if(! fmt_string(query_chars))
+                return false;
+            set(parts_base::id_query, start);
+        }
+
+        // [ "#" fragment ]
+        if(at('#'))
+        {
+            ++i_;
+            p.has_frag = true;
+            std::size_t const start = i_;
+            if(! fmt_string(fragment_chars))
+                return false;
+            set(parts_base::id_frag, start);
+        }
+        return true;
+    }
+
+public:
+    static_pattern p;
+
+    constexpr
+    static_pattern_parser(
+        char const* s,
+        std::size_t n) noexcept
+        : s_(s)
+        , n_(n)
+    {
+    }
+
+    /* Parse the format string
+
+       Returns nullptr on success, or
+       a description of the error.
+     */
+    constexpr
+    char const*
+    parse() noexcept
+    {
+        if(! parse_impl())
+        {
+            if(! err_)
+                err_ = "invalid format string";
+            return err_;
+        }
+        if(i_ != n_)
+            return "invalid format string";
+        return nullptr;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_URL_TABLE_HPP
+#define BOOST_URL_DETAIL_URL_TABLE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A hash table of urls keyed by normalized
+// equivalence. The text of every key is
+// appended to a single arena, and entries
+// are numbered in insertion order. This is
+// the shared implementation of url_set and
+// url_map.
+class url_table
+{
+public:
+    explicit
+    url_table(
+        std::size_t seed = 0) noexcept
+        : seed_(seed)
+    {
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    std::size_t
+    capacity() const noexcept
+    {
+        return tab_.size() / 2;
+    }
+
+    // Returns the index of the entry
+    // equivalent to u, or size()
+    BOOST_URL_DECL
+    std::size_t
+    find(url_view_base const& u) const noexcept;
+
+    // As above, parsing s as a URI-reference.
+    // Returns size() if s is not valid.
+    BOOST_URL_DECL
+    std::size_t
+    find(core::string_view s) const noexcept;
+
+    // Returns the index of the entry
+    // equivalent to u and true if u
+    // was inserted
+    BOOST_URL_DECL
+    std::pair<std::size_t, bool>
+    insert(url_view_base const& u);
+
+    // Removes the last inserted entry
+    BOOST_URL_DECL
+    void
+    pop_back() noexcept;
+
+    BOOST_URL_DECL
+    url_view
+    get(std::size_t i) const noexcept;
+
+    url_view
+    operator[](std::size_t i) const noexcept
+    {
+        return get(i);
+    }
+
+    BOOST_URL_DECL
+    void
+    reserve(
+        std::size_t n,
+        std::size_t bytes = 0);
+
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+private:
+    struct entry
+    {
+        std::size_t hash;
+        std::size_t pos;
+        std::size_t n;
+    };
+
+    std::size_t
+    digest(url_view_base const& u) const noexcept;
+
+    std::size_t
+    find_impl(
+        url_view_base const& u,
+        std::size_t hash) const noexcept;
+
+    void
+    rehash(std::size_t cap);
+
+    std::size_t seed_;
+    std::string arena_;
+    std::vector<entry> v_;
+    // one plus the index of each
+    // entry, or zero if empty
+    std::vector<std::size_t> tab_;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
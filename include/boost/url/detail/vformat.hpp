@@ -11,6 +11,7 @@
 #define BOOST_URL_DETAIL_FORMAT_HPP
 
 #include <boost/url/detail/format_args.hpp>
+#include <boost/url/detail/static_pattern.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <boost/url/url.hpp>
 
@@ -25,6 +26,16 @@ vformat_to(
     core::string_view fmt,
     format_args args);
 
+// Applies a format string whose components
+// were already found by static_pattern_parser
+BOOST_URL_DECL
+void
+vformat_to(
+    url_base& u,
+    core::string_view fmt,
+    static_pattern const& sp,
+    format_args args);
+
 inline
 url
 vformat(
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_WYHASH_HPP
+#define BOOST_URL_DETAIL_WYHASH_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A seeded 64-bit streaming hash built on
+// the multiply-and-fold mixing of wyhash.
+// Input is consumed in 16 byte blocks; the
+// result only depends on the seed and the
+// concatenation of the bytes fed to it, not
+// on how the input was split across calls.
+class wyhash
+{
+public:
+    using digest_type = std::uint64_t;
+
+    static constexpr std::uint64_t p0 = 0xa0761d6478bd642fULL;
+    static constexpr std::uint64_t p1 = 0xe7037ed1a0b428dbULL;
+    static constexpr std::uint64_t p2 = 0x8ebc6af09c88c6e3ULL;
+    static constexpr std::uint64_t p3 = 0x589965cc75374cc3ULL;
+
+    explicit
+    wyhash(std::uint64_t seed) noexcept
+        : h_(seed ^ mix(seed ^ p0, p1))
+    {
+    }
+
+    void
+    operator()(
+        void const* data,
+        std::size_t n) noexcept
+    {
+        auto p = static_cast<
+            unsigned char const*>(data);
+        len_ += n;
+        if(n_ != 0)
+        {
+            std::size_t const k =
+                n < 16 - n_ ? n : 16 - n_;
+            std::memcpy(buf_ + n_, p, k);
+            n_ += k;
+            p += k;
+            n -= k;
+            if(n_ < 16)
+                return;
+            block(buf_);
+            n_ = 0;
+        }
+        while(n >= 16)
+        {
+            block(p);
+            p += 16;
+            n -= 16;
+        }
+        if(n != 0)
+        {
+            std::memcpy(buf_, p, n);
+            n_ = n;
+        }
+    }
+
+    digest_type
+    digest() const noexcept
+    {
+        unsigned char tail[16] = {};
+        std::memcpy(tail, buf_, n_);
+        std::uint64_t const h = mix(
+            read64(tail) ^ p1,
+            read64(tail + 8) ^ h_);
+        return mix(h ^ p2, len_ ^ p3);
+    }
+
+private:
+    static
+    std::uint64_t
+    read64(unsigned char const* p) noexcept
+    {
+        std::uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    // 64x64 -> 128 bit multiply, folded
+    static
+    std::uint64_t
+    mix(
+        std::uint64_t a,
+        std::uint64_t b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 u128;
+        u128 const r = static_cast<u128>(a) * b;
+        return static_cast<std::uint64_t>(r) ^
+            static_cast<std::uint64_t>(r >> 64);
+#else
+        std::uint64_t const ha = a >> 32;
+        std::uint64_t const hb = b >> 32;
+        std::uint64_t const la = a & 0xffffffffULL;
+        std::uint64_t const lb = b & 0xffffffffULL;
+        std::uint64_t const rh = ha * hb;
+        std::uint64_t const rm0 = ha * lb;
+        std::uint64_t const rm1 = hb * la;
+        std::uint64_t const rl = la * lb;
+        std::uint64_t const t = rl + (rm0 << 32);
+        std::uint64_t const lo = t + (rm1 << 32);
+        std::uint64_t const hi = rh + (rm0 >> 32) + (rm1 >> 32) +
+            (t < rl) + (lo < t);
+        return lo ^ hi;
+#endif
+    }
+
+    void
+    block(unsigned char const* p) noexcept
+    {
+        h_ = mix(
+            read64(p) ^ p1,
+            read64(p + 8) ^ h_);
+    }
+
+    std::uint64_t h_;
+    std::uint64_t len_ = 0;
+    unsigned char buf_[16];
+    std::size_t n_ = 0;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,507 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_FILTERED_PARAMS_HPP
+#define BOOST_URL_FILTERED_PARAMS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/ignore_case.hpp>
+#include <boost/url/param.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+#ifndef BOOST_URL_DOCS
+namespace implementation_defined {
+
+struct param_identity_t
+{
+    template<class Param>
+    Param
+    operator()(Param const& p) const noexcept
+    {
+        return p;
+    }
+};
+
+struct param_key_t
+{
+    decode_view
+    operator()(param_pct_view const& p) const noexcept
+    {
+        return *p.key;
+    }
+
+    decode_view
+    operator()(param_decode_view const& p) const noexcept
+    {
+        return p.key;
+    }
+
+    core::string_view
+    operator()(param_view const& p) const noexcept
+    {
+        return p.key;
+    }
+
+    // the key would reference a temporary
+    void operator()(param&&) const = delete;
+};
+
+struct param_value_t
+{
+    decode_view
+    operator()(param_pct_view const& p) const noexcept
+    {
+        return *p.value;
+    }
+
+    decode_view
+    operator()(param_decode_view const& p) const noexcept
+    {
+        return p.value;
+    }
+
+    core::string_view
+    operator()(param_view const& p) const noexcept
+    {
+        return p.value;
+    }
+
+    // the value would reference a temporary
+    void operator()(param&&) const = delete;
+};
+
+} // implementation_defined
+#endif
+
+/** Project a param to its decoded key
+
+    This function object returns the key of
+    a param as a @ref decode_view which
+    references the underlying buffer, or as
+    a string view for a @ref param_view.
+
+    @par Example
+    @code
+    url_view u( "?a=1&b=2" );
+    for( decode_view k : filter_params(
+            u.encoded_params(), has_key( "a" ), param_key ) )
+        assert( k == "a" );
+    @endcode
+
+    @see
+        @ref filter_params,
+        @ref param_value.
+*/
+BOOST_INLINE_CONSTEXPR
+implementation_defined::param_key_t
+param_key{};
+
+/** Project a param to its decoded value
+
+    This function object returns the value
+    of a param as a @ref decode_view which
+    references the underlying buffer, or as
+    a string view for a @ref param_view.
+
+    @par Example
+    @code
+    url_view u( "?tr=udp%3A%2F%2Fa&dn=x&tr=udp%3A%2F%2Fb" );
+    for( decode_view v : filter_params(
+            u.encoded_params(), has_key( "tr" ), param_value ) )
+        assert( v.starts_with( "udp://" ) );
+    @endcode
+
+    @see
+        @ref filter_params,
+        @ref param_key.
+*/
+BOOST_INLINE_CONSTEXPR
+implementation_defined::param_value_t
+param_value{};
+
+//------------------------------------------------
+
+/** A predicate matching params with a key
+
+    The keys of the params are compared as
+    if all escaped characters were decoded
+    first, without decoding them into a
+    buffer.
+
+    @par Example
+    @code
+    url_view u( "?first=John&last=Doe" );
+    auto it = std::find_if(
+        u.encoded_params().begin(),
+        u.encoded_params().end(),
+        has_key( "Last", ignore_case ) );
+    @endcode
+
+    @see
+        @ref filter_params,
+        @ref params_key_set.
+*/
+class has_key
+{
+    core::string_view key_;
+    bool ic_ = false;
+
+public:
+    /** Constructor
+
+        The key is not copied, and it must
+        remain valid while the predicate is
+        in use.
+
+        @param key The decoded key to match.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+    */
+    explicit
+    has_key(
+        core::string_view key,
+        ignore_case_param ic = {}) noexcept
+        : key_(key)
+        , ic_(ic)
+    {
+    }
+
+    /// Return true if the key of p matches
+    bool
+    operator()(param_pct_view const& p) const noexcept
+    {
+        return match(*p.key);
+    }
+
+    /// Return true if the key of p matches
+    bool
+    operator()(param_decode_view const& p) const noexcept
+    {
+        return match(p.key);
+    }
+
+    /// Return true if the key of p matches
+    bool
+    operator()(param_view const& p) const noexcept
+    {
+        if(ic_)
+            return grammar::ci_is_equal(
+                p.key, key_);
+        return p.key == key_;
+    }
+
+private:
+    bool
+    match(decode_view const& k) const noexcept
+    {
+        if(ic_)
+            return grammar::ci_is_equal(k, key_);
+        return k == key_;
+    }
+};
+
+//------------------------------------------------
+
+/** A lazily filtered and projected range of params
+
+    This range visits the elements of an
+    underlying range of params which satisfy
+    a predicate, and yields the result of a
+    projection applied to each of them. The
+    elements are filtered and projected while
+    the range is iterated, so nothing is copied
+    or allocated unless the predicate or the
+    projection do.
+
+    The underlying range is typically a
+    @ref params_encoded_view, whose elements
+    are @ref param_pct_view, or the range
+    returned by @ref params_base::decoded,
+    whose elements are @ref param_decode_view.
+
+    Objects of this type are usually created
+    with @ref filter_params.
+
+    @par Example
+    @code
+    url_view u( "?tr=udp%3A%2F%2Fa&dn=x&tr=udp%3A%2F%2Fb" );
+    for( decode_view v : filter_params(
+            u.encoded_params(), has_key( "tr" ), param_value ) )
+        std::cout << v << "\n";
+    @endcode
+
+    @par Iterator Invalidation
+    Iterators reference the range they were
+    obtained from, which must not be moved or
+    destroyed while they are in use. Like the
+    underlying range, the range references
+    the buffer of the url.
+
+    @tparam Range The type of the underlying range
+    @tparam Predicate A callable which returns
+    true for the elements to visit
+    @tparam Projection A callable which returns
+    the value for each visited element
+
+    @see
+        @ref filter_params,
+        @ref has_key,
+        @ref param_key,
+        @ref param_value,
+        @ref params_key_set.
+*/
+template<
+    class Range,
+    class Predicate,
+    class Projection =
+        implementation_defined::param_identity_t>
+class filtered_params
+{
+    using base_iterator = decltype(
+        std::declval<Range const&>().begin());
+
+    Range r_;
+    Predicate p_;
+    Projection t_;
+
+public:
+    /// The type of the projected elements
+    using reference = decltype(
+        std::declval<Projection const&>()(
+            *std::declval<base_iterator const&>()));
+
+    /// The type of the projected elements
+    using value_type =
+        typename std::decay<reference>::type;
+
+    /** A forward iterator to the projected elements
+    */
+    class iterator
+    {
+        friend class filtered_params;
+
+        filtered_params const* v_ = nullptr;
+        base_iterator it_;
+
+        iterator(
+            filtered_params const& v,
+            base_iterator it)
+            : v_(&v)
+            , it_(it)
+        {
+            skip();
+        }
+
+        void
+        skip()
+        {
+            auto const end = v_->r_.end();
+            while(it_ != end &&
+                ! v_->p_(*it_))
+                ++it_;
+        }
+
+    public:
+        using value_type =
+            typename filtered_params::value_type;
+        using reference =
+            typename filtered_params::reference;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category =
+            std::forward_iterator_tag;
+
+        iterator() = default;
+
+        iterator&
+        operator++()
+        {
+            ++it_;
+            skip();
+            return *this;
+        }
+
+        iterator
+        operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        reference
+        operator*() const
+        {
+            return v_->t_(*it_);
+        }
+
+        /** Return the underlying iterator
+        */
+        base_iterator
+        base() const
+        {
+            return it_;
+        }
+
+        bool
+        operator==(
+            iterator const& other) const
+        {
+            return it_ == other.it_;
+        }
+
+        bool
+        operator!=(
+            iterator const& other) const
+        {
+            return !(it_ == other.it_);
+        }
+    };
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** Constructor
+
+        @param r The underlying range
+        @param p The predicate
+        @param t The projection
+    */
+    explicit
+    filtered_params(
+        Range const& r,
+        Predicate p = {},
+        Projection t = {})
+        : r_(r)
+        , p_(std::move(p))
+        , t_(std::move(t))
+    {
+    }
+
+    /** Return an iterator to the first visited element
+
+        @par Complexity
+        Linear in the number of elements
+        before the first visited element.
+    */
+    iterator
+    begin() const
+    {
+        return iterator(*this, r_.begin());
+    }
+
+    /** Return an iterator to the end
+    */
+    iterator
+    end() const
+    {
+        return iterator(*this, r_.end());
+    }
+
+    /** Return true if no element is visited
+
+        @par Complexity
+        Linear in the number of elements
+        before the first visited element.
+    */
+    bool
+    empty() const
+    {
+        return begin() == end();
+    }
+
+    /** Return the underlying range
+    */
+    Range const&
+    base() const noexcept
+    {
+        return r_;
+    }
+};
+
+/** Return a lazily filtered range of params
+
+    @par Example
+    @code
+    url_view u( "?a=1&b=2&a=3" );
+    for( param_pct_view p : filter_params(
+            u.encoded_params(), has_key( "a" ) ) )
+        assert( p.key == "a" );
+    @endcode
+
+    @return A range of the elements of
+    `r` which satisfy `p`.
+
+    @param r The underlying range
+    @param p The predicate
+
+    @see
+        @ref filtered_params.
+*/
+template<class Range, class Predicate>
+filtered_params<Range, Predicate>
+filter_params(
+    Range const& r,
+    Predicate p)
+{
+    return filtered_params<
+        Range, Predicate>(r, std::move(p));
+}
+
+/** Return a lazily filtered and projected range of params
+
+    @par Example
+    @code
+    url_view u( "?a=1&b=2&a=3" );
+    for( decode_view v : filter_params(
+            u.encoded_params(), has_key( "a" ), param_value ) )
+        assert( v == "1" || v == "3" );
+    @endcode
+
+    @return A range of the projections of
+    the elements of `r` which satisfy `p`.
+
+    @param r The underlying range
+    @param p The predicate
+    @param t The projection
+
+    @see
+        @ref filtered_params.
+*/
+template<
+    class Range,
+    class Predicate,
+    class Projection>
+filtered_params<Range, Predicate, Projection>
+filter_params(
+    Range const& r,
+    Predicate p,
+    Projection t)
+{
+    return filtered_params<
+        Range, Predicate, Projection>(
+            r, std::move(p), std::move(t));
+}
+
+} // urls
+} // boost
+
+#endif
@@ -480,6 +480,208 @@ arg(core::string_view name, T const& arg)
     return {name, arg};
 }
 
+#if defined(BOOST_URL_HAS_FORMAT_STRING) || defined(BOOST_URL_DOCS)
+
+namespace detail {
+// Not constexpr: calling this while a
+// format_string is constructed makes the
+// program ill-formed and shows `msg`
+inline
+void
+invalid_format_string(char const* msg) noexcept
+{
+    (void)msg;
+}
+} // detail
+
+/** A format URL string checked at compile time
+
+    This class holds a copy of a format URL
+    string literal, which is validated with
+    the same rules as @ref format when it is
+    constructed. The boundaries of its URL
+    components are found at the same time.
+
+    Objects of this type are only constructed
+    in constant expressions, as the template
+    argument of the overloads of @ref format
+    and @ref format_to which take the format
+    string as a template argument. An invalid
+    format string is a compile-time error, and
+    so is a replacement field which refers to
+    an argument which is not provided.
+
+    @par Example
+    @code
+    url u = format< "https://{}/users/{}" >( "example.com", 42 );
+    assert( u.buffer() == "https://example.com/users/42" );
+    @endcode
+
+    @note
+    This class requires C++20.
+
+    @see
+        @ref format,
+        @ref format_to.
+*/
+template <std::size_t N>
+struct format_string
+{
+    /// The format URL string and a null terminator
+    char str[N] = {};
+
+    /// The boundaries of the URL components
+    detail::static_pattern pattern;
+
+    /** Constructor
+
+        @param s The format URL string.
+    */
+    consteval
+    format_string(
+        char const (&s)[N]) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            str[i] = s[i];
+        detail::static_pattern_parser pr(
+            str, N - 1);
+        if (char const* e = pr.parse())
+            detail::invalid_format_string(e);
+        pattern = pr.p;
+    }
+
+    /** Return the format URL string
+    */
+    constexpr
+    core::string_view
+    view() const noexcept
+    {
+        return {str, N - 1};
+    }
+};
+
+template <std::size_t N>
+format_string(char const (&)[N]) -> format_string<N>;
+
+/** Format arguments into a URL
+
+    Format arguments according to a format
+    URL string which was validated at compile
+    time. The result is the same as for the
+    overload which takes the format string as
+    a function argument, but the format string
+    is not parsed at runtime.
+
+    @par Example
+    @code
+    assert(format<"{}://{}:{}/rfc/{}">(
+        "https", "www.ietf.org", 80, "rfc2396.txt"
+        ).buffer() == "https://www.ietf.org:80/rfc/rfc2396.txt");
+    @endcode
+
+    @note
+    This function requires C++20.
+
+    @return A URL holding the formatted result.
+
+    @tparam Fmt The format URL string.
+
+    @param args Arguments to be formatted.
+
+    @throws system_error
+    The result contains an invalid URL after
+    replacements are applied.
+
+    @see
+        @ref format_string,
+        @ref format_to.
+*/
+template <
+    format_string Fmt,
+    BOOST_URL_CONSTRAINT(std::convertible_to<format_arg>)... Args>
+url
+format(Args&&... args)
+{
+    static_assert(
+        sizeof...(Args) >= Fmt.pattern.nargs,
+        "a replacement field refers to a missing argument");
+    static_assert(
+        ! Fmt.pattern.named || (
+            detail::is_named_arg<
+                typename std::decay<Args>::type>::value || ...),
+        "a replacement field refers to a named argument "
+        "but none is provided");
+    url u;
+    detail::vformat_to(
+        u, Fmt.view(), Fmt.pattern,
+        detail::make_format_args(
+            std::forward<Args>(args)...));
+    return u;
+}
+
+/** Format arguments into a URL
+
+    Format arguments according to a format
+    URL string which was validated at compile
+    time into a @ref url_base. The result is
+    the same as for the overload which takes
+    the format string as a function argument,
+    but the format string is not parsed at
+    runtime.
+
+    @par Example
+    @code
+    static_url<50> u;
+    format_to<"{}://{}:{}/rfc/{}">(u,
+        "https", "www.ietf.org", 80, "rfc2396.txt");
+    assert(u.buffer() == "https://www.ietf.org:80/rfc/rfc2396.txt");
+    @endcode
+
+    @note
+    This function requires C++20.
+
+    @par Exception Safety
+    Strong guarantee.
+
+    @tparam Fmt The format URL string.
+
+    @param u An object that derives from @ref url_base.
+
+    @param args Arguments to be formatted.
+
+    @throws system_error
+    `u` contains an invalid URL after
+    replacements are applied.
+
+    @see
+        @ref format_string,
+        @ref format.
+*/
+template <
+    format_string Fmt,
+    BOOST_URL_CONSTRAINT(std::convertible_to<format_arg>)... Args>
+void
+format_to(
+    url_base& u,
+    Args&&... args)
+{
+    static_assert(
+        sizeof...(Args) >= Fmt.pattern.nargs,
+        "a replacement field refers to a missing argument");
+    static_assert(
+        ! Fmt.pattern.named || (
+            detail::is_named_arg<
+                typename std::decay<Args>::type>::value || ...),
+        "a replacement field refers to a named argument "
+        "but none is provided");
+    detail::vformat_to(
+        u, Fmt.view(), Fmt.pattern,
+        detail::make_format_args(
+            std::forward<Args>(args)...));
+}
+
+#endif
+
 } // url
 } // boost
 
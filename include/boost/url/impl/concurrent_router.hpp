@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_CONCURRENT_ROUTER_HPP
+#define BOOST_URL_IMPL_CONCURRENT_ROUTER_HPP
+
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+template <class T>
+concurrent_router<T>::
+snapshot::
+snapshot(
+    concurrent_router const& cr) noexcept
+    : cr_(&cr)
+{
+    r_ = static_cast<router<T> const*>(
+        cr.lock(idx_));
+}
+
+template <class T>
+concurrent_router<T>::
+snapshot::
+snapshot(snapshot&& other) noexcept
+    : cr_(other.cr_)
+    , r_(other.r_)
+    , idx_(other.idx_)
+{
+    other.cr_ = nullptr;
+    other.r_ = nullptr;
+}
+
+template <class T>
+concurrent_router<T>::
+snapshot::
+~snapshot()
+{
+    if (cr_)
+        cr_->unlock(idx_);
+}
+
+//------------------------------------------------
+
+template <class T>
+concurrent_router<T>::
+concurrent_router()
+    : concurrent_router(router<T>())
+{
+}
+
+template <class T>
+auto
+concurrent_router<T>::
+make(router<T>&& r) ->
+    router<T> const*
+{
+    // the readers never freeze
+    r.freeze_impl();
+    return new router<T>(std::move(r));
+}
+
+template <class T>
+concurrent_router<T>::
+concurrent_router(router<T>&& r)
+    : detail::concurrent_router_base(
+        make(std::move(r)))
+{
+}
+
+template <class T>
+concurrent_router<T>::
+~concurrent_router()
+{
+    delete static_cast<
+        router<T> const*>(get());
+}
+
+template <class T>
+void
+concurrent_router<T>::
+store(router<T>&& r)
+{
+    delete static_cast<router<T> const*>(
+        exchange(make(std::move(r))));
+}
+
+} // urls
+} // boost
+
+#endif
@@ -30,6 +30,7 @@ class BOOST_SYMBOL_VISIBLE params_base::iterator
 
     friend class params_base;
     friend class params_ref;
+    friend class params_index;
 
     iterator(
         detail::query_ref const& ref,
@@ -159,6 +160,154 @@ operator*() const ->
         p.has_value);
 }
 
+//------------------------------------------------
+
+class BOOST_SYMBOL_VISIBLE params_base::decode_iterator
+{
+    detail::params_iter_impl it_;
+    bool space_as_plus_ = true;
+
+    friend class params_base;
+
+    decode_iterator(
+        detail::params_iter_impl const& it,
+        encoding_opts opt) noexcept
+        : it_(it)
+        , space_as_plus_(opt.space_as_plus)
+    {
+    }
+
+public:
+    using value_type = param_decode_view;
+    using reference = param_decode_view;
+    using pointer = reference;
+    using difference_type =
+        params_base::difference_type;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    decode_iterator() = default;
+    decode_iterator(decode_iterator const&) = default;
+    decode_iterator& operator=(
+        decode_iterator const&) noexcept = default;
+
+    decode_iterator&
+    operator++() noexcept
+    {
+        it_.increment();
+        return *this;
+    }
+
+    decode_iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    decode_iterator&
+    operator--() noexcept
+    {
+        it_.decrement();
+        return *this;
+    }
+
+    decode_iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        encoding_opts opt;
+        opt.space_as_plus =
+            space_as_plus_;
+        return reference(
+            it_.dereference(), opt);
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+        return **this;
+    }
+
+    bool
+    operator==(
+        decode_iterator const& other) const noexcept
+    {
+        return it_.equal(other.it_);
+    }
+
+    bool
+    operator!=(
+        decode_iterator const& other) const noexcept
+    {
+        return ! it_.equal(other.it_);
+    }
+};
+
+//------------------------------------------------
+
+class BOOST_SYMBOL_VISIBLE params_base::decoded_range
+{
+    decode_iterator first_;
+    decode_iterator last_;
+    std::size_t n_ = 0;
+
+    friend class params_base;
+
+    decoded_range(
+        decode_iterator first,
+        decode_iterator last,
+        std::size_t n) noexcept
+        : first_(first)
+        , last_(last)
+        , n_(n)
+    {
+    }
+
+public:
+    using iterator = decode_iterator;
+    using const_iterator = decode_iterator;
+    using value_type = param_decode_view;
+    using reference = param_decode_view;
+    using const_reference = param_decode_view;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    decoded_range() = default;
+
+    iterator
+    begin() const noexcept
+    {
+        return first_;
+    }
+
+    iterator
+    end() const noexcept
+    {
+        return last_;
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+};
+
 //------------------------------------------------
 //
 // params_base
@@ -294,6 +443,20 @@ end() const noexcept ->
     return {ref_, opt_, 0};
 }
 
+inline
+auto
+params_base::
+decoded() const noexcept ->
+    decoded_range
+{
+    return decoded_range(
+        decode_iterator(
+            detail::params_iter_impl(ref_), opt_),
+        decode_iterator(
+            detail::params_iter_impl(ref_, 0), opt_),
+        ref_.nparam());
+}
+
 //------------------------------------------------
 
 inline
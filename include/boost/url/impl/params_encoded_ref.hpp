@@ -13,7 +13,9 @@
 
 #include <boost/url/params_encoded_view.hpp>
 #include <boost/url/url_base.hpp>
+#include <boost/url/detail/encode.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/rfc/detail/charsets.hpp>
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/assert.hpp>
 #include <utility>
@@ -212,6 +214,68 @@ replace(
             first, last));
 }
 
+template<class Predicate>
+std::size_t
+params_encoded_ref::
+remove_if(Predicate pred)
+{
+    return u_->erase_params_if(
+        [&pred](
+            detail::params_iter_impl const& it) -> bool
+        {
+            return pred(it.dereference());
+        });
+}
+
+template<class Predicate>
+std::size_t
+params_encoded_ref::
+retain(Predicate pred)
+{
+    return u_->erase_params_if(
+        [&pred](
+            detail::params_iter_impl const& it) -> bool
+        {
+            return ! pred(it.dereference());
+        });
+}
+
+template<class Function>
+void
+params_encoded_ref::
+transform_values(Function f)
+{
+    if(empty())
+        return;
+    // Build the new query once and splice
+    // it in with a single edit.
+    std::string s;
+    s.reserve(ref_.size());
+    auto const end_ = end();
+    for(auto it = begin();
+        it != end_; ++it)
+    {
+        if(it.it_.index > 0)
+            s.push_back('&');
+        auto const k = it.it_.key();
+        s.append(k.data(), k.size());
+        s.push_back('=');
+        auto const& r = f(*it);
+        pct_string_view const v(r);
+        auto const n0 = s.size();
+        s.resize(n0 +
+            detail::re_encoded_size_unsafe(
+                v, detail::param_value_chars));
+        char* dest = &s[n0];
+        detail::re_encode_unsafe(
+            dest,
+            dest + (s.size() - n0),
+            v,
+            detail::param_value_chars);
+    }
+    u_->set_encoded_query(s);
+}
+
 //------------------------------------------------
 //
 // implementation
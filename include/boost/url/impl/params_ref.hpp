@@ -15,6 +15,8 @@
 #include <boost/url/url_base.hpp>
 #include <boost/url/detail/any_params_iter.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/encode.hpp>
+#include <boost/url/rfc/detail/charsets.hpp>
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/url/grammar/recycled.hpp>
 #include <boost/assert.hpp>
@@ -126,6 +128,65 @@ replace(
         opt_);
 }
 
+template<class Predicate>
+std::size_t
+params_ref::
+remove_if(Predicate pred)
+{
+    auto const opt = opt_;
+    return u_->erase_params_if(
+        [&pred, opt](
+            detail::params_iter_impl const& it) -> bool
+        {
+            return pred(*iterator(it, opt));
+        });
+}
+
+template<class Predicate>
+std::size_t
+params_ref::
+retain(Predicate pred)
+{
+    auto const opt = opt_;
+    return u_->erase_params_if(
+        [&pred, opt](
+            detail::params_iter_impl const& it) -> bool
+        {
+            return ! pred(*iterator(it, opt));
+        });
+}
+
+template<class Function>
+void
+params_ref::
+transform_values(Function f)
+{
+    if(empty())
+        return;
+    // Build the new query once and splice
+    // it in with a single edit. Keys are
+    // already encoded and copied as-is.
+    std::string s;
+    s.reserve(ref_.size());
+    auto const end_ = end();
+    for(auto it = begin();
+        it != end_; ++it)
+    {
+        if(it.it_.index > 0)
+            s.push_back('&');
+        auto const k = it.it_.key();
+        s.append(k.data(), k.size());
+        s.push_back('=');
+        auto const& v = f(*it);
+        encode(
+            core::string_view(v),
+            detail::param_value_chars,
+            opt_,
+            string_token::append_to(s));
+    }
+    u_->set_encoded_query(s);
+}
+
 //------------------------------------------------
 //
 // implementation
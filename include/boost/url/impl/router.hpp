@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IMPL_ROUTER_HPP
+#define BOOST_URL_IMPL_ROUTER_HPP
+
+#include <boost/url/grammar/type_traits.hpp>
+#include <boost/core/detail/static_assert.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+template <class T>
+template <class U>
+void
+router<T>::
+insert(core::string_view pattern, U&& v)
+{
+    BOOST_CORE_STATIC_ASSERT(
+        std::is_constructible<T, U&&>::value);
+    values_.emplace_back(std::forward<U>(v));
+    std::size_t i;
+    try
+    {
+        i = insert_impl(
+            pattern, values_.size() - 1);
+    }
+    catch(...)
+    {
+        values_.pop_back();
+        throw;
+    }
+    if (i != values_.size() - 1)
+    {
+        // replace the resource
+        // of an existing route
+        try
+        {
+            values_[i] = std::move(values_.back());
+        }
+        catch(...)
+        {
+            values_.pop_back();
+            throw;
+        }
+        values_.pop_back();
+    }
+}
+
+template <class T>
+template <class Rule>
+void
+router<T>::
+add_rule(
+    core::string_view name,
+    Rule const& r)
+{
+    BOOST_CORE_STATIC_ASSERT(
+        grammar::is_rule<Rule>::value);
+    add_rule_impl(name, std::unique_ptr<
+        detail::route_rule>(new
+            detail::route_rule_impl<Rule>(r)));
+}
+
+template <class T>
+template <std::size_t N>
+T const*
+router<T>::
+find(
+    segments_encoded_view path,
+    matches_storage<N>& m) const
+{
+    matches_base& mb = m;
+    std::size_t n = 0;
+    std::size_t const i = find_impl(
+        path, mb.matches(), mb.ids(),
+        mb.values(), N, n);
+    mb.resize(n);
+    if (i == npos)
+        return nullptr;
+    return &values_[i];
+}
+
+} // urls
+} // boost
+
+#endif
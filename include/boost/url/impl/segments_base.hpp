@@ -131,6 +131,143 @@ iterator(
 {
 }
 
+//------------------------------------------------
+
+class segments_base::decode_iterator
+{
+    detail::segments_iter_impl it_;
+
+    friend class segments_base;
+
+    explicit
+    decode_iterator(
+        detail::segments_iter_impl const& it) noexcept
+        : it_(it)
+    {
+    }
+
+public:
+    using value_type = decode_view;
+    using reference = decode_view;
+    using pointer = reference;
+    using difference_type =
+        segments_base::difference_type;
+    using iterator_category =
+        std::bidirectional_iterator_tag;
+
+    decode_iterator() = default;
+    decode_iterator(decode_iterator const&) = default;
+    decode_iterator& operator=(
+        decode_iterator const&) noexcept = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return decode_view(
+            it_.dereference());
+    }
+
+    decode_iterator&
+    operator++() noexcept
+    {
+        it_.increment();
+        return *this;
+    }
+
+    decode_iterator&
+    operator--() noexcept
+    {
+        it_.decrement();
+        return *this;
+    }
+
+    decode_iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    decode_iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    bool
+    operator==(
+        decode_iterator const& other) const noexcept
+    {
+        return it_.equal(other.it_);
+    }
+
+    bool
+    operator!=(
+        decode_iterator const& other) const noexcept
+    {
+        return ! it_.equal(other.it_);
+    }
+};
+
+//------------------------------------------------
+
+class segments_base::decoded_range
+{
+    decode_iterator first_;
+    decode_iterator last_;
+    std::size_t n_ = 0;
+
+    friend class segments_base;
+
+    decoded_range(
+        decode_iterator first,
+        decode_iterator last,
+        std::size_t n) noexcept
+        : first_(first)
+        , last_(last)
+        , n_(n)
+    {
+    }
+
+public:
+    using iterator = decode_iterator;
+    using const_iterator = decode_iterator;
+    using value_type = decode_view;
+    using reference = decode_view;
+    using const_reference = decode_view;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    decoded_range() = default;
+
+    iterator
+    begin() const noexcept
+    {
+        return first_;
+    }
+
+    iterator
+    end() const noexcept
+    {
+        return last_;
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+};
+
 //------------------------------------------------
 //
 // segments_base
@@ -213,6 +350,20 @@ end() const noexcept ->
     return iterator(ref_, 0);
 }
 
+inline
+auto
+segments_base::
+decoded() const noexcept ->
+    decoded_range
+{
+    return decoded_range(
+        decode_iterator(
+            detail::segments_iter_impl(ref_)),
+        decode_iterator(
+            detail::segments_iter_impl(ref_, 0)),
+        ref_.nseg());
+}
+
 //------------------------------------------------
 
 inline
@@ -108,6 +108,32 @@ replace(
             first, last));
 }
 
+template<class Predicate>
+std::size_t
+segments_ref::
+remove_if(Predicate pred)
+{
+    return u_->erase_segments_if(
+        [&pred](
+            detail::segments_iter_impl const& it) -> bool
+        {
+            return pred(*it.dereference());
+        });
+}
+
+template<class Predicate>
+std::size_t
+segments_ref::
+retain(Predicate pred)
+{
+    return u_->erase_segments_if(
+        [&pred](
+            detail::segments_iter_impl const& it) -> bool
+        {
+            return ! pred(*it.dereference());
+        });
+}
+
 //------------------------------------------------
 
 template<class FwdIt>
@@ -11,6 +11,7 @@
 #ifndef BOOST_URL_IMPL_URL_BASE_HPP
 #define BOOST_URL_IMPL_URL_BASE_HPP
 
+#include <boost/url/decode_view.hpp>
 #include <boost/url/encode.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/host_type.hpp>
@@ -23,6 +24,7 @@
 #include <boost/url/detail/except.hpp>
 #include <boost/url/detail/normalize.hpp>
 #include <boost/url/detail/path.hpp>
+#include <boost/url/detail/pred_bits.hpp>
 #include <boost/url/detail/print.hpp>
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/url/rfc/authority_rule.hpp>
@@ -37,6 +39,7 @@
 #include <boost/url/rfc/detail/userinfo_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/detail/move_chars.hpp>
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
@@ -1693,6 +1696,38 @@ remove_query() noexcept
     return *this;
 }
 
+inline
+url_base&
+url_base::
+sort_params(
+    ignore_case_param ic,
+    encoding_opts opt)
+{
+    if(! ic)
+        return sort_params(
+            [](decode_view const& k0,
+                decode_view const& k1)
+            {
+                return k0.compare(k1) < 0;
+            }, opt);
+    return sort_params(
+        [](decode_view const& k0,
+            decode_view const& k1)
+        {
+            return std::lexicographical_compare(
+                k0.begin(), k0.end(),
+                k1.begin(), k1.end(),
+                [](char c0, char c1)
+                {
+                    return
+                        static_cast<unsigned char>(
+                            grammar::to_lower(c0)) <
+                        static_cast<unsigned char>(
+                            grammar::to_lower(c1));
+                });
+        }, opt);
+}
+
 //------------------------------------------------
 //
 // Fragment
@@ -1897,18 +1932,17 @@ resolve(
 template <
     class AllowedCharset,
     class IgnoredCharset>
-void
+char*
 url_base::
-normalize_octets_impl(
-    int id,
+normalize_octets(
+    char* dest,
+    char const* it,
+    char const* const end,
     AllowedCharset const& allowed,
-    IgnoredCharset const& ignored,
-    op_t& op) noexcept
+    IgnoredCharset const& ignored) noexcept
 {
-    char* it = s_ + impl_.offset(id);
-    char* end = s_ + impl_.offset(id + 1);
+    BOOST_ASSERT(dest <= it);
     char d = 0;
-    char* dest = it;
     while (it < end)
     {
         if (*it != '%')
@@ -1937,9 +1971,27 @@ normalize_octets_impl(
         *dest++ = grammar::to_upper(*it++);
         *dest++ = grammar::to_upper(*it++);
     }
-    if (it != dest)
+    return dest;
+}
+
+template <
+    class AllowedCharset,
+    class IgnoredCharset>
+void
+url_base::
+normalize_octets_impl(
+    int id,
+    AllowedCharset const& allowed,
+    IgnoredCharset const& ignored,
+    op_t& op) noexcept
+{
+    char* it = s_ + impl_.offset(id);
+    char* end = s_ + impl_.offset(id + 1);
+    char* dest = normalize_octets(
+        it, it, end, allowed, ignored);
+    if (end != dest)
     {
-        auto diff = it - dest;
+        auto diff = end - dest;
         auto n = impl_.len(id) - diff;
         shrink_impl(id, n, op);
         s_[size()] = '\0';
@@ -2016,6 +2068,15 @@ normalize_path()
     // ambiguities that Steps 2 and 3 must handle.
     //
     normalize_octets_impl(id_path, detail::segment_chars, op);
+    normalize_path_impl(op);
+    return *this;
+}
+
+inline
+void
+url_base::
+normalize_path_impl(op_t& op)
+{
     core::string_view p = impl_.get(id_path);
     char* p_dest = s_ + impl_.offset(id_path);
     char* p_end = s_ + impl_.offset(id_path + 1);
@@ -2328,9 +2389,12 @@ normalize_path()
         }
         else if (!p.empty())
         {
+            // a "./" or "/." shield
+            // is not a segment
             impl_.nseg_ = detail::to_size_type(
-                std::count(
-                    p.begin() + 1, p.end(), '/') + 1);
+                detail::path_segments(p,
+                    std::count(
+                        p.begin() + 1, p.end(), '/') + 1));
         }
         else
         {
@@ -2340,7 +2404,6 @@ normalize_path()
             detail::to_size_type(detail::decode_bytes_unsafe(
                 impl_.get(id_path)));
     }
-    return *this;
 }
 
 inline
@@ -2373,11 +2436,101 @@ url_base&
 url_base::
 normalize()
 {
-    normalize_fragment();
-    normalize_query();
-    normalize_path();
-    normalize_authority();
-    normalize_scheme();
+    op_t op(*this);
+
+    //
+    // Rewrite every part in a single forward
+    // sweep. Case folding and decoding never
+    // grow a part, so the write position never
+    // passes the read position and the buffer
+    // is compacted in place. Each offset is
+    // adjusted once, instead of moving the
+    // tail of the buffer once per part.
+    //
+    bool const reg_name =
+        host_type() == urls::host_type::name;
+    std::size_t n = 0;
+    for (int id = id_scheme; id < id_end; ++id)
+    {
+        char const* it = s_ + impl_.offset(id);
+        char const* const end = s_ + impl_.offset(id + 1);
+        std::size_t const len = end - it;
+        if (n != 0)
+            impl_.adjust_left(id, id, n);
+        char* const first = s_ + impl_.offset(id);
+        char* dest = first;
+        switch (id)
+        {
+        case id_scheme:
+            while (it != end)
+                *dest++ = grammar::to_lower(*it++);
+            break;
+
+        case id_user:
+            dest = normalize_octets(dest, it, end,
+                detail::user_chars, detail::empty_chars);
+            break;
+
+        case id_pass:
+            dest = normalize_octets(dest, it, end,
+                detail::password_chars, detail::empty_chars);
+            break;
+
+        case id_host:
+            if (reg_name)
+            {
+                dest = normalize_octets(dest, it, end,
+                    detail::reg_name_chars, detail::empty_chars);
+            }
+            else
+            {
+                while (it != end)
+                    *dest++ = *it++;
+            }
+            // lowercase, except escapes
+            for (char* p = first; p < dest;)
+            {
+                if (*p != '%')
+                {
+                    *p = grammar::to_lower(*p);
+                    ++p;
+                    continue;
+                }
+                p += 3;
+            }
+            break;
+
+        case id_path:
+            dest = normalize_octets(dest, it, end,
+                detail::segment_chars, detail::empty_chars);
+            break;
+
+        case id_query:
+            dest = normalize_octets(dest, it, end,
+                detail::query_chars, detail::query_ignore_chars);
+            break;
+
+        case id_frag:
+            dest = normalize_octets(dest, it, end,
+                detail::fragment_chars, detail::empty_chars);
+            break;
+
+        default:
+            while (it != end)
+                *dest++ = *it++;
+            break;
+        }
+        n += len - (dest - first);
+    }
+    if (n != 0)
+    {
+        impl_.adjust_left(id_end, id_end, n);
+        s_[size()] = '\0';
+    }
+
+    // Dot segments are removed from the
+    // already decoded path, in place.
+    normalize_path_impl(op);
     return *this;
 }
 
@@ -3293,6 +3446,206 @@ edit_params(
 
 //------------------------------------------------
 
+template<class Pred>
+std::size_t
+url_base::
+erase_params_if(Pred&& pred)
+{
+    auto const n0 = impl_.nparam_;
+    if(n0 == 0)
+        return 0;
+
+//------------------------------------------------
+//
+//  Apply pred to every param before the
+//  query is changed, so an exception
+//  thrown by pred leaves it intact.
+//
+    detail::pred_bits erase(n0);
+    std::size_t nerase = 0;
+    {
+        detail::params_iter_impl it(impl_);
+        for(;;)
+        {
+            if(pred(static_cast<
+                detail::params_iter_impl const&>(it)))
+            {
+                erase.set(it.index);
+                ++nerase;
+            }
+            if(it.index + 1 == n0)
+                break;
+            it.increment();
+        }
+    }
+    if(nerase == 0)
+        return 0;
+
+//------------------------------------------------
+//
+//  Compact the kept params towards the
+//  front of the query. Every param is
+//  visited once, and its chunk is moved
+//  at most once. The write position never
+//  passes the read position, so the param
+//  being read is always intact.
+//
+//  chunk = ( '?' / '&' ) key [ '=' value ]
+//
+    op_t op(*this);
+    auto const q = impl_.offset(id_query);
+    std::size_t w = 0;
+    std::size_t nkeep = 0;
+    std::size_t dn = 0;
+    detail::params_iter_impl it(impl_);
+    for(;;)
+    {
+        if(! erase.test(it.index))
+        {
+            auto const n = it.nk + it.nv;
+            if(w != it.pos)
+                op.move(
+                    s_ + q + w,
+                    s_ + q + it.pos,
+                    n);
+            s_[q + w] = nkeep == 0 ? '?' : '&';
+            // decoded size, including
+            // the separators
+            dn += it.dk + 1;
+            if(it.nv > 0)
+                dn += it.dv + 1;
+            w += n;
+            ++nkeep;
+        }
+        if(it.index + 1 == n0)
+            break;
+        it.increment();
+    }
+
+//------------------------------------------------
+//
+//  Close the gap in one move and update
+//  the counts once.
+//
+    shrink_impl(id_query, w, op);
+    impl_.nparam_ =
+        detail::to_size_type(nkeep);
+    // the leading '?' is not
+    // counted in decoded_[id_query]
+    impl_.decoded_[id_query] =
+        detail::to_size_type(
+            nkeep > 0 ? dn - 1 : 0);
+    return nerase;
+}
+
+template<class Pred>
+std::size_t
+url_base::
+erase_segments_if(Pred&& pred)
+{
+    auto const n0 = impl_.nseg_;
+    if(n0 == 0)
+        return 0;
+
+//------------------------------------------------
+//
+//  Apply pred to every segment before the
+//  path is changed, so an exception
+//  thrown by pred leaves it intact.
+//
+    detail::pred_bits erase(n0);
+    std::size_t nerase = 0;
+    {
+        detail::segments_iter_impl it(impl_);
+        for(;;)
+        {
+            if(pred(static_cast<
+                detail::segments_iter_impl const&>(it)))
+            {
+                erase.set(it.index);
+                ++nerase;
+            }
+            if(it.index + 1 == n0)
+                break;
+            it.increment();
+        }
+    }
+    if(nerase == 0)
+        return 0;
+
+//------------------------------------------------
+//
+//  Erase the leading run first, if any.
+//  This changes the path prefix, so it
+//  goes through edit_segments, which owns
+//  the prefix rules and may allocate. The
+//  compaction below cannot throw.
+//
+    std::size_t nfront = 0;
+    while(nfront < n0 && erase.test(nfront))
+        ++nfront;
+    if(nfront > 0)
+    {
+        detail::segments_iter_impl first(impl_);
+        if(nfront == n0)
+            first = detail::segments_iter_impl(impl_, 0);
+        else
+            for(std::size_t i = 0; i < nfront; ++i)
+                first.increment();
+        core::string_view s;
+        edit_segments(
+            detail::segments_iter_impl(impl_),
+            first,
+            detail::make_segments_encoded_iter(
+                &s, &s));
+        if(nfront == nerase)
+            return nerase;
+    }
+
+//------------------------------------------------
+//
+//  Compact the segments after the first
+//  kept one, which is now the first
+//  segment. Their chunks start with '/',
+//  and the prefix and first segment are
+//  left untouched.
+//
+//  chunk = '/' segment
+//
+    {
+        op_t op(*this);
+        auto const n1 = impl_.nseg_;
+        auto const p = impl_.offset(id_path);
+        detail::segments_iter_impl it(impl_);
+        std::size_t w = it.next;
+        std::size_t dn = 0;
+        while(it.index + 1 < n1)
+        {
+            it.increment();
+            if(erase.test(nfront + it.index))
+            {
+                dn += it.dn + 1;
+                continue;
+            }
+            auto const n = it.next - it.pos;
+            if(w != it.pos)
+                op.move(
+                    s_ + p + w,
+                    s_ + p + it.pos,
+                    n);
+            w += n;
+        }
+        shrink_impl(id_path, w, op);
+        impl_.nseg_ = detail::to_size_type(
+            n1 - (nerase - nfront));
+        impl_.decoded_[id_path] -=
+            detail::to_size_type(dn);
+    }
+    return nerase;
+}
+
+//------------------------------------------------
+
 inline
 void
 url_base::
@@ -3328,6 +3681,79 @@ to_lower_impl(int id) noexcept
     }
 }
 
+template<class Compare, class>
+url_base&
+url_base::
+sort_params(
+    Compare comp,
+    encoding_opts opt)
+{
+    std::size_t const n = impl_.nparam_;
+    if(n < 2)
+        return *this;
+    // Sort the positions of the params,
+    // not the params themselves. Keys are
+    // decoded on the fly by the comparison.
+    std::vector<detail::params_iter_impl> v;
+    v.reserve(n);
+    detail::params_iter_impl it(impl_);
+    for(std::size_t i = 0;;)
+    {
+        v.push_back(it);
+        if(++i == n)
+            break;
+        it.increment();
+    }
+    std::stable_sort(v.begin(), v.end(),
+        [&comp, opt](
+            detail::params_iter_impl const& p0,
+            detail::params_iter_impl const& p1) -> bool
+        {
+            return comp(
+                decode_view(p0.key(), opt),
+                decode_view(p1.key(), opt));
+        });
+    permute_params(v);
+    return *this;
+}
+
+// Rewrite the query so the params appear
+// in the order given by v. The size of the
+// query and its decoded size are unchanged.
+inline
+void
+url_base::
+permute_params(
+    std::vector<
+        detail::params_iter_impl> const& v)
+{
+    std::size_t i = 0;
+    while( i < v.size() &&
+        v[i].index == i)
+        ++i;
+    if(i == v.size())
+        return;
+    // the chunks are copied out once,
+    // so they can be written back in
+    // any order
+    core::string_view const q =
+        impl_.get(id_query);
+    std::string const tmp(
+        q.data() + 1, q.size() - 1);
+    char* dest = s_ + impl_.offset(id_query);
+    char sep = '?';
+    for(auto const& p : v)
+    {
+        *dest++ = sep;
+        sep = '&';
+        auto const n = p.nk - 1 + p.nv;
+        std::memcpy(dest, tmp.data() + p.pos, n);
+        dest += n;
+    }
+    BOOST_ASSERT(dest ==
+        s_ + impl_.offset(id_frag));
+}
+
 } // urls
 } // boost
 
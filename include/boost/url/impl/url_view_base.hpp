@@ -13,7 +13,8 @@
 
 #include <boost/url/detail/memcpy.hpp>
 #include <boost/url/detail/except.hpp>
-#include <boost/url/detail/fnv_1a.hpp>
+#include <boost/url/detail/digest_sink.hpp>
+#include <boost/url/detail/wyhash.hpp>
 #include <boost/assert.hpp>
 #include <cstring>
 #include <memory>
@@ -29,26 +30,26 @@ BOOST_URL_DECL
 void
 ci_digest(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 BOOST_URL_DECL
 void
 digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 BOOST_URL_DECL
 void
 ci_digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 BOOST_URL_DECL
 void
 normalized_path_digest(
     core::string_view str,
     bool remove_unmatched,
-    fnv_1a& hasher) noexcept;
+    digest_sink& hasher) noexcept;
 
 BOOST_URL_DECL
 int
@@ -83,17 +84,28 @@ std::size_t
 url_view_base::
 digest(std::size_t salt) const noexcept
 {
-    detail::fnv_1a h(salt);
-    detail::ci_digest(impl().get(id_scheme), h);
-    detail::digest_encoded(impl().get(id_user), h);
-    detail::digest_encoded(impl().get(id_pass), h);
-    detail::ci_digest_encoded(impl().get(id_host), h);
-    h.put(impl().get(id_port));
+    detail::wyhash h(salt);
+    hash_append(h);
+    return static_cast<
+        std::size_t>(h.digest());
+}
+
+template<class HashAlgorithm>
+void
+url_view_base::
+hash_append(HashAlgorithm& h) const noexcept
+{
+    detail::digest_sink s(h);
+    detail::ci_digest(impl().get(id_scheme), s);
+    detail::digest_encoded(impl().get(id_user), s);
+    detail::digest_encoded(impl().get(id_pass), s);
+    detail::ci_digest_encoded(impl().get(id_host), s);
+    s.put(impl().get(id_port));
     detail::normalized_path_digest(
-        impl().get(id_path), is_path_absolute(), h);
-    detail::digest_encoded(impl().get(id_query), h);
-    detail::digest_encoded(impl().get(id_frag), h);
-    return h.digest();
+        impl().get(id_path), is_path_absolute(), s);
+    detail::digest_encoded(impl().get(id_query), s);
+    detail::digest_encoded(impl().get(id_frag), s);
+    s.flush();
 }
 
 //------------------------------------------------
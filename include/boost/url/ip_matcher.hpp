@@ -0,0 +1,294 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IP_MATCHER_HPP
+#define BOOST_URL_IP_MATCHER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/ipv4_network.hpp>
+#include <boost/url/ipv6_network.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A set of IP networks to match addresses against
+
+    Each rule is a network and whether the
+    addresses it contains match. An address
+    is matched by the rule with the longest
+    network containing it, so exceptions can
+    be made inside larger networks, and an
+    address which no rule contains does not
+    match.
+
+    The rules are stored in a compressed
+    radix tree for each address family,
+    where nodes are prefixes and chains of
+    nodes with a single child are merged.
+    The first match after a rule is inserted
+    compiles the trees into tries which
+    consume 6 bits of the address per node,
+    and locate the next node or the result
+    with a population count. Matching reads
+    at most one node per 6 bits of the
+    longest rule containing the address,
+    and only the first match after an
+    insertion allocates.
+
+    IPv4-mapped IPv6 addresses such as
+    "::ffff:127.0.0.1" match like the IPv4
+    address they contain, and rules for
+    networks inside "::ffff:0:0/96" apply to
+    the corresponding IPv4 addresses. Both
+    forms of an address always give the same
+    result, so IPv6 rules for networks which
+    contain "::ffff:0:0/96", such as "::/0",
+    apply to neither.
+
+    @par Example
+    This matcher rejects the hosts of urls
+    which would reach internal services:
+    @code
+    ip_matcher deny;
+    deny.insert( "10.0.0.0/8" );
+    deny.insert( "10.1.2.0/24", false );
+    deny.insert( "127.0.0.0/8" );
+    deny.insert( "169.254.0.0/16" );
+    deny.insert( "::1" );
+    deny.insert( "fc00::/7" );
+
+    assert( deny.matches( url_view( "http://10.9.8.7/" ) ) );
+    assert( ! deny.matches( url_view( "http://10.1.2.3/" ) ) );
+    assert( deny.matches( url_view( "http://[::ffff:127.0.0.1]/" ) ) );
+    assert( ! deny.matches( url_view( "http://93.184.216.34/" ) ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe, except for
+    concurrent calls to const functions.
+
+    @see
+        @ref ipv4_network,
+        @ref ipv6_network.
+*/
+class ip_matcher
+{
+    struct impl;
+    impl* impl_ = nullptr;
+
+public:
+    /** Constructor
+
+        Default constructed matchers have
+        no rules, so no address matches.
+    */
+    BOOST_URL_DECL
+    ip_matcher() noexcept;
+
+    /** Destructor
+    */
+    BOOST_URL_DECL
+    ~ip_matcher();
+
+    /** Constructor
+
+        The rules of `other` are moved,
+        and `other` is left empty.
+
+        @param other The matcher to move from.
+    */
+    BOOST_URL_DECL
+    ip_matcher(ip_matcher&& other) noexcept;
+
+    /** Assignment
+
+        The rules of `other` are moved,
+        and `other` is left empty.
+
+        @param other The matcher to move from.
+        @return A reference to this object.
+    */
+    BOOST_URL_DECL
+    ip_matcher&
+    operator=(ip_matcher&& other) noexcept;
+
+    ip_matcher(ip_matcher const&) = delete;
+    ip_matcher& operator=(ip_matcher const&) = delete;
+
+    /** Return the number of rules
+
+        Inserting a network which already
+        has a rule replaces it.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    size() const noexcept;
+
+    /** Return true if there are no rules
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Remove all rules
+    */
+    BOOST_URL_DECL
+    void
+    clear() noexcept;
+
+    /** Insert a rule for an IPv4 network
+
+        If the network already has a rule,
+        its value is replaced.
+
+        @par Complexity
+        Linear in the number of rules whose
+        network contains `net`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @param net The network.
+
+        @param match `true` if the addresses
+        of the network match.
+    */
+    BOOST_URL_DECL
+    void
+    insert(
+        ipv4_network const& net,
+        bool match = true);
+
+    /** Insert a rule for an IPv6 network
+
+        If the network already has a rule,
+        its value is replaced.
+
+        @par Complexity
+        Linear in the number of rules whose
+        network contains `net`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @param net The network.
+
+        @param match `true` if the addresses
+        of the network match.
+    */
+    BOOST_URL_DECL
+    void
+    insert(
+        ipv6_network const& net,
+        bool match = true);
+
+    /** Insert a rule for a network string
+
+        The string is an IPv4 or IPv6 network
+        in CIDR notation, or a single address
+        without a prefix length.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The input failed to parse correctly.
+
+        @param s The string to parse.
+
+        @param match `true` if the addresses
+        of the network match.
+
+        @see
+            @ref parse_ipv4_network,
+            @ref parse_ipv6_network.
+    */
+    BOOST_URL_DECL
+    void
+    insert(
+        core::string_view s,
+        bool match = true);
+
+    /** Return true if an IPv4 address matches
+
+        @par Complexity
+        Linear in the length of the longest
+        rule containing `addr`, after the
+        first match following an insertion.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param addr The address to match.
+    */
+    BOOST_URL_DECL
+    bool
+    matches(
+        ipv4_address const& addr) const;
+
+    /** Return true if an IPv6 address matches
+
+        @par Complexity
+        Linear in the length of the longest
+        rule containing `addr`, after the
+        first match following an insertion.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param addr The address to match.
+    */
+    BOOST_URL_DECL
+    bool
+    matches(
+        ipv6_address const& addr) const;
+
+    /** Return true if the host of a url matches
+
+        Hosts which are IP addresses are
+        matched, and other hosts never match.
+        Registered names must be resolved by
+        the caller, including names such as
+        "0x7f.1" which some resolvers interpret
+        as IPv4 addresses.
+
+        @par Complexity
+        Linear in the length of the longest
+        rule containing the host address,
+        after the first match following an
+        insertion.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param u The url whose host is matched.
+    */
+    BOOST_URL_DECL
+    bool
+    matches(
+        url_view_base const& u) const;
+};
+
+} // urls
+} // boost
+
+#endif
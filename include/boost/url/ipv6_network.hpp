@@ -0,0 +1,340 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_IPV6_NETWORK_HPP
+#define BOOST_URL_IPV6_NETWORK_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/url/grammar/string_token.hpp>
+#include <cstddef>
+#include <iosfwd>
+
+namespace boost {
+namespace urls {
+
+/** An IP version 6 network
+
+    Objects of this type represent the block
+    of addresses which share their first
+    @ref prefix_length bits with the network
+    @ref address, written in CIDR notation
+    such as "2001:db8::/32". The bits of the
+    network address after the prefix are
+    always zero.
+
+    @par Example
+    @code
+    ipv6_network n( "fe80::/10" );
+    assert( n.contains( ipv6_address( "fe80::1" ) ) );
+    assert( n.netmask() == ipv6_address( "ffc0::" ) );
+    @endcode
+
+    @par BNF
+    @code
+    ipv6-network  = IPv6address "/" prefix-length
+
+    prefix-length = DIGIT / %x31-39 DIGIT / "1" %x30-31 DIGIT / "12" %x30-38
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc4291#section-2.3"
+        >2.3. Text Representation of Address Prefixes (rfc4291)</a>
+
+    @see
+        @ref ip_matcher,
+        @ref ipv4_network,
+        @ref parse_ipv6_network.
+*/
+class ipv6_network
+{
+public:
+    /** The number of characters needed to write any network string
+
+        This is the space which @ref ipv6_address::to_buffer
+        needs, followed by "/128".
+    */
+    static
+    constexpr
+    std::size_t max_str_len =
+        ipv6_address::max_str_len + 4;
+
+    /** Constructor
+
+        Default constructed objects represent
+        the network "::/0", which contains
+        every address.
+    */
+    ipv6_network() = default;
+
+    /** Constructor
+    */
+    ipv6_network(
+        ipv6_network const&) = default;
+
+    /** Copy Assignment
+
+        @param other The object to copy.
+        @return A reference to this object.
+    */
+    ipv6_network&
+    operator=(
+        ipv6_network const& other) = default;
+
+    /** Construct from an address and a prefix length
+
+        The bits of `addr` after the first
+        `prefix_length` bits are cleared, so
+        this constructs the network of an
+        address.
+
+        @par Example
+        @code
+        ipv6_network n( ipv6_address( "2001:db8::1" ), 32 );
+        assert( n.address() == ipv6_address( "2001:db8::" ) );
+        @endcode
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `prefix_length > 128`.
+
+        @param addr An address in the network.
+        @param prefix_length The number of bits
+        of the network prefix.
+    */
+    BOOST_URL_DECL
+    ipv6_network(
+        ipv6_address const& addr,
+        std::size_t prefix_length);
+
+    /** Construct from a string
+
+        This function constructs a network
+        from the string `s`, which must be
+        in CIDR notation. Host bits set in
+        the address are an error.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        The input failed to parse correctly.
+
+        @param s The string to parse.
+
+        @see
+            @ref parse_ipv6_network.
+    */
+    BOOST_URL_DECL
+    explicit
+    ipv6_network(
+        core::string_view s);
+
+    /** Return the network address
+
+        This is the first address of the
+        network.
+    */
+    ipv6_address
+    address() const noexcept
+    {
+        return addr_;
+    }
+
+    /** Return the number of bits of the network prefix
+    */
+    std::size_t
+    prefix_length() const noexcept
+    {
+        return len_;
+    }
+
+    /** Return the network mask
+
+        The mask has the first
+        @ref prefix_length bits set.
+    */
+    BOOST_URL_DECL
+    ipv6_address
+    netmask() const noexcept;
+
+    /** Return true if the network contains an address
+
+        @par Complexity
+        Constant.
+
+        @param addr The address to check.
+    */
+    BOOST_URL_DECL
+    bool
+    contains(
+        ipv6_address const& addr) const noexcept;
+
+    /** Return true if the network contains another network
+
+        A network contains itself and every
+        network with a longer prefix whose
+        addresses it contains.
+
+        @param other The network to check.
+    */
+    BOOST_URL_DECL
+    bool
+    contains(
+        ipv6_network const& other) const noexcept;
+
+    /** Return the network as a string in CIDR notation
+
+        When called with no arguments, the
+        return type is `std::string`.
+        Otherwise, the return type and style
+        of output is determined by which string
+        token is passed.
+
+        @par Example
+        @code
+        assert( ipv6_network( ipv6_address( "fc00::" ), 7 ).to_string() == "fc00::/7" );
+        @endcode
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        String tokens may throw exceptions.
+
+        @return The return type of the string token.
+        If the token parameter is omitted, then
+        a new `std::string` is returned.
+        Otherwise, the function return type
+        is the result type of the token.
+
+        @param token An optional string token.
+    */
+    template<BOOST_URL_STRTOK_TPARAM>
+    BOOST_URL_STRTOK_RETURN
+    to_string(StringToken&& token = {}) const
+    {
+        to_string_impl(token);
+        return token.result();
+    }
+
+    /** Write the network in CIDR notation to a buffer
+
+        The resulting buffer is not null-terminated.
+
+        @throw system_error `dest_size < ipv6_network::max_str_len`
+
+        @return The formatted string
+
+        @param dest The buffer in which to write,
+        which must have at least `dest_size` space.
+
+        @param dest_size The size of the output buffer.
+    */
+    BOOST_URL_DECL
+    core::string_view
+    to_buffer(
+        char* dest,
+        std::size_t dest_size) const;
+
+    /** Return true if two networks are equal
+
+        @param n1 The first network to compare.
+        @param n2 The second network to compare.
+        @return `true` if the networks are equal
+    */
+    friend
+    bool
+    operator==(
+        ipv6_network const& n1,
+        ipv6_network const& n2) noexcept
+    {
+        return
+            n1.addr_ == n2.addr_ &&
+            n1.len_ == n2.len_;
+    }
+
+    /** Return true if two networks are not equal
+
+        @param n1 The first network to compare.
+        @param n2 The second network to compare.
+        @return `true` if the networks are not equal
+    */
+    friend
+    bool
+    operator!=(
+        ipv6_network const& n1,
+        ipv6_network const& n2) noexcept
+    {
+        return !( n1 == n2 );
+    }
+
+/** Format the network to an output stream
+
+    Networks written to output streams
+    are written in CIDR notation.
+
+    @param os The output stream.
+    @param net The network to format.
+    @return The output stream.
+*/
+    friend
+    std::ostream&
+    operator<<(
+        std::ostream& os,
+        ipv6_network const& net)
+    {
+        net.write_ostream(os);
+        return os;
+    }
+
+private:
+    BOOST_URL_DECL void write_ostream(std::ostream&) const;
+
+    BOOST_URL_DECL
+    void
+    to_string_impl(
+        string_token::arg& t) const;
+
+    ipv6_address addr_;
+    unsigned char len_ = 0;
+};
+
+//------------------------------------------------
+
+/** Return an IPv6 network from a string in CIDR notation
+
+    The string is an IPv6 address followed
+    by "/" and a prefix length from 0 to 128,
+    without leading zeroes. The bits of the
+    address after the prefix must be zero.
+
+    @par Example
+    @code
+    system::result< ipv6_network > rv = parse_ipv6_network( "fc00::/7" );
+    @endcode
+
+    @param s The string to parse.
+    @return The parsed network, or an error code.
+
+    @see
+        @ref ipv6_network.
+*/
+BOOST_URL_DECL
+system::result<ipv6_network>
+parse_ipv6_network(
+    core::string_view s) noexcept;
+
+} // urls
+} // boost
+
+#endif
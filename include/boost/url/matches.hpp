@@ -0,0 +1,351 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_MATCHES_HPP
+#define BOOST_URL_MATCHES_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+
+/** The replacement fields matched by a router
+
+    This is the base class of the containers
+    which receive the results of
+    @ref router::find. Each element is the
+    encoded text matched by a replacement
+    field of the route, and can also be
+    looked up by the id of the field.
+
+    Replacement fields with the `uint64`
+    constraint, such as `{id:uint64}`, are
+    also converted to integers while the
+    path is matched. These values are
+    returned by @ref integer.
+
+    @see
+        @ref matches,
+        @ref matches_storage,
+        @ref router.
+*/
+class matches_base
+{
+public:
+    /// The type of an iterator to the matches
+    using iterator = core::string_view*;
+
+    /// The type of an iterator to the matches
+    using const_iterator = core::string_view const*;
+
+    /// An unsigned integer type used to represent size
+    using size_type = std::size_t;
+
+    /// A signed integer type used to represent differences
+    using difference_type = std::ptrdiff_t;
+
+    /// A reference to a match
+    using reference = core::string_view&;
+
+    /// A reference to a match
+    using const_reference = core::string_view const&;
+
+    /// A pointer to a match
+    using pointer = core::string_view*;
+
+    /// A pointer to a match
+    using const_pointer = core::string_view const*;
+
+    /// Constructor
+    matches_base() = default;
+
+    /// Destructor
+    virtual ~matches_base() = default;
+
+    /** Return the matched strings
+    */
+    virtual
+    core::string_view const*
+    matches() const = 0;
+
+    /** Return the ids of the matched fields
+    */
+    virtual
+    core::string_view const*
+    ids() const = 0;
+
+    /** Return the matched strings
+    */
+    virtual
+    core::string_view*
+    matches() = 0;
+
+    /** Return the ids of the matched fields
+    */
+    virtual
+    core::string_view*
+    ids() = 0;
+
+    /** Return the number of matches
+    */
+    virtual
+    std::size_t
+    size() const = 0;
+
+    /** Return the maximum number of matches
+    */
+    virtual
+    std::size_t
+    capacity() const = 0;
+
+    /** Set the number of matches
+    */
+    virtual
+    void
+    resize(std::size_t) = 0;
+
+    /** Return the integer values of the matches
+
+        Containers which do not store the
+        values return a null pointer, and
+        @ref integer throws for them.
+    */
+    virtual
+    std::uint64_t const*
+    values() const
+    {
+        return nullptr;
+    }
+
+    /** Return the integer values of the matches
+
+        Containers which do not store the
+        values return a null pointer.
+    */
+    virtual
+    std::uint64_t*
+    values()
+    {
+        return nullptr;
+    }
+
+    /** Return the match at a position
+
+        @throws std::out_of_range `pos >= size()`
+        @param pos The position
+        @return The match
+    */
+    BOOST_URL_DECL
+    const_reference
+    at( size_type pos ) const;
+
+    /** Return the match for a replacement field id
+
+        @throws std::out_of_range No field has the id
+        @param id The id of the replacement field
+        @return The match
+    */
+    BOOST_URL_DECL
+    const_reference
+    at( core::string_view id ) const;
+
+    /** Return the match at a position
+
+        @par Preconditions
+        @code
+        pos < size()
+        @endcode
+
+        @param pos The position
+        @return The match
+    */
+    BOOST_URL_DECL
+    const_reference
+    operator[]( size_type pos ) const;
+
+    /** Return the match for a replacement field id
+
+        @throws std::out_of_range No field has the id
+        @param id The id of the replacement field
+        @return The match
+    */
+    BOOST_URL_DECL
+    const_reference
+    operator[]( core::string_view id ) const;
+
+    /** Return the integer value of the match at a position
+
+        This is the value of a replacement
+        field with the `uint64` constraint,
+        which is parsed while the path is
+        matched. The value of other fields
+        is zero.
+
+        @throws std::out_of_range `pos >= size()`,
+        or @ref values returns a null pointer
+        @param pos The position
+        @return The value
+    */
+    BOOST_URL_DECL
+    std::uint64_t
+    integer( size_type pos ) const;
+
+    /** Return the integer value of the match for a replacement field id
+
+        This is the value of a replacement
+        field with the `uint64` constraint,
+        which is parsed while the path is
+        matched. The value of other fields
+        is zero.
+
+        @throws std::out_of_range No field has the id,
+        or @ref values returns a null pointer
+        @param id The id of the replacement field
+        @return The value
+    */
+    BOOST_URL_DECL
+    std::uint64_t
+    integer( core::string_view id ) const;
+
+    /** Find the match for a replacement field id
+
+        @param id The id of the replacement field
+        @return An iterator to the match, or `end()`
+    */
+    BOOST_URL_DECL
+    const_iterator
+    find( core::string_view id ) const;
+
+    /** Return an iterator to the first match
+    */
+    BOOST_URL_DECL
+    const_iterator
+    begin() const;
+
+    /** Return an iterator past the last match
+    */
+    BOOST_URL_DECL
+    const_iterator
+    end() const;
+
+    /** Return true if there are no matches
+    */
+    BOOST_URL_DECL
+    bool
+    empty() const noexcept;
+};
+
+/** A container for up to N router matches
+
+    @tparam N The maximum number of matches
+
+    @see
+        @ref matches,
+        @ref router.
+*/
+template <std::size_t N = 20>
+class matches_storage
+    : public matches_base
+{
+    core::string_view matches_storage_[N];
+    core::string_view ids_storage_[N];
+    std::uint64_t values_storage_[N] = {};
+    std::size_t size_ = 0;
+
+    virtual
+    core::string_view*
+    matches() override
+    {
+        return matches_storage_;
+    }
+
+    virtual
+    core::string_view*
+    ids() override
+    {
+        return ids_storage_;
+    }
+
+    virtual
+    std::uint64_t*
+    values() override
+    {
+        return values_storage_;
+    }
+
+public:
+    /// Constructor
+    matches_storage() = default;
+
+    /** Return the matched strings
+    */
+    virtual
+    core::string_view const*
+    matches() const override
+    {
+        return matches_storage_;
+    }
+
+    /** Return the ids of the matched fields
+    */
+    virtual
+    core::string_view const*
+    ids() const override
+    {
+        return ids_storage_;
+    }
+
+    /** Return the integer values of the matches
+    */
+    virtual
+    std::uint64_t const*
+    values() const override
+    {
+        return values_storage_;
+    }
+
+    /** Return the number of matches
+    */
+    virtual
+    std::size_t
+    size() const override
+    {
+        return size_;
+    }
+
+    /** Return the maximum number of matches
+    */
+    virtual
+    std::size_t
+    capacity() const override
+    {
+        return N;
+    }
+
+    /** Set the number of matches
+    */
+    virtual
+    void
+    resize(std::size_t n) override
+    {
+        BOOST_ASSERT(n <= N);
+        size_ = n;
+    }
+};
+
+/// Default container for router matches
+using matches = matches_storage<20>;
+
+} // urls
+} // boost
+
+#endif
@@ -13,6 +13,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/detail/optional_string.hpp>
+#include <boost/url/decode_view.hpp>
 #include <boost/url/pct_string_view.hpp>
 #include <cstddef>
 #include <string>
@@ -970,6 +971,169 @@ private:
 
 //------------------------------------------------
 
+/** A decoded view of a percent-encoded query parameter
+
+    Objects of this type represent a single key
+    and value pair in a query string, where the
+    strings are percent-encoded in the underlying
+    buffer and presented as if all escapes were
+    decoded. Decoding happens on the fly when the
+    strings are iterated or compared, so no memory
+    is allocated to produce or use this view.
+
+    The presence of a value is indicated by
+    @ref has_value equal to true.
+    An empty value is distinct from no value.
+
+    <br>
+
+    Keys and values in this object reference
+    external character buffers.
+    Ownership of the buffers is not transferred;
+    the caller is responsible for ensuring that
+    the assigned buffers remain valid until
+    they are no longer referenced.
+
+    @par Example
+    @code
+    param_decode_view qp( param_pct_view( "first%20name", "John%20Doe" ) );
+
+    assert( qp.key == "first name" );
+    assert( qp.value == "John Doe" );
+    @endcode
+
+    @see
+        @ref param,
+        @ref param_pct_view,
+        @ref decode_view.
+*/
+struct param_decode_view
+{
+    /** The key
+
+        For most usages, key comparisons are
+        case-sensitive and duplicate keys in
+        a query are possible. However, it is
+        the authority that has final control
+        over how the query is interpreted.
+    */
+    decode_view key;
+
+    /** The value
+
+        The presence of a value is indicated by
+        @ref has_value equal to true.
+        An empty value is distinct from no value.
+    */
+    decode_view value;
+
+    /** True if a value is present
+
+        The presence of a value is indicated by
+        `has_value == true`.
+        An empty value is distinct from no value.
+    */
+    bool has_value = false;
+
+    /** Constructor
+
+        Default constructed query parameters
+        have an empty key and no value.
+
+        @par Postconditions
+        @code
+        this->key.empty() && this->value.empty() && this->has_value == false
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    param_decode_view() = default;
+
+    /** Constructor
+
+        This constructs a view of the key and
+        value of `p`, which are decoded using
+        the options in `opt`.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param p The param to reference.
+        @param opt The options for decoding.
+    */
+    explicit
+    param_decode_view(
+        param_pct_view const& p,
+        encoding_opts opt = {}) noexcept
+        : key(p.key, opt)
+        , value(p.value, opt)
+        , has_value(p.has_value)
+    {
+    }
+
+    /** Aggregate construction
+
+        @param key The key
+        @param value The value
+        @param has_value True if a value is present
+     */
+    param_decode_view(
+        decode_view key,
+        decode_view value,
+        bool has_value) noexcept
+        : key(key)
+        , value(has_value
+            ? value
+            : decode_view())
+        , has_value(has_value)
+    {
+    }
+
+    /** Conversion
+
+        This function performs a conversion from
+        a decoded view to an owning param, which
+        holds a decoded copy of the strings.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return A param object
+    */
+    explicit
+    operator
+    param() const
+    {
+        return param(
+            std::string(key.begin(), key.end()),
+            std::string(value.begin(), value.end()),
+            has_value);
+    }
+
+    /** Arrow support
+
+        This operator returns the address of the
+        object so that it can be used in pointer
+        contexts.
+
+        @return A pointer to this object
+     */
+    param_decode_view const*
+    operator->() const noexcept
+    {
+        return this;
+    }
+};
+
+//------------------------------------------------
+
 inline
 param&
 param::
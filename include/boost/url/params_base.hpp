@@ -44,6 +44,7 @@ class BOOST_SYMBOL_VISIBLE params_base
     friend class url_view_base;
     friend class params_ref;
     friend class params_view;
+    friend class params_index;
 
     detail::query_ref ref_;
     encoding_opts opt_;
@@ -93,6 +94,36 @@ public:
     /// @copydoc iterator
     using const_iterator = iterator;
 
+    /** A Bidirectional iterator to a decoded query parameter
+
+        Objects of this type allow iteration
+        through the parameters in the query.
+        Dereferencing yields a
+        @ref param_decode_view, whose strings
+        reference the underlying buffer and
+        are decoded on the fly when they are
+        iterated or compared.
+
+        <br>
+
+        Unlike @ref iterator, nothing is copied
+        or allocated when these iterators are
+        dereferenced, and the returned views
+        remain valid for as long as the
+        underlying buffer is unmodified.
+
+        @see
+            @ref decoded.
+    */
+    class decode_iterator;
+
+    /** A range of decoded query parameters
+
+        This is the type returned by
+        @ref decoded.
+    */
+    class decoded_range;
+
     /** The value type
 
         Values of this type represent parameters
@@ -240,6 +271,35 @@ public:
     iterator
     end() const noexcept;
 
+    /** Return the params as a range of decoded views
+
+        This function returns a range over the
+        same parameters as the container, whose
+        elements are @ref param_decode_view.
+        The strings reference the underlying
+        buffer and are decoded on the fly, using
+        the encoding options of the container,
+        so no memory is allocated when the range
+        is iterated.
+
+        @par Example
+        @code
+        url_view u( "?first=John&last=Doe+Jr" );
+        for( param_decode_view p : u.params().decoded() )
+            assert( p.key == "first" || p.value == "Doe Jr" );
+        @endcode
+
+        @par Complexity
+        Linear in the size of the first param.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return A range of decoded params.
+    */
+    decoded_range
+    decoded() const noexcept;
+
     //--------------------------------------------
 
     /** Return true if a matching key exists
@@ -0,0 +1,278 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARAMS_ENCODED_ARRAY_HPP
+#define BOOST_URL_PARAMS_ENCODED_ARRAY_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/param.hpp>
+#include <boost/url/params_encoded_view.hpp>
+#include <boost/url/detail/index_iterator.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A random access view of encoded query parameters
+
+    Iterators of @ref params_encoded_view
+    are bidirectional: each increment scans the
+    query for the next delimiter, so reaching
+    the k-th parameter is linear in k.
+    This container scans the query once and
+    records where each key and value begins
+    and ends, after which any parameter can be
+    accessed in constant time and iterators
+    are random access.
+
+    Strings returned by this container may
+    contain percent escapes, and reference the
+    same character buffer as the view it was
+    built from.
+
+    @par Example
+    @code
+    url_view u( "?a=1&b=2&c=3" );
+    params_encoded_array pa( u.encoded_params() );
+
+    assert( pa.size() == 3 );
+    assert( pa[1].key == "b" );
+    assert( (pa.end() - 1)->value == "3" );
+    @endcode
+
+    @par Iterator Invalidation
+    Ownership of the character buffer is not
+    transferred; the caller is responsible for
+    ensuring the lifetime of the buffer extends
+    until the container is no longer used. Any
+    modification of the buffer invalidates the
+    container and its iterators.
+
+    @see
+        @ref params_encoded_view,
+        @ref segments_encoded_array.
+*/
+class params_encoded_array
+{
+public:
+    /** The value type
+
+        Values of this type represent a query
+        parameter whose strings may contain
+        percent escapes.
+    */
+    using value_type = param_pct_view;
+
+    /// @copydoc value_type
+    using reference = param_pct_view;
+
+    /// @copydoc value_type
+    using const_reference = param_pct_view;
+
+    /** A Random Access iterator to a query parameter
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __implementation_defined__;
+#else
+    using iterator = detail::index_iterator<
+        params_encoded_array, param_pct_view>;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** An unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        Default-constructed containers have
+        zero elements.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_encoded_array() noexcept = default;
+
+    /** Constructor
+
+        This function scans the params of
+        `ps` once and records their offsets.
+
+        @par Complexity
+        Linear in `ps.buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param ps The params to index.
+    */
+    BOOST_URL_DECL
+    explicit
+    params_encoded_array(
+        params_encoded_view const& ps);
+
+    /** Return the params this container was built from
+
+        @return The view of the params.
+    */
+    params_encoded_view const&
+    view() const noexcept
+    {
+        return ps_;
+    }
+
+    /** Return the referenced character buffer.
+
+        @return The encoded query, without
+        the leading question mark.
+    */
+    pct_string_view
+    buffer() const noexcept
+    {
+        return ps_.buffer();
+    }
+
+    /** Return true if there are no params
+
+        @return `true` if there are no params.
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Return the number of params
+
+        @return The number of params.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return the param at an index
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The param.
+
+        @param i The zero-based index.
+    */
+    param_pct_view
+    operator[](std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < v_.size());
+        entry const& e = v_[i];
+        auto const p = data_ + e.pos;
+        if(! e.has_value)
+            return param_pct_view(
+                make_pct_string_view_unsafe(
+                    p, e.nk, e.dk),
+                {}, false);
+        return param_pct_view(
+            make_pct_string_view_unsafe(
+                p, e.nk, e.dk),
+            make_pct_string_view_unsafe(
+                p + e.nk + 1, e.nv, e.dv),
+            true);
+    }
+
+    /** Return the first param
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @return The first param.
+    */
+    param_pct_view
+    front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    /** Return the last param
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @return The last param.
+    */
+    param_pct_view
+    back() const noexcept
+    {
+        return (*this)[size() - 1];
+    }
+
+    /** Return an iterator to the beginning
+
+        @return An iterator to the first param.
+    */
+    iterator
+    begin() const noexcept
+    {
+        return iterator(*this, 0);
+    }
+
+    /** Return an iterator to the end
+
+        @return An iterator to one past the last param.
+    */
+    iterator
+    end() const noexcept
+    {
+        return iterator(*this, v_.size());
+    }
+
+private:
+    struct entry
+    {
+        std::size_t pos;
+        std::size_t nk;
+        std::size_t dk;
+        std::size_t nv;
+        std::size_t dv;
+        bool has_value;
+    };
+
+    params_encoded_view ps_;
+    char const* data_ = nullptr;
+    std::vector<entry> v_;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -672,6 +672,136 @@ public:
         pct_string_view key,
         ignore_case_param ic = {}) noexcept;
 
+    /** Erase params matching a predicate
+
+        This function removes every param
+        for which `pred` returns `true`. The
+        query is compacted in a single pass,
+        so removing many params costs the
+        same as removing one.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "?id=42&utm_source=x&utm_medium=y" );
+
+        u.encoded_params().remove_if(
+            []( param_pct_view const& p )
+            {
+                return p.key.starts_with( "utm_" );
+            });
+
+        assert( u.encoded_query() == "id=42" );
+        @endcode
+
+        @par Mandates
+        @code
+        std::is_convertible< decltype( pred( *this->begin() ) ), bool >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `pred` propagate.
+        `pred` is applied to every param
+        before any is removed.
+
+        @return The number of params removed
+        from the container.
+
+        @param pred The predicate to apply to
+        each param, in order.
+    */
+    template<class Predicate>
+    std::size_t
+    remove_if(Predicate pred);
+
+    /** Erase params not matching a predicate
+
+        This function removes every param
+        for which `pred` returns `false`. The
+        query is compacted in a single pass.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Complexity
+        Linear in `this->url().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `pred` propagate.
+        `pred` is applied to every param
+        before any is removed.
+
+        @return The number of params removed
+        from the container.
+
+        @param pred The predicate to apply to
+        each param, in order.
+    */
+    template<class Predicate>
+    std::size_t
+    retain(Predicate pred);
+
+    /** Replace the value of every param
+
+        This function calls `f` once for each
+        param, in order, and replaces the
+        value of the param with the result.
+        The new query is measured and written
+        once, and the url is updated with a
+        single edit.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "?a=1&b=2" );
+
+        u.encoded_params().transform_values(
+            []( param_pct_view const& ) -> pct_string_view
+            {
+                return "%2A";
+            });
+
+        assert( u.encoded_query() == "a=%2A&b=%2A" );
+        @endcode
+
+        @par Mandates
+        @code
+        std::is_convertible< decltype( f( *this->begin() ) ), pct_string_view >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        A returned value contains an invalid
+        percent-encoding.
+
+        @param f The function returning the new
+        encoded value of each param. Reserved
+        characters in the result are
+        percent-escaped, and every param
+        has a value afterwards.
+    */
+    template<class Function>
+    void
+    transform_values(Function f);
+
     //--------------------------------------------
 
     /** Replace params
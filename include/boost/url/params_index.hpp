@@ -0,0 +1,289 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARAMS_INDEX_HPP
+#define BOOST_URL_PARAMS_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/ignore_case.hpp>
+#include <boost/url/params_view.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A hash index over the keys of a params view
+
+    Lookups on @ref params_view are linear
+    scans which decode and compare every key.
+    When a query string is long and many keys
+    are looked up, an index can be built once
+    and then used to answer `find`, `contains`,
+    `count` and `get_or` without scanning or
+    decoding the other parameters.
+
+    The index is a flat open-addressed table
+    keyed on a digest of the decoded key.
+    Parameters whose keys are equal when case
+    is ignored share a slot, so lookups with
+    and without @ref ignore_case use the same
+    table.
+
+    @par Example
+    @code
+    url_view u( "/?utm_source=x&id=42&lang=en&id=43" );
+    params_index ix( u.params() );
+
+    assert( (*ix.find( "lang" )).value == "en" );
+    assert( ix.count( "id" ) == 2 );
+    assert( ix.get_or( "ID", "", ignore_case ) == "42" );
+    @endcode
+
+    @par Iterator Invalidation
+    The index references the same character
+    buffer as the view it was built from.
+    Ownership is not transferred; the caller
+    is responsible for ensuring the lifetime
+    of the buffer extends until the index is
+    no longer used. Any modification of the
+    buffer invalidates the index.
+
+    @see
+        @ref params_view.
+*/
+class params_index
+{
+public:
+    /** An iterator to a param in the indexed view
+    */
+    using iterator = params_view::iterator;
+
+    /** Constructor
+
+        Default-constructed indexes refer
+        to an empty view.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    params_index() noexcept = default;
+
+    /** Constructor
+
+        This function builds an index over
+        every parameter in `ps`.
+
+        @par Complexity
+        Linear in `ps.buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param ps The params to index.
+    */
+    BOOST_URL_DECL
+    explicit
+    params_index(
+        params_view const& ps);
+
+    /** Return the indexed params
+
+        @return The view the index was built from.
+    */
+    params_view const&
+    params() const noexcept
+    {
+        return ps_;
+    }
+
+    /** Return the number of indexed params
+
+        @return The number of params.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return true if there are no params
+
+        @return `true` if there are no params.
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Find the first matching key
+
+        This function returns an iterator to
+        the first param in the view whose key
+        matches `key`, or `params().end()` if
+        there is no such param.
+        The comparison is performed as if all
+        escaped characters were decoded first.
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the param.
+
+        @param key The key to match.
+        By default, a case-sensitive
+        comparison is used.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+    */
+    BOOST_URL_DECL
+    iterator
+    find(
+        core::string_view key,
+        ignore_case_param ic = {}) const noexcept;
+
+    /** Return true if a matching key exists
+
+        @par Complexity
+        Linear in `key.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return `true` if a matching key exists.
+
+        @param key The key to match.
+        By default, a case-sensitive
+        comparison is used.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+    */
+    bool
+    contains(
+        core::string_view key,
+        ignore_case_param ic = {}) const noexcept
+    {
+        return find(key, ic) != ps_.end();
+    }
+
+    /** Return the number of matching keys
+
+        @par Complexity
+        Linear in `key.size()` on average.
+        With a case-sensitive comparison, also
+        linear in the number of keys which only
+        differ from `key` by case.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The number of matching keys.
+
+        @param key The key to match.
+        By default, a case-sensitive
+        comparison is used.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, the comparison is
+        case-insensitive.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    count(
+        core::string_view key,
+        ignore_case_param ic = {}) const noexcept;
+
+    /** Return the value for a key or a fallback
+
+        This function returns the decoded value
+        of the first param matching `key`. If no
+        param matches, `value` is returned
+        instead. When the key is found but the
+        param has no value, an empty string is
+        returned.
+
+        @par Complexity
+        Linear in `key.size()` plus the size
+        of the returned value, on average.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return The decoded value or the fallback.
+
+        @param key The key to match.
+
+        @param value The fallback string returned
+        when no matching key exists.
+
+        @param ic Optional case-insensitive compare
+        indicator.
+    */
+    BOOST_URL_DECL
+    std::string
+    get_or(
+        core::string_view key,
+        core::string_view value = {},
+        ignore_case_param ic = {}) const;
+
+private:
+    struct entry
+    {
+        // digest of the lowercase decoded key
+        std::size_t hash;
+        std::size_t pos;
+        std::size_t nk;
+        std::size_t dk;
+        // next param with the same key,
+        // ignoring case, or zero
+        std::size_t next;
+        // number of params in the chain,
+        // only valid for the chain head
+        std::size_t n;
+    };
+
+    std::size_t
+    find_head(
+        core::string_view key) const noexcept;
+
+    pct_string_view
+    key(std::size_t i) const noexcept;
+
+    iterator
+    make_iterator(
+        std::size_t i) const noexcept;
+
+    params_view ps_;
+    std::vector<entry> v_;
+    // one plus the index of each
+    // chain head, or zero if empty
+    std::vector<std::size_t> tab_;
+};
+
+} // urls
+} // boost
+
+#endif
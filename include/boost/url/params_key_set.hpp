@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PARAMS_KEY_SET_HPP
+#define BOOST_URL_PARAMS_KEY_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/ignore_case.hpp>
+#include <boost/url/param.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A fixed set of keys used as a param predicate
+
+    The keys are placed in a table with a
+    perfect hash function, which is found
+    when the set is constructed. Checking a
+    key hashes its decoded characters once,
+    then compares it with the only key which
+    can be equal to it, without decoding the
+    key into a buffer or allocating.
+
+    Objects of this type can be called with
+    a param to filter params by key.
+
+    @par Example
+    @code
+    params_key_set const tracking(
+        { "utm_source", "utm_medium", "utm_campaign", "fbclid" },
+        ignore_case );
+
+    url_view u( "?id=1&UTM_Source=x&q=2" );
+    for( param_pct_view p : filter_params(
+            u.encoded_params(), tracking ) )
+        assert( p.key == "UTM_Source" );
+    @endcode
+
+    @see
+        @ref filter_params,
+        @ref has_key.
+*/
+class params_key_set
+{
+    std::string keys_;
+    std::vector<std::uint32_t> offsets_;
+    std::vector<std::uint32_t> disp_;
+    std::vector<std::uint32_t> slots_;
+    std::uint64_t seed_ = 0;
+    bool ic_ = false;
+
+    BOOST_URL_DECL
+    void
+    build(
+        core::string_view const* keys,
+        std::size_t n);
+
+    template<class FwdIt>
+    void
+    build_range(
+        FwdIt first,
+        FwdIt last)
+    {
+        std::vector<core::string_view> v(
+            first, last);
+        build(v.data(), v.size());
+    }
+
+public:
+    /** Constructor
+
+        Default constructed sets have no keys.
+    */
+    params_key_set() noexcept = default;
+
+    /** Constructor
+
+        The keys are copied. Duplicate keys
+        are stored once.
+
+        @par Complexity
+        Linear in the total size of the keys,
+        on average.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param keys The decoded keys.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, keys are matched without regard
+        to case.
+    */
+    params_key_set(
+        std::initializer_list<
+            core::string_view> keys,
+        ignore_case_param ic = {})
+        : ic_(ic)
+    {
+        build(keys.begin(), keys.size());
+    }
+
+    /** Constructor
+
+        The keys are copied. Duplicate keys
+        are stored once.
+
+        @par Complexity
+        Linear in the total size of the keys,
+        on average.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param first An iterator to the first
+        decoded key.
+
+        @param last An iterator to one past
+        the last decoded key.
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, keys are matched without regard
+        to case.
+    */
+    template<
+        class FwdIt
+#ifndef BOOST_URL_DOCS
+        , class = typename std::enable_if<
+            std::is_convertible<
+                typename std::iterator_traits<
+                    FwdIt>::reference,
+                core::string_view>::value>::type
+#endif
+    >
+    params_key_set(
+        FwdIt first,
+        FwdIt last,
+        ignore_case_param ic = {})
+        : ic_(ic)
+    {
+        build_range(first, last);
+    }
+
+    /** Return the number of keys
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return offsets_.empty() ?
+            0 : offsets_.size() - 1;
+    }
+
+    /** Return true if there are no keys
+    */
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Return true if a decoded key is in the set
+
+        @par Complexity
+        Linear in `key.size()`.
+
+        @param key The decoded key
+    */
+    BOOST_URL_DECL
+    bool
+    contains(
+        core::string_view key) const noexcept;
+
+    /** Return true if a decoded key is in the set
+
+        @par Complexity
+        Linear in `key.size()`.
+
+        @param key The key
+    */
+    BOOST_URL_DECL
+    bool
+    contains(
+        decode_view const& key) const noexcept;
+
+    /// Return true if the key of p is in the set
+    bool
+    operator()(param_pct_view const& p) const noexcept
+    {
+        return contains(*p.key);
+    }
+
+    /// Return true if the key of p is in the set
+    bool
+    operator()(param_decode_view const& p) const noexcept
+    {
+        return contains(p.key);
+    }
+
+    /// Return true if the key of p is in the set
+    bool
+    operator()(param_view const& p) const noexcept
+    {
+        return contains(p.key);
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -663,6 +663,145 @@ public:
         core::string_view key,
         ignore_case_param ic = {}) noexcept;
 
+    /** Erase elements matching a predicate
+
+        This function removes every element
+        for which `pred` returns `true`. The
+        query is compacted in a single pass,
+        so removing many params costs the
+        same as removing one.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "?id=42&utm_source=x&utm_medium=y" );
+
+        u.params().remove_if(
+            []( param_view const& p )
+            {
+                return p.key.starts_with( "utm_" );
+            });
+
+        assert( u.encoded_query() == "id=42" );
+        @endcode
+
+        @par Mandates
+        @code
+        std::is_convertible< decltype( pred( *this->begin() ) ), bool >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `pred` propagate.
+        `pred` is applied to every param
+        before any is removed.
+
+        @return The number of elements removed
+        from the container.
+
+        @param pred The predicate to apply to
+        each decoded param, in order.
+    */
+    template<class Predicate>
+    std::size_t
+    remove_if(Predicate pred);
+
+    /** Erase elements not matching a predicate
+
+        This function removes every element
+        for which `pred` returns `false`. The
+        query is compacted in a single pass.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "?id=42&utm_source=x&page=2" );
+
+        u.params().retain(
+            []( param_view const& p )
+            {
+                return p.key == "id" || p.key == "page";
+            });
+
+        assert( u.encoded_query() == "id=42&page=2" );
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `pred` propagate.
+        `pred` is applied to every param
+        before any is removed.
+
+        @return The number of elements removed
+        from the container.
+
+        @param pred The predicate to apply to
+        each decoded param, in order.
+    */
+    template<class Predicate>
+    std::size_t
+    retain(Predicate pred);
+
+    /** Replace the value of every element
+
+        This function calls `f` once for each
+        element, in order, and replaces the
+        value of the element with the result.
+        The new query is measured and written
+        once, and the url is updated with a
+        single edit.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "?a=1&b&c=3" );
+
+        u.params().transform_values(
+            []( param_view const& p ) -> core::string_view
+            {
+                return p.has_value ? "x" : "";
+            });
+
+        assert( u.encoded_query() == "a=x&b=&c=x" );
+        @endcode
+
+        @par Mandates
+        @code
+        std::is_convertible< decltype( f( *this->begin() ) ), core::string_view >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `f` propagate.
+
+        @param f The function returning the new
+        plain value of each param. Reserved
+        characters in the result are
+        percent-escaped, and every element
+        has a value afterwards.
+    */
+    template<class Function>
+    void
+    transform_values(Function f);
+
     //--------------------------------------------
 
     /** Replace elements
@@ -0,0 +1,181 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PREPARED_BASE_HPP
+#define BOOST_URL_PREPARED_BASE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/grammar/recycled.hpp>
+#include <boost/url/grammar/string_token.hpp>
+#include <boost/system/result.hpp>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+/** A base url prepared for resolving many references
+
+    This class holds a copy of a base url,
+    along with its normalized path and the
+    normalized directory which relative
+    references are merged with.
+    Resolving a reference against it only
+    performs the work which depends on the
+    reference: the scheme and authority are
+    copied as-is, and the merged path only
+    needs dot segments removed from the
+    reference part.
+
+    The results are identical to calling
+    @ref resolve with the original base.
+    When the base has an authority and the
+    reference has neither a scheme nor an
+    authority, the result is written directly
+    into the destination, which does not
+    allocate once the destination has enough
+    capacity. Other cases fall back to
+    @ref url_base::resolve.
+
+    @par Example
+    @code
+    prepared_base base( url_view( "http://a/b/c/d;p?q" ) );
+    url dest;
+
+    for( core::string_view s : { "g", "../g", "?y", "#s" } )
+    {
+        base.resolve( url_view( s ), dest ).value();
+        // ...
+    }
+    @endcode
+
+    @par Specification
+    <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-5"
+        >5. Reference Resolution (rfc3986)</a>
+
+    @see
+        @ref resolve,
+        @ref url_base::resolve.
+*/
+class prepared_base
+{
+    url base_;
+    std::string path_;
+    std::string dir_;
+    std::size_t path_nseg_ = 0;
+    std::size_t path_dn_ = 0;
+    bool fast_ = false;
+
+public:
+    /** Constructor
+
+        Default-constructed objects hold an
+        empty base, which has no scheme.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    prepared_base() noexcept = default;
+
+    /** Constructor
+
+        This function makes a copy of `base`
+        and of its normalized path and
+        directory.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param base The base url.
+    */
+    BOOST_URL_DECL
+    explicit
+    prepared_base(
+        url_view_base const& base);
+
+    /** Return the base url
+    */
+    url_view
+    base() const noexcept
+    {
+        return base_;
+    }
+
+    /** Resolve a reference into a url
+
+        This function places the result of
+        resolving `ref` against the base
+        into `dest`.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @return An empty result upon success,
+        otherwise an error code if the base
+        has no scheme.
+
+        @param ref The URL reference to resolve.
+
+        @param dest The container where the
+        result is written, upon success.
+
+        @see
+            @ref resolve.
+    */
+    BOOST_URL_DECL
+    system::result<void>
+    resolve(
+        url_view_base const& ref,
+        url_base& dest) const;
+
+    /** Resolve a reference into a string
+
+        This function resolves `ref` against
+        the base and returns the result as
+        a string produced by `token`. The
+        url is built in a recycled scratch
+        url, so that only the token may
+        allocate once warmed up.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return The string, or an error code
+        if the base has no scheme.
+
+        @param ref The URL reference to resolve.
+
+        @param token A string token.
+    */
+    template<BOOST_URL_STRTOK_TPARAM>
+    system::result<BOOST_URL_STRTOK_RETURN>
+    resolve(
+        url_view_base const& ref,
+        BOOST_URL_STRTOK_ARG(token)) const
+    {
+        grammar::recycled_ptr<url> u;
+        auto rv = resolve(ref, *u);
+        if(! rv)
+            return rv.error();
+        auto const s = u->buffer();
+        char* dest = token.prepare(s.size());
+        if(! s.empty())
+            std::memcpy(dest, s.data(), s.size());
+        return token.result();
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,263 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_PUBLIC_SUFFIX_LIST_HPP
+#define BOOST_URL_PUBLIC_SUFFIX_LIST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A compiled Public Suffix List
+
+    The Public Suffix List enumerates the
+    domain suffixes under which anyone can
+    register names, such as `com` or `co.uk`.
+    It determines the part of a host which
+    is controlled by a single registrant,
+    which is used to scope cookies and to
+    group urls by site.
+
+    The rules are compiled into a trie of
+    the labels of each rule, from right to
+    left. Finding the suffix of a host walks
+    the trie once, one label at a time, and
+    never allocates.
+
+    The trie is stored in a single buffer
+    of bytes which contains no pointers. It
+    can be saved to a file with @ref data,
+    and used later with @ref load without
+    copying, for instance from a mapped file.
+
+    @par Example
+    @code
+    std::ifstream f( "public_suffix_list.dat" );
+    std::string s(
+        std::istreambuf_iterator< char >( f ), {} );
+    public_suffix_list psl =
+        public_suffix_list::compile( s );
+
+    url_view u( "https://www.example.co.uk/" );
+    assert( psl.public_suffix( u ) == "co.uk" );
+    assert( psl.registrable_domain( u ) == "example.co.uk" );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe, except for
+    concurrent calls to const functions.
+
+    @par Specification
+    @li <a href="https://publicsuffix.org/list/"
+        >Public Suffix List</a>
+*/
+class public_suffix_list
+{
+    std::vector<unsigned char> storage_;
+    unsigned char const* data_ = nullptr;
+    std::size_t size_ = 0;
+
+    BOOST_URL_DECL
+    std::size_t
+    find(core::string_view host) const noexcept;
+
+public:
+    /** Constructor
+
+        Default constructed lists have no rules,
+        so the public suffix of every host is
+        its last label.
+    */
+    BOOST_URL_DECL
+    public_suffix_list() noexcept;
+
+    /// Constructor
+    BOOST_URL_DECL
+    public_suffix_list(
+        public_suffix_list const& other);
+
+    /// Constructor
+    BOOST_URL_DECL
+    public_suffix_list(
+        public_suffix_list&& other) noexcept;
+
+    /// Assignment
+    BOOST_URL_DECL
+    public_suffix_list&
+    operator=(public_suffix_list const& other);
+
+    /// Assignment
+    BOOST_URL_DECL
+    public_suffix_list&
+    operator=(public_suffix_list&& other) noexcept;
+
+    /** Compile the text of a Public Suffix List
+
+        The text has one rule per line, in
+        the format of `public_suffix_list.dat`.
+        Lines starting with `//` and empty lines
+        are ignored, and a rule ends at the
+        first whitespace.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        A rule has an empty label, a label longer
+        than 255 bytes, or a `*` which is not the
+        leftmost label.
+
+        @param text The rules
+    */
+    BOOST_URL_DECL
+    static
+    public_suffix_list
+    compile(core::string_view text);
+
+    /** Use a compiled list stored in a buffer
+
+        The buffer is not copied, and it
+        must remain valid while the list or
+        any copy of it is in use. The buffer
+        is validated once, so a corrupted file
+        cannot cause lookups to read outside
+        of the buffer.
+
+        @par Exception Safety
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        The buffer is not a compiled list.
+
+        @param data A pointer to the buffer
+        @param size The size of the buffer
+
+        @see @ref data.
+    */
+    BOOST_URL_DECL
+    static
+    public_suffix_list
+    load(
+        void const* data,
+        std::size_t size);
+
+    /** Return the compiled list
+
+        The bytes can be saved and used later
+        with @ref load. They do not depend on
+        the address of the buffer or the byte
+        order of the platform.
+    */
+    core::string_view
+    data() const noexcept
+    {
+        return core::string_view(
+            reinterpret_cast<
+                char const*>(data_), size_);
+    }
+
+    /** Return the public suffix of a host
+
+        The host is an encoded registered name,
+        where percent-encoded octets and upper
+        case letters match the rules like their
+        decoded, lower case equivalents. A single
+        trailing dot is ignored.
+
+        When no rule matches, the public suffix
+        is the last label of the host, as in the
+        implicit `*` rule.
+
+        @par Complexity
+        Linear in the number of labels of `host`.
+
+        @return A subview of `host`, or an
+        empty string if `host` is empty or ends
+        with an empty label.
+
+        @param host The encoded host
+    */
+    core::string_view
+    public_suffix(
+        core::string_view host) const noexcept
+    {
+        std::size_t const pos = find(host);
+        if (pos == core::string_view::npos)
+            return {};
+        return host.substr(pos,
+            host.size() - (host.ends_with('.') ? 1 : 0) - pos);
+    }
+
+    /** Return the public suffix of the host of a url
+
+        @return A subview of the encoded host of
+        `u`, or an empty string if the host is not
+        a registered name.
+
+        @param u The url
+    */
+    core::string_view
+    public_suffix(
+        url_view_base const& u) const noexcept
+    {
+        if (u.host_type() != host_type::name)
+            return {};
+        return public_suffix(u.encoded_host());
+    }
+
+    /** Return the registrable domain of a host
+
+        The registrable domain is the public
+        suffix with one more label, which is
+        the part of the host controlled by a
+        single registrant.
+
+        @par Complexity
+        Linear in the number of labels of `host`.
+
+        @return A subview of `host`, or an
+        empty string if `host` is itself a
+        public suffix.
+
+        @param host The encoded host
+    */
+    BOOST_URL_DECL
+    core::string_view
+    registrable_domain(
+        core::string_view host) const noexcept;
+
+    /** Return the registrable domain of the host of a url
+
+        @return A subview of the encoded host of
+        `u`, or an empty string if the host is not
+        a registered name or is a public suffix.
+
+        @param u The url
+    */
+    core::string_view
+    registrable_domain(
+        url_view_base const& u) const noexcept
+    {
+        if (u.host_type() != host_type::name)
+            return {};
+        return registrable_domain(u.encoded_host());
+    }
+};
+
+} // urls
+} // boost
+
+#endif
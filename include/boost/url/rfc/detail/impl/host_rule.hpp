@@ -15,6 +15,7 @@
 #include <boost/url/rfc/ipv4_address_rule.hpp>
 #include <boost/url/rfc/detail/ip_literal_rule.hpp>
 #include <boost/url/rfc/detail/reg_name_rule.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <cstring>
 
@@ -75,59 +76,71 @@ parse(
         return t;
     }
 
-    // IPv4address
+    // reg-name, which includes every
+    // IPv4address, so one scan classifies
+    // the host and counts its decoded size
+    auto rv = grammar::parse(
+        it, end,
+        detail::reg_name_rule);
+    char const* const it1 = it;
+    if(! rv)
     {
-        auto rv = grammar::parse(
-            it, end, ipv4_address_rule);
-        if( rv )
+        // an IPv4address followed by a
+        // bad escape is still a host, and
+        // the escape is left to the caller
+        it = it0;
+        auto rv4 = grammar::parse(
+            it, it1, ipv4_address_rule);
+        if(! rv4)
+        {
+            it = it1;
+            return rv.error();
+        }
+        auto const b =
+            rv4->to_bytes();
+        std::memcpy(
+            t.addr,
+            b.data(),
+            b.size());
+        t.host_type =
+            urls::host_type::ipv4;
+        t.match = make_pct_string_view_unsafe(
+            it0, it - it0, it - it0);
+        return t;
+    }
+
+    // IPv4address, when it is the whole
+    // name; it has at most 15 chars and
+    // no escapes
+    if( rv->size() <= 15 &&
+        rv->decoded_size() == rv->size() &&
+        grammar::digit_chars(*it0))
+    {
+        it = it0;
+        auto rv4 = grammar::parse(
+            it, it1, ipv4_address_rule);
+        if( rv4 &&
+            it == it1)
         {
-            auto it02 = it;
-            auto rv2 = grammar::parse(
-                it, end,
-                detail::reg_name_rule);
-            if (rv2.has_value() &&
-                !rv2->empty())
-            {
-                auto dn = static_cast<
-                    std::size_t>(it02 - it0) +
-                    rv2->decoded_size();
-                t.name = make_pct_string_view_unsafe(
-                    it0, it - it0, dn);
-                t.host_type =
-                    urls::host_type::name;
-                t.match = t.name;
-                return t;
-            }
-            it = it02;
             auto const b =
-                rv->to_bytes();
+                rv4->to_bytes();
             std::memcpy(
                 t.addr,
                 b.data(),
                 b.size());
             t.host_type =
                 urls::host_type::ipv4;
-            t.match = make_pct_string_view_unsafe(
-                it0, it - it0, it - it0);
+            t.match = *rv;
             return t;
         }
-
-        it = it0; // rewind
+        it = it1;
     }
 
-    // reg-name
-    {
-        auto rv = grammar::parse(
-            it, end,
-            detail::reg_name_rule);
-        if(! rv)
-            return rv.error();
-        t.name = *rv;
-        t.host_type =
-            urls::host_type::name;
-        t.match = *rv;
-        return t;
-    }
+    t.name = *rv;
+    t.host_type =
+        urls::host_type::name;
+    t.match = *rv;
+    return t;
 }
 
 } // detail
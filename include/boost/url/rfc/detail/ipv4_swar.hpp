@@ -0,0 +1,186 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_RFC_DETAIL_IPV4_SWAR_HPP
+#define BOOST_URL_RFC_DETAIL_IPV4_SWAR_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Load eight bytes as a little-endian
+// word, independently of the platform
+inline
+std::uint64_t
+ipv4_swar_load(
+    unsigned char const* p) noexcept
+{
+    return
+        std::uint64_t(p[0])       |
+        std::uint64_t(p[1]) <<  8 |
+        std::uint64_t(p[2]) << 16 |
+        std::uint64_t(p[3]) << 24 |
+        std::uint64_t(p[4]) << 32 |
+        std::uint64_t(p[5]) << 40 |
+        std::uint64_t(p[6]) << 48 |
+        std::uint64_t(p[7]) << 56;
+}
+
+// Gather the high bit of each byte
+// into bit i of the result
+inline
+unsigned
+ipv4_swar_movemask(
+    std::uint64_t m) noexcept
+{
+    return static_cast<unsigned>(
+        ((m >> 7) * 0x0102040810204080ULL) >> 56);
+}
+
+// Mask of the bytes which are DIGIT
+inline
+unsigned
+ipv4_swar_digits(
+    std::uint64_t x) noexcept
+{
+    std::uint64_t const y =
+        x & 0x7F7F7F7F7F7F7F7FULL;
+    // high bit set when the byte
+    // is >= '0' and < ':'
+    return ipv4_swar_movemask(
+        (y + 0x5050505050505050ULL) &
+        ~(y + 0x4646464646464646ULL) &
+        ~x & 0x8080808080808080ULL);
+}
+
+// Mask of the bytes which are '.'
+inline
+unsigned
+ipv4_swar_dots(
+    std::uint64_t x) noexcept
+{
+    std::uint64_t const y =
+        x ^ 0x2E2E2E2E2E2E2E2EULL;
+    return ipv4_swar_movemask(~(
+        ((y & 0x7F7F7F7F7F7F7F7FULL) +
+            0x7F7F7F7F7F7F7F7FULL) | y) &
+        0x8080808080808080ULL);
+}
+
+/*  Recognize a dotted-quad at the start of a string
+
+    Up to 16 bytes are loaded into two
+    words, the digits and dots are found
+    with masks, and each octet is converted
+    from three digits at once. This accepts
+    exactly the prefixes which a sequence
+    of four dec-octet separated by dots
+    accepts.
+
+    Returns the number of characters of the
+    address, after storing its octets in
+    `v`, or zero when the input is not an
+    address or it needs the diagnostics of
+    the scalar parser.
+*/
+inline
+std::size_t
+parse_ipv4_swar(
+    char const* it,
+    char const* end,
+    unsigned char* v) noexcept
+{
+    // three '0' in front let every octet
+    // be read as three digits, and bytes
+    // after the input are not digits
+    unsigned char buf[3 + 16];
+    buf[0] = '0';
+    buf[1] = '0';
+    buf[2] = '0';
+    unsigned char* const p = buf + 3;
+    std::size_t n = static_cast<
+        std::size_t>(end - it);
+    if(n > 16)
+        n = 16;
+    std::memcpy(p, it, n);
+    std::memset(p + n, 0, 16 - n);
+
+    std::uint64_t const lo = ipv4_swar_load(p);
+    std::uint64_t const hi = ipv4_swar_load(p + 8);
+    // bits 16 to 19 stop the scan when
+    // fewer than four loaded bytes are
+    // not digits
+    unsigned m = ~(
+        ipv4_swar_digits(lo) |
+        ipv4_swar_digits(hi) << 8) & 0xFFFFF;
+    unsigned const dots =
+        ipv4_swar_dots(lo) |
+        ipv4_swar_dots(hi) << 8;
+
+    // the first four bytes which are not
+    // digits end the octets; the first
+    // three of them must be dots
+    unsigned e[4];
+    for(int i = 0; i < 4; ++i)
+    {
+        e[i] = static_cast<unsigned>(
+            boost::core::countr_zero(m));
+        m &= m - 1;
+    }
+    unsigned const l[4] = {
+        e[0],
+        e[1] - e[0] - 1,
+        e[2] - e[1] - 1,
+        e[3] - e[2] - 1 };
+    if( ((dots >> e[0]) &
+         (dots >> e[1]) &
+         (dots >> e[2]) & 1) == 0 ||
+        l[0] - 1 >= 3 ||
+        l[1] - 1 >= 3 ||
+        l[2] - 1 >= 3 ||
+        l[3] - 1 >= 3)
+        return 0;
+
+    static constexpr std::uint32_t keep[4] = {
+        0, 0xFF0000, 0xFFFF00, 0xFFFFFF };
+    bool ok = true;
+    for(int i = 0; i < 4; ++i)
+    {
+        // digits outside the octet were
+        // read too, the mask clears them
+        unsigned char const* q = p + e[i] - 3;
+        std::uint32_t const d = (
+            (std::uint32_t(q[0])       |
+             std::uint32_t(q[1]) <<  8 |
+             std::uint32_t(q[2]) << 16) ^
+            0x303030) & keep[l[i]];
+        std::uint32_t const x =
+            ((d & 0xFF) * 10 +
+                (d >> 8 & 0xFF)) * 10 +
+            (d >> 16);
+        ok &= x <= 255;
+        ok &= l[i] < 2 || q[3 - l[i]] != '0';
+        v[i] = static_cast<unsigned char>(x);
+    }
+    if(! ok)
+        return 0;
+    return e[3];
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_RFC_DETAIL_IPV6_FAST_HPP
+#define BOOST_URL_RFC_DETAIL_IPV6_FAST_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/rfc/detail/ipv4_swar.hpp>
+#include <cstddef>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The value of a HEXDIG, or 16
+inline
+unsigned
+ipv6_hexdig(char c) noexcept
+{
+    static constexpr unsigned char tab[256] = {
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 16, 16, 16, 16, 16, 16,
+        16, 10, 11, 12, 13, 14, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 10, 11, 12, 13, 14, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16 };
+    return tab[static_cast<unsigned char>(c)];
+}
+
+/*  Recognize an IPv6address at the start of a string
+
+    The address is read in a single pass,
+    where each char of an h16 is converted
+    with a table lookup instead of building
+    a result per h16, and an ls32 in dotted
+    form is converted with parse_ipv4_swar.
+    This accepts the prefixes which the
+    ipv6_address_rule accepts, when they
+    are followed by a char which cannot
+    continue the address.
+
+    Returns the number of characters of the
+    address, after storing its bytes in `v`,
+    or zero when the input is not an address
+    or it needs the diagnostics of the
+    scalar parser.
+*/
+inline
+std::size_t
+parse_ipv6_fast(
+    char const* const first,
+    char const* const end,
+    unsigned char* v) noexcept
+{
+    unsigned short w[8];
+    unsigned char b4[4];
+    // the number of words, and the
+    // number of words before "::"
+    int n = 0;
+    int dc = -1;
+    bool v4 = false;
+    char const* p = first;
+    if( end - p >= 2 &&
+        p[0] == ':' &&
+        p[1] == ':')
+    {
+        dc = 0;
+        p += 2;
+    }
+    for(;;)
+    {
+        char const* q = p;
+        unsigned x = 0;
+        unsigned d;
+        if( q != end &&
+            (d = ipv6_hexdig(*q)) < 16)
+        {
+            x = d;
+            ++q;
+            if( q != end &&
+                (d = ipv6_hexdig(*q)) < 16)
+            {
+                x = x * 16 + d;
+                ++q;
+                if( q != end &&
+                    (d = ipv6_hexdig(*q)) < 16)
+                {
+                    x = x * 16 + d;
+                    ++q;
+                    if( q != end &&
+                        (d = ipv6_hexdig(*q)) < 16)
+                    {
+                        x = x * 16 + d;
+                        ++q;
+                    }
+                }
+            }
+        }
+        if(q == p)
+        {
+            // only "::" may end the address
+            if( dc != n || (
+                q != end && (
+                    *q == ':' ||
+                    *q == '.')))
+                return 0;
+            break;
+        }
+        if(q != end)
+        {
+            if(*q == '.')
+            {
+                std::size_t const len =
+                    parse_ipv4_swar(p, end, b4);
+                if(len == 0)
+                    return 0;
+                q = p + len;
+                if( q != end && (
+                    ipv6_hexdig(*q) < 16 ||
+                    *q == ':' ||
+                    *q == '.'))
+                    return 0;
+                p = q;
+                n += 2;
+                v4 = true;
+                break;
+            }
+            if(ipv6_hexdig(*q) < 16)
+                return 0;
+        }
+        if(n == 8)
+            return 0;
+        w[n++] = static_cast<
+            unsigned short>(x);
+        p = q;
+        if( p == end ||
+            *p != ':')
+            break;
+        if( end - p >= 2 &&
+            p[1] == ':')
+        {
+            if(dc >= 0)
+                return 0;
+            dc = n;
+            p += 2;
+        }
+        else
+        {
+            ++p;
+        }
+    }
+    // "::" stands for at least one word
+    if(dc < 0 ? n != 8 : n > 7)
+        return 0;
+
+    int const words = v4 ? n - 2 : n;
+    int const nl = dc < 0 ? words : dc;
+    std::memset(v, 0, 16);
+    for(int i = 0; i < words; ++i)
+    {
+        int const j = i < nl ?
+            i : i + 8 - n;
+        v[2 * j] = static_cast<
+            unsigned char>(w[i] >> 8);
+        v[2 * j + 1] = static_cast<
+            unsigned char>(w[i] & 0xff);
+    }
+    if(v4)
+        std::memcpy(v + 12, b4, 4);
+    return static_cast<
+        std::size_t>(p - first);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -16,6 +16,7 @@
 #include <boost/url/grammar/dec_octet_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/rfc/detail/ipv4_swar.hpp>
 
 namespace boost {
 namespace urls {
@@ -30,6 +31,29 @@ parse(
     system::result<value_type>
 {
     using namespace grammar;
+    // reg-name hosts fail
+    // on the first char
+    if( it == end ||
+        *it < '0' ||
+        *it > '9')
+    {
+        BOOST_URL_CONSTEXPR_RETURN_EC(
+            grammar::error::mismatch);
+    }
+#if defined(BOOST_URL_HAS_CXX20_CONSTEXPR)
+    if (! __builtin_is_constant_evaluated())
+#endif
+    {
+        std::array<unsigned char, 4> v;
+        std::size_t const n =
+            urls::detail::parse_ipv4_swar(
+                it, end, v.data());
+        if(n != 0)
+        {
+            it += n;
+            return ipv4_address(v);
+        }
+    }
     auto rv = grammar::parse(
         it, end, tuple_rule(
             dec_octet_rule, squelch(delim_rule('.')),
@@ -14,6 +14,7 @@
 #include <boost/url/detail/config.hpp>
 #include <boost/url/rfc/ipv4_address_rule.hpp>
 #include <boost/url/rfc/detail/h16_rule.hpp>
+#include <boost/url/rfc/detail/ipv6_fast.hpp>
 #include <boost/url/grammar/charset.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/url/grammar/error.hpp>
@@ -59,6 +60,20 @@ parse(
         ) const noexcept ->
     system::result<ipv6_address>
 {
+#if defined(BOOST_URL_HAS_CXX20_CONSTEXPR)
+    if (! __builtin_is_constant_evaluated())
+#endif
+    {
+        ipv6_address::bytes_type v;
+        std::size_t const len =
+            detail::parse_ipv6_fast(
+                it, end, v.data());
+        if(len != 0)
+        {
+            it += len;
+            return ipv6_address{v};
+        }
+    }
     int n = 8;      // words needed
     int b = -1;     // value of n
                     // when '::' seen
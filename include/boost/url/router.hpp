@@ -0,0 +1,233 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_ROUTER_HPP
+#define BOOST_URL_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/matches.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/detail/router.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+template <class T>
+class concurrent_router;
+
+/** A URL router.
+
+    This container matches static and dynamic
+    URL requests to an object which represents
+    how the it should be handled. These
+    values are usually callback functions.
+
+    A route is a path where each segment is
+    either a literal or a replacement field.
+    A replacement field can have a modifier:
+
+    @li `{id}` matches one segment
+    @li `{id?}` matches zero or one segment
+    @li `{id*}` matches zero or more segments
+    @li `{id+}` matches one or more segments
+
+    A replacement field with no modifier or
+    the `?` modifier can also have a
+    constraint, as in `{id:uint64}` or
+    `{id:uint64?}`. A segment only matches
+    the field if it satisfies the
+    constraint, which is checked while the
+    path is matched, so a branch of the
+    routes is discarded as soon as one of
+    its segments does not match:
+
+    @li `digits` one or more digits
+    @li `uint64` an integer which fits in
+        `std::uint64_t`, without extra
+        leading zeroes. The value is stored
+        in the matches, see @ref matches_base::integer.
+    @li `alpha` one or more letters
+    @li `alnum` one or more letters or digits
+    @li `hex` one or more hexadecimal digits
+    @li `uuid` a UUID, as in
+        `f81d4fae-7dec-11d0-a765-00a0c91e6bf6`
+    @li any rule added with @ref add_rule
+
+    When more than one route matches a path,
+    literal segments take precedence over
+    replacement fields, replacement fields
+    with a constraint take precedence over
+    the ones without a constraint, and
+    replacement fields without a modifier
+    take precedence over the ones with a
+    modifier.
+
+    The routes are frozen into a flat trie
+    by the first lookup after an insertion.
+    Every node is stored in one contiguous
+    array, the literal children of a node are
+    sorted for binary search, and the
+    resources are stored in one array.
+
+    @par Example
+    @code
+    router< int > r;
+    r.insert( "/user/{name}", 1 );
+    r.insert( "/user/{name}/repos/{repo}", 2 );
+
+    matches m;
+    int const* v = r.find( "/user/johndoe/repos/url", m );
+    assert( v && *v == 2 );
+    assert( m["repo"] == "url" );
+    @endcode
+
+    @tparam T type of resource associated with
+    each path template
+
+    @par Exception Safety
+
+    @li Functions marked `noexcept` provide the
+    no-throw guarantee, otherwise:
+
+    @li Functions which throw offer the strong
+    exception safety guarantee.
+
+    @see
+        @ref matches,
+        @ref parse_path.
+*/
+template <class T>
+class router
+    : private detail::router_base
+{
+    template <class U>
+    friend class concurrent_router;
+
+    std::vector<T> values_;
+
+public:
+    /// Constructor
+    router() = default;
+
+    router(router const&) = delete;
+    router& operator=(router const&) = delete;
+
+    /// Constructor
+    router(router&&) noexcept = default;
+
+    /// Assignment
+    router& operator=(router&&) noexcept = default;
+
+    /** Return the number of routes
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return values_.size();
+    }
+
+    /** Route the specified URL path to a resource
+
+        If the route already exists, its
+        resource is replaced.
+
+        Pointers returned by @ref find are
+        invalidated.
+
+        @par Exception Safety
+        Strong guarantee, when the move
+        assignment of `T` does not throw.
+        Otherwise, basic guarantee when an
+        existing resource is replaced.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        `pattern` is not a valid route.
+
+        @param pattern A url path with dynamic segments
+        @param v A resource the path corresponds to
+     */
+    template <class U>
+    void
+    insert(core::string_view pattern, U&& v);
+
+    /** Add a rule which constrains replacement fields
+
+        After this call, replacement fields
+        such as `{id:name}` only match the
+        segments which match the rule.
+        The rule is applied to the encoded
+        segment and must match all of it.
+
+        Routes which use the rule can only be
+        inserted after it is added.
+
+        @par Example
+        @code
+        router< int > r;
+        r.add_rule( "ipv4", ipv4_address_rule );
+        r.insert( "/hosts/{host:ipv4}", 1 );
+        @endcode
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        `name` is empty, contains characters
+        other than letters, digits, `-` and
+        `_`, or is already the name of a rule.
+
+        @param name The name of the rule
+        @param r The rule. Its `parse`
+        function must not throw.
+     */
+    template <class Rule>
+    void
+    add_rule(
+        core::string_view name,
+        Rule const& r);
+
+    /** Match URL path to the corresponding resource
+
+        The first call after an insertion
+        freezes the routes into the flat
+        trie. This function can be called
+        concurrently from many threads.
+
+        @par Preconditions
+        No route has more replacement fields
+        than `N`.
+
+        @par Exception Safety
+        Calls to allocate may throw on the first
+        call after an insertion.
+
+        @param path Request path
+        @param m The match results
+        @return A pointer to the resource, or
+        `nullptr` if no route matches `path`
+     */
+    template <std::size_t N>
+    T const*
+    find(
+        segments_encoded_view path,
+        matches_storage<N>& m) const;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/router.hpp>
+
+#endif
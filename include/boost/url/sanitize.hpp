@@ -0,0 +1,206 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SANITIZE_HPP
+#define BOOST_URL_SANITIZE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Options for sanitizing urls
+
+    @see
+        @ref sanitize_url,
+        @ref sanitize_urls.
+*/
+struct sanitize_opts
+{
+    /** The scheme added to urls with an authority but no scheme
+
+        When this is empty, no scheme is
+        added. Browsers typically use
+        "https" here.
+    */
+    core::string_view default_scheme;
+
+    /** True if a first segment which looks like an authority is used as one
+
+        An input such as "www.example.com/index.html"
+        is a valid relative reference whose first
+        segment is "www.example.com". When this
+        option is `true`, such a segment becomes
+        the authority, the way browsers interpret
+        it. The segment must be a valid authority
+        with a "." or ":" before its last character.
+    */
+    bool infer_authority = true;
+};
+
+/** Diagnostics describing how a url was sanitized
+
+    @see
+        @ref sanitize_url.
+*/
+struct sanitize_report
+{
+    /** The offset of the first character which had to be escaped
+
+        This is the offset in the input, or
+        `npos` when no character was escaped.
+    */
+    std::size_t first_escaped = npos;
+
+    /** The number of characters which were escaped
+    */
+    std::size_t escaped = 0;
+
+    /** True if the input was copied as-is
+
+        This is the case when the input is a
+        valid URI-reference, and no authority
+        was inferred and no scheme was added.
+    */
+    bool valid = false;
+
+    /** True if the first segment of the input was used as the authority
+    */
+    bool inferred_authority = false;
+
+    /** True if the default scheme was added
+    */
+    bool added_scheme = false;
+
+    /// A constant used to indicate no offset
+    static constexpr std::size_t npos = std::size_t(-1);
+};
+
+/** Place a valid url built from non-strict input into a container
+
+    This function splits the input into url
+    components according to its delimiters,
+    the way browsers and other loose
+    applications do, and writes a valid url
+    with the same components into `dest`.
+    Characters which are not allowed in their
+    component are percent-escaped, including
+    a percent sign which does not begin a
+    valid escape, and existing escapes are
+    kept.
+
+    The components are measured in a single
+    pass over the input, and the result is
+    then written directly into the buffer of
+    `dest` along with its index, without
+    building intermediate urls or parsing the
+    result again. A valid URI-reference which
+    needs no inference is copied as-is.
+
+    @par Example
+    @code
+    url u;
+    sanitize_opts opts;
+    opts.default_scheme = "https";
+    sanitize_report r = sanitize_url( "www.boost.org/a b?x=[1]", u, opts );
+    assert( u.buffer() == "https://www.boost.org/a%20b?x=[1]" );
+    assert( r.inferred_authority && r.added_scheme && r.escaped == 1 );
+    @endcode
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to allocate may throw.
+    Exceptions thrown on invalid input.
+
+    @throw system_error
+    `opts.default_scheme` is not empty and
+    is not a valid scheme.
+
+    @return The diagnostics for the input.
+
+    @param s The input string.
+
+    @param dest The container where the
+    result is written.
+
+    @param opts The options for sanitizing.
+
+    @see
+        @ref sanitize_opts,
+        @ref sanitize_report,
+        @ref sanitize_urls.
+*/
+BOOST_URL_DECL
+sanitize_report
+sanitize_url(
+    core::string_view s,
+    url_base& dest,
+    sanitize_opts const& opts = {});
+
+/** Sanitize a sequence of non-strict inputs
+
+    This function calls @ref sanitize_url
+    for each input, placing the results in
+    the corresponding elements of `dest`.
+    The options are validated once, and the
+    buffers of the destination urls are
+    reused, so sanitizing another batch of
+    inputs into the same urls does not
+    allocate once their capacity suffices.
+
+    @par Example
+    @code
+    std::vector< core::string_view > in = load_links();
+    std::vector< url > out( in.size() );
+    std::size_t changed = sanitize_urls(
+        in.data(), in.size(), out.data() );
+    @endcode
+
+    @par Exception Safety
+    Basic guarantee.
+    Calls to allocate may throw.
+    Exceptions thrown on invalid input.
+
+    @throw system_error
+    `opts.default_scheme` is not empty and
+    is not a valid scheme.
+
+    @return The number of inputs which were
+    not copied as-is.
+
+    @param s A pointer to the first of `n`
+    inputs.
+
+    @param n The number of inputs.
+
+    @param dest A pointer to the first of
+    `n` destination urls.
+
+    @param opts The options for sanitizing.
+
+    @param reports An optional pointer to
+    the first of `n` reports, which are
+    assigned the diagnostics for each input.
+*/
+BOOST_URL_DECL
+std::size_t
+sanitize_urls(
+    core::string_view const* s,
+    std::size_t n,
+    url* dest,
+    sanitize_opts const& opts = {},
+    sanitize_report* reports = nullptr);
+
+} // urls
+} // boost
+
+#endif
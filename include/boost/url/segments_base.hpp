@@ -12,6 +12,7 @@
 #define BOOST_URL_SEGMENTS_BASE_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/decode_view.hpp>
 #include <boost/url/ignore_case.hpp>
 #include <boost/url/detail/url_impl.hpp>
 #include <iosfwd>
@@ -76,6 +77,35 @@ public:
     /// @copydoc iterator
     using const_iterator = iterator;
 
+    /** A Bidirectional iterator to a decoded path segment
+
+        Objects of this type allow iteration
+        through the segments in the path.
+        Dereferencing yields a @ref decode_view
+        which references the underlying buffer
+        and decodes on the fly when it is
+        iterated or compared.
+
+        <br>
+
+        Unlike @ref iterator, nothing is copied
+        or allocated when these iterators are
+        dereferenced, and the returned views
+        remain valid for as long as the
+        underlying buffer is unmodified.
+
+        @see
+            @ref decoded.
+    */
+    class decode_iterator;
+
+    /** A range of decoded path segments
+
+        This is the type returned by
+        @ref decoded.
+    */
+    class decoded_range;
+
     /** The value type
 
         Values of this type represent a segment
@@ -305,6 +335,35 @@ public:
     */
     iterator
     end() const noexcept;
+
+    /** Return the segments as a range of decoded views
+
+        This function returns a range over the
+        same segments as the container, whose
+        elements are @ref decode_view.
+        The strings reference the underlying
+        buffer and are decoded on the fly, so
+        no memory is allocated when the range
+        is iterated.
+
+        @par Example
+        @code
+        url_view u( "/path/to/my%20file.txt" );
+        for( decode_view s : u.segments().decoded() )
+            assert( ! s.empty() );
+        @endcode
+
+        @par Complexity
+        Linear in `this->front().size()` or
+        constant if `this->empty()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return A range of decoded segments.
+    */
+    decoded_range
+    decoded() const noexcept;
 };
 
 //------------------------------------------------
@@ -0,0 +1,263 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_SEGMENTS_ENCODED_ARRAY_HPP
+#define BOOST_URL_SEGMENTS_ENCODED_ARRAY_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/detail/index_iterator.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A random access view of encoded path segments
+
+    Iterators of @ref segments_encoded_view
+    are bidirectional: each increment scans the
+    path for the next delimiter, so reaching
+    the k-th segment is linear in k.
+    This container scans the path once and
+    records where each segment begins and ends,
+    after which any segment can be accessed in
+    constant time and iterators are random
+    access.
+
+    Strings returned by this container may
+    contain percent escapes, and reference the
+    same character buffer as the view it was
+    built from.
+
+    @par Example
+    @code
+    url_view u( "/api/v1/users/42/posts" );
+    segments_encoded_array sa( u.encoded_segments() );
+
+    assert( sa.size() == 5 );
+    assert( sa[3] == "42" );
+    assert( *(sa.end() - 1) == "posts" );
+    @endcode
+
+    @par Iterator Invalidation
+    Ownership of the character buffer is not
+    transferred; the caller is responsible for
+    ensuring the lifetime of the buffer extends
+    until the container is no longer used. Any
+    modification of the buffer invalidates the
+    container and its iterators.
+
+    @see
+        @ref params_encoded_array,
+        @ref segments_encoded_view.
+*/
+class segments_encoded_array
+{
+public:
+    /** The value type
+
+        Values of this type represent a segment
+        which may contain percent escapes.
+    */
+    using value_type = pct_string_view;
+
+    /// @copydoc value_type
+    using reference = pct_string_view;
+
+    /// @copydoc value_type
+    using const_reference = pct_string_view;
+
+    /** A Random Access iterator to a path segment
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __implementation_defined__;
+#else
+    using iterator = detail::index_iterator<
+        segments_encoded_array, pct_string_view>;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** An unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        Default-constructed containers have
+        zero elements.
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    segments_encoded_array() noexcept = default;
+
+    /** Constructor
+
+        This function scans the segments of
+        `ps` once and records their offsets.
+
+        @par Complexity
+        Linear in `ps.buffer().size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param ps The segments to index.
+    */
+    BOOST_URL_DECL
+    explicit
+    segments_encoded_array(
+        segments_encoded_view const& ps);
+
+    /** Return the segments this container was built from
+
+        @return The view of the segments.
+    */
+    segments_encoded_view const&
+    view() const noexcept
+    {
+        return ps_;
+    }
+
+    /** Return the referenced character buffer.
+
+        @return The encoded path.
+    */
+    pct_string_view
+    buffer() const noexcept
+    {
+        return ps_.buffer();
+    }
+
+    /** Return true if there are no segments
+
+        @return `true` if there are no segments.
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Return the number of segments
+
+        @return The number of segments.
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return the segment at an index
+
+        @par Preconditions
+        @code
+        i < this->size()
+        @endcode
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return The segment.
+
+        @param i The zero-based index.
+    */
+    pct_string_view
+    operator[](std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < v_.size());
+        entry const& e = v_[i];
+        return make_pct_string_view_unsafe(
+            data_ + e.pos, e.n, e.dn);
+    }
+
+    /** Return the first segment
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @return The first segment.
+    */
+    pct_string_view
+    front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    /** Return the last segment
+
+        @par Preconditions
+        @code
+        this->empty() == false
+        @endcode
+
+        @return The last segment.
+    */
+    pct_string_view
+    back() const noexcept
+    {
+        return (*this)[size() - 1];
+    }
+
+    /** Return an iterator to the beginning
+
+        @return An iterator to the first segment.
+    */
+    iterator
+    begin() const noexcept
+    {
+        return iterator(*this, 0);
+    }
+
+    /** Return an iterator to the end
+
+        @return An iterator to one past the last segment.
+    */
+    iterator
+    end() const noexcept
+    {
+        return iterator(*this, v_.size());
+    }
+
+private:
+    struct entry
+    {
+        std::size_t pos;
+        std::size_t n;
+        std::size_t dn;
+    };
+
+    segments_encoded_view ps_;
+    char const* data_ = nullptr;
+    std::vector<entry> v_;
+};
+
+} // urls
+} // boost
+
+#endif
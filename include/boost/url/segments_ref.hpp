@@ -514,6 +514,84 @@ public:
         iterator first,
         iterator last) noexcept;
 
+    /** Erase segments matching a predicate
+
+        This function removes every segment
+        for which `pred` returns `true`. The
+        path is compacted in a single pass,
+        so removing many segments costs the
+        same as removing one.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Example
+        @code
+        url u( "/a/./b/c" );
+
+        u.segments().remove_if(
+            []( decode_view s )
+            {
+                return s == ".";
+            });
+
+        assert( u.encoded_path() == "/a/b/c" );
+        @endcode
+
+        @par Mandates
+        @code
+        std::is_convertible< decltype( pred( std::declval< decode_view >() ) ), bool >::value == true
+        @endcode
+
+        @par Complexity
+        Linear in `this->url().encoded_resource().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `pred` propagate.
+        `pred` is applied to every segment
+        before any is removed.
+
+        @return The number of segments removed.
+
+        @param pred The predicate to apply to
+        a @ref decode_view of each segment,
+        in order.
+    */
+    template<class Predicate>
+    std::size_t
+    remove_if(Predicate pred);
+
+    /** Erase segments not matching a predicate
+
+        This function removes every segment
+        for which `pred` returns `false`. The
+        path is compacted in a single pass.
+
+        <br>
+        All iterators are invalidated.
+
+        @par Complexity
+        Linear in `this->url().encoded_resource().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `pred` propagate.
+        `pred` is applied to every segment
+        before any is removed.
+
+        @return The number of segments removed.
+
+        @param pred The predicate to apply to
+        a @ref decode_view of each segment,
+        in order.
+    */
+    template<class Predicate>
+    std::size_t
+    retain(Predicate pred);
+
     //--------------------------------------------
 
     /** Replace segments
@@ -0,0 +1,648 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URI_TEMPLATE_HPP
+#define BOOST_URL_URI_TEMPLATE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/grammar/string_token.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+#ifndef BOOST_URL_DOCS
+class uri_template;
+
+BOOST_URL_DECL
+system::result<uri_template>
+parse_uri_template(
+    core::string_view s);
+#endif
+
+namespace detail {
+
+// calls fn(ctx, key, value) for each
+// element of a type-erased list or map
+using template_each_fn = void(*)(
+    void*, core::string_view, core::string_view);
+
+template<class T, class = void>
+struct is_template_list : std::false_type {};
+
+template<class T>
+struct is_template_list<T, void_t<
+    decltype(std::begin(std::declval<T const&>())),
+    decltype(std::end(std::declval<T const&>()))>>
+    : std::integral_constant<bool,
+        std::is_convertible<
+            decltype(*std::begin(std::declval<T const&>())),
+            core::string_view>::value &&
+        ! std::is_convertible<
+            T const&, core::string_view>::value>
+{
+};
+
+template<class T, class = void>
+struct is_template_map : std::false_type {};
+
+template<class T>
+struct is_template_map<T, void_t<
+    decltype(std::begin(std::declval<T const&>())->first),
+    decltype(std::begin(std::declval<T const&>())->second),
+    decltype(std::end(std::declval<T const&>()))>>
+    : std::integral_constant<bool,
+        std::is_convertible<
+            decltype(std::begin(std::declval<T const&>())->first),
+            core::string_view>::value &&
+        std::is_convertible<
+            decltype(std::begin(std::declval<T const&>())->second),
+            core::string_view>::value>
+{
+};
+
+// an element of a braced list of strings.
+// This only converts from a single string,
+// so that a braced pair of strings is not
+// mistaken for a string_view iterator range.
+struct template_string
+{
+    core::string_view s;
+
+    template<class String, class =
+        typename std::enable_if<
+            std::is_convertible<String const&,
+                core::string_view>::value>::type>
+    template_string(String const& s_) noexcept
+        : s(s_)
+    {
+    }
+
+    operator core::string_view() const noexcept
+    {
+        return s;
+    }
+};
+
+// a literal or an expression of a template
+struct template_part
+{
+    // 0 for a literal, otherwise the
+    // operator, with ' ' for none
+    char op = 0;
+
+    // literal: [pos, pos + n) in lits
+    // expression: [pos, pos + n) in vars
+    std::size_t pos = 0;
+    std::size_t n = 0;
+};
+
+// a varspec of an expression
+struct template_var
+{
+    // [pos, pos + n) in the template
+    std::size_t pos = 0;
+    std::size_t n = 0;
+
+    // the prefix length, or 0
+    std::size_t prefix = 0;
+    bool explode = false;
+};
+
+} // detail
+
+/** The value of a URI Template variable
+
+    A value is either undefined, a string,
+    a list of strings, or an associative
+    array of string pairs. Strings are
+    taken from anything convertible to
+    `core::string_view`, and integers are
+    converted to their decimal
+    representation. Lists and associative
+    arrays are taken from any range whose
+    elements are convertible to
+    `core::string_view`, or which have
+    `first` and `second` members which are.
+
+    Objects of this type refer to the
+    strings and ranges they are constructed
+    from, which must remain valid while the
+    value is used. They are meant to be
+    constructed in the arguments of
+    @ref uri_template::expand.
+
+    @see
+        @ref template_arg,
+        @ref uri_template.
+*/
+class template_value
+{
+public:
+    /// The kind of value
+    enum class kind
+    {
+        /// An undefined value
+        undefined,
+
+        /// A string
+        string,
+
+        /// A list of strings
+        list,
+
+        /// An associative array of strings
+        map
+    };
+
+    /** Constructor
+
+        Default-constructed values are
+        undefined.
+    */
+    template_value() noexcept = default;
+
+    /** Constructor
+
+        @param s The string.
+    */
+    template<class String
+#ifndef BOOST_URL_DOCS
+        , class = typename std::enable_if<
+            std::is_convertible<String const&,
+                core::string_view>::value>::type
+#endif
+    >
+    template_value(String const& s) noexcept
+        : k_(kind::string)
+    {
+        core::string_view sv(s);
+        p_ = sv.data();
+        n_ = sv.size();
+    }
+
+    /** Constructor
+
+        The integer is formatted as a
+        decimal string.
+
+        @param v The integer.
+    */
+    template<class Integer
+#ifndef BOOST_URL_DOCS
+        , class = typename std::enable_if<
+            std::is_integral<Integer>::value &&
+            ! std::is_same<Integer, bool>::value &&
+            ! std::is_same<Integer, char>::value>::type
+        , class = void
+#endif
+    >
+    template_value(Integer v) noexcept
+        : k_(kind::string)
+        , int_(true)
+    {
+        using U = typename
+            std::make_unsigned<Integer>::type;
+        char* const end = buf_ + sizeof(buf_);
+        char* it = end;
+        bool const neg = v < Integer(0);
+        // negate in the unsigned domain so
+        // that the minimum value is valid
+        U u = static_cast<U>(v);
+        if(neg)
+            u = static_cast<U>(0 - u);
+        do
+        {
+            *--it = static_cast<char>(
+                '0' + u % 10);
+            u /= 10;
+        }
+        while(u != 0);
+        if(neg)
+            *--it = '-';
+        n_ = end - it;
+        for(std::size_t i = 0; i < n_; ++i)
+            buf_[i] = it[i];
+    }
+
+    /** Constructor
+
+        @param r The list of strings.
+    */
+    template<class Range
+#ifndef BOOST_URL_DOCS
+        , class = typename std::enable_if<
+            detail::is_template_list<Range>::value>::type
+        , class = void
+        , class = void
+#endif
+    >
+    template_value(Range const& r) noexcept
+        : k_(kind::list)
+        , p_(&r)
+        , each_(&each_list<Range>)
+    {
+        n_ = empty(r);
+    }
+
+    /** Constructor
+
+        @param r The associative array.
+    */
+    template<class Range
+#ifndef BOOST_URL_DOCS
+        , class = typename std::enable_if<
+            detail::is_template_map<Range>::value &&
+            ! detail::is_template_list<Range>::value>::type
+        , class = void
+        , class = void
+        , class = void
+#endif
+    >
+    template_value(Range const& r) noexcept
+        : k_(kind::map)
+        , p_(&r)
+        , each_(&each_map<Range>)
+    {
+        n_ = empty(r);
+    }
+
+    /** Constructor
+
+        @param il The list of strings.
+    */
+    template_value(
+        std::initializer_list<
+            detail::template_string> const& il) noexcept
+        : k_(kind::list)
+        , p_(&il)
+        , each_(&each_list<std::initializer_list<
+            detail::template_string>>)
+    {
+        n_ = il.size() == 0;
+    }
+
+    /** Constructor
+
+        @param il The associative array.
+    */
+    template_value(
+        std::initializer_list<std::pair<
+            core::string_view,
+            core::string_view>> const& il) noexcept
+        : k_(kind::map)
+        , p_(&il)
+        , each_(&each_map<std::initializer_list<
+            std::pair<core::string_view,
+                core::string_view>>>)
+    {
+        n_ = il.size() == 0;
+    }
+
+    /** Return the kind of value
+
+        Empty lists and associative arrays
+        are undefined.
+    */
+    kind
+    type() const noexcept
+    {
+        if( k_ != kind::string &&
+            k_ != kind::undefined &&
+            n_ != 0)
+            return kind::undefined;
+        return k_;
+    }
+
+    /** Return the string
+
+        @par Preconditions
+        @code
+        this->type() == kind::string
+        @endcode
+    */
+    core::string_view
+    str() const noexcept
+    {
+        BOOST_ASSERT(k_ == kind::string);
+        if(int_)
+            return { buf_, n_ };
+        return { static_cast<
+            char const*>(p_), n_ };
+    }
+
+    /** Call a function for each element
+
+        For a list, `fn( ctx, s, {} )` is
+        called for each string. For an
+        associative array, `fn( ctx, k, v )`
+        is called for each pair.
+    */
+    void
+    each(
+        void (*fn)(void*,
+            core::string_view,
+            core::string_view),
+        void* ctx) const
+    {
+        BOOST_ASSERT(
+            k_ == kind::list ||
+            k_ == kind::map);
+        each_(p_, fn, ctx);
+    }
+
+private:
+    template<class Range>
+    static
+    std::size_t
+    empty(Range const& r)
+    {
+        return std::begin(r) == std::end(r);
+    }
+
+    template<class Range>
+    static
+    void
+    each_list(
+        void const* p,
+        detail::template_each_fn fn,
+        void* ctx)
+    {
+        for(auto const& v :
+                *static_cast<Range const*>(p))
+            fn(ctx, core::string_view(v), {});
+    }
+
+    template<class Range>
+    static
+    void
+    each_map(
+        void const* p,
+        detail::template_each_fn fn,
+        void* ctx)
+    {
+        for(auto const& v :
+                *static_cast<Range const*>(p))
+            fn(ctx,
+                core::string_view(v.first),
+                core::string_view(v.second));
+    }
+
+    kind k_ = kind::undefined;
+    bool int_ = false;
+    void const* p_ = nullptr;
+
+    // string: the size
+    // list, map: non-zero when empty
+    std::size_t n_ = 0;
+    void (*each_)(
+        void const*,
+        detail::template_each_fn,
+        void*) = nullptr;
+    char buf_[24];
+};
+
+/** A named variable for a URI Template
+
+    @see
+        @ref template_value,
+        @ref uri_template.
+*/
+struct template_arg
+{
+    /// The variable name
+    core::string_view name;
+
+    /// The variable value
+    template_value value;
+};
+
+/** A URI Template
+
+    This class holds a URI Template, parsed
+    once into a list of literals and
+    expressions. The literals are stored
+    already percent-encoded. Expanding the
+    template with a set of variables
+    measures the result before writing it,
+    so that the destination is only resized
+    once.
+
+    All four levels of templates are
+    supported: simple string expansion,
+    the reserved `+` and fragment `#`
+    operators, the label `.`, path `/`,
+    path-style parameter `;`, form-style
+    query `?` and continuation `&`
+    operators, and the prefix `:n` and
+    explode `*` modifiers.
+
+    @par Example
+    @code
+    uri_template const t( "https://api.example.com{/path*}{?q,page}" );
+
+    std::vector< std::string > path = { "search", "repos" };
+    url u = t.expand( { { "path", path }, { "q", "a b" }, { "page", 2 } } );
+    assert( u.buffer() == "https://api.example.com/search/repos?q=a%20b&page=2" );
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6570"
+        >URI Template (rfc6570)</a>
+
+    @see
+        @ref parse_uri_template,
+        @ref template_arg,
+        @ref template_value.
+*/
+class uri_template
+{
+    std::string s_;
+    std::string lits_;
+    std::vector<detail::template_part> parts_;
+    std::vector<detail::template_var> vars_;
+
+    BOOST_URL_DECL
+    std::size_t
+    measure(
+        std::initializer_list<
+            template_arg> args) const;
+
+    BOOST_URL_DECL
+    char*
+    write(
+        char* dest,
+        std::initializer_list<
+            template_arg> args) const;
+
+    friend
+    system::result<uri_template>
+    parse_uri_template(
+        core::string_view s);
+
+public:
+    /** Constructor
+
+        Default-constructed templates are
+        empty, and expand to an empty string.
+    */
+    uri_template() = default;
+
+    /** Constructor
+
+        This function parses the template
+        `s` and stores a copy of it.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        `s` is not a valid URI Template.
+
+        @param s The template string.
+    */
+    BOOST_URL_DECL
+    explicit
+    uri_template(
+        core::string_view s);
+
+    /** Return the template string
+    */
+    core::string_view
+    str() const noexcept
+    {
+        return s_;
+    }
+
+    /** Expand the template into a URL
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @return A URL holding the expansion.
+
+        @param args The variables. Variables
+        which are not in `args` are undefined.
+
+        @throws system_error
+        The expansion is not a valid
+        URI reference.
+    */
+    BOOST_URL_DECL
+    url
+    expand(
+        std::initializer_list<
+            template_arg> args) const;
+
+    /** Expand the template into a string
+
+        The expansion is measured first, and
+        then written into the buffer prepared
+        by `token`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return The expansion.
+
+        @param args The variables. Variables
+        which are not in `args` are undefined.
+
+        @param token A string token.
+    */
+    template<BOOST_URL_CONSTRAINT(string_token::StringToken) StringToken>
+    typename StringToken::result_type
+    expand(
+        std::initializer_list<
+            template_arg> args,
+        StringToken&& token) const
+    {
+        std::size_t const n = measure(args);
+        char* dest = token.prepare(n);
+        write(dest, args);
+        return token.result();
+    }
+
+    /** Expand the template into a URL
+
+        The result is written into `u`,
+        whose capacity is reused.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @param u An object that derives
+        from @ref url_base.
+
+        @param args The variables. Variables
+        which are not in `args` are undefined.
+
+        @throws system_error
+        The expansion is not a valid
+        URI reference.
+    */
+    BOOST_URL_DECL
+    void
+    expand_to(
+        url_base& u,
+        std::initializer_list<
+            template_arg> args) const;
+};
+
+/** Parse a URI Template
+
+    @par Exception Safety
+    Calls to allocate may throw.
+
+    @return The parsed template, or an
+    error if `s` is not a valid template.
+
+    @param s The template string.
+
+    @par BNF
+    @code
+    URI-Template  = *( literals / expression )
+    expression    =  "{" [ operator ] variable-list "}"
+    operator      =  "+" / "#" / "." / "/" / ";" / "?" / "&"
+    variable-list =  varspec *( "," varspec )
+    varspec       =  varname [ modifier-level4 ]
+    varname       =  varchar *( ["."] varchar )
+    varchar       =  ALPHA / DIGIT / "_" / pct-encoded
+    modifier-level4 =  prefix / explode
+    prefix        =  ":" max-length
+    max-length    =  %x31-39 0*3DIGIT
+    explode       =  "*"
+    @endcode
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc6570#section-2"
+        >2. Syntax (rfc6570)</a>
+
+    @see
+        @ref uri_template.
+*/
+BOOST_URL_DECL
+system::result<uri_template>
+parse_uri_template(
+    core::string_view s);
+
+} // urls
+} // boost
+
+#endif
@@ -25,7 +25,9 @@
 #include <initializer_list>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace boost {
 namespace urls {
@@ -36,6 +38,7 @@ struct any_segments_iter;
 struct params_iter_impl;
 struct segments_iter_impl;
 struct pattern;
+struct sanitizer;
 }
 
 /** Common functionality for containers
@@ -70,7 +73,10 @@ class BOOST_SYMBOL_VISIBLE url_base
     friend class segments_ref;
     friend class segments_encoded_ref;
     friend class params_encoded_ref;
+    friend class prepared_base;
+    friend class uri_template;
     friend struct detail::pattern;
+    friend struct detail::sanitizer;
 
     struct op_t
     {
@@ -2463,6 +2469,115 @@ public:
     url_base&
     remove_query() noexcept;
 
+    /** Sort the query params by key
+
+        This function reorders the params so
+        that their keys are in ascending order.
+        Keys are compared as if all escaped
+        characters were decoded first, and
+        params with equal keys keep their
+        relative order.
+
+        The params are permuted within the
+        existing buffer; their encoding is
+        preserved and the size of the URL
+        does not change.
+
+        @par Example
+        @code
+        assert( url( "/?b=2&A=1&a=0" ).sort_params().encoded_query() == "A=1&a=0&b=2" );
+        assert( url( "/?b=2&A=1&a=0" ).sort_params( ignore_case ).encoded_query() == "A=1&a=0&b=2" );
+        @endcode
+
+        @par Complexity
+        Linearithmic in `this->encoded_params().size()`,
+        plus linear in `this->encoded_query().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return `*this`
+
+        @param ic An optional parameter. If
+        the value @ref ignore_case is passed
+        here, keys are compared
+        case-insensitively.
+
+        @param opt The options used to decode
+        the keys for comparison.
+
+        @see
+            @ref encoded_params,
+            @ref params.
+    */
+    url_base&
+    sort_params(
+        ignore_case_param ic = {},
+        encoding_opts opt = {});
+
+    /** Sort the query params by key
+
+        This function reorders the params using
+        `comp` to compare their decoded keys.
+        Params with equivalent keys keep their
+        relative order.
+
+        The params are permuted within the
+        existing buffer; their encoding is
+        preserved and the size of the URL
+        does not change. No string is
+        allocated for any param.
+
+        @par Example
+        @code
+        url u( "/?b=2&c=3&a=1" );
+        u.sort_params(
+            []( decode_view const& k0, decode_view const& k1 )
+            {
+                return k0.compare( k1 ) > 0;
+            });
+        assert( u.encoded_query() == "c=3&b=2&a=1" );
+        @endcode
+
+        @par Mandates
+        @code
+        std::is_convertible< decltype( comp( std::declval< decode_view const& >(), std::declval< decode_view const& >() ) ), bool >::value == true
+        @endcode
+
+        @par Complexity
+        Linearithmic in `this->encoded_params().size()`,
+        plus linear in `this->encoded_query().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown by `comp` propagate.
+
+        @return `*this`
+
+        @param comp A strict weak ordering
+        on the decoded keys.
+
+        @param opt The options used to decode
+        the keys for comparison.
+
+        @see
+            @ref encoded_params,
+            @ref params.
+    */
+    template<class Compare
+#ifndef BOOST_URL_DOCS
+        , class = typename std::enable_if<
+            ! std::is_convertible<
+                Compare, ignore_case_param>::value>::type
+#endif
+    >
+    url_base&
+    sort_params(
+        Compare comp,
+        encoding_opts opt = {});
+
     //--------------------------------------------
     //
     // Fragment
@@ -3030,6 +3145,23 @@ private:
         detail::any_params_iter&&) ->
             detail::params_iter_impl;
 
+    // Erase every element for which
+    // `pred` returns true, compacting
+    // the buffer in a single pass after
+    // `pred` is applied to all of them.
+    template<class Pred>
+    std::size_t
+    erase_params_if(Pred&& pred);
+
+    template<class Pred>
+    std::size_t
+    erase_segments_if(Pred&& pred);
+
+    void
+    permute_params(
+        std::vector<
+            detail::params_iter_impl> const& v);
+
     // Decode any unnecessary percent-escapes
     // and ensures hexadecimals are uppercase.
     // The encoding of ignored characters is
@@ -3051,6 +3183,25 @@ private:
         CharSet const& allowed,
         op_t&) noexcept;
 
+    // Write the normalized octets of [it, end)
+    // to dest, which may alias it, and return
+    // one past the last character written.
+    template
+        <class AllowedCharSet,
+         class IgnoredCharSet>
+    static
+    char*
+    normalize_octets(
+        char* dest,
+        char const* it,
+        char const* end,
+        AllowedCharSet const& allowed,
+        IgnoredCharSet const& ignored) noexcept;
+
+    // Remove dot segments from an already
+    // decoded path and shield the result.
+    void normalize_path_impl(op_t&);
+
     void decoded_to_lower_impl(int id) noexcept;
     void to_lower_impl(int id) noexcept;
 };
@@ -0,0 +1,695 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_MAP_HPP
+#define BOOST_URL_URL_MAP_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/url_table.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A map from urls compared by normalized equivalence
+
+    Keys in the map are unique under the
+    syntax-based normalization of RFC 3986:
+    two urls are the same key when
+    @ref url_view_base::compare returns zero,
+    even if their strings differ in case or
+    percent-encoding, or have dot segments.
+
+    The text of each key is appended to an
+    arena owned by the map, and the table
+    only stores its position and hash. Mapped
+    values are stored contiguously in
+    insertion order. Lookups accept any url,
+    or a string which is parsed as a
+    URI-reference, and do not allocate.
+
+    @par Example
+    @code
+    url_map< int > hits;
+    ++hits[ url_view( "http://example.com/a" ) ];
+    ++hits[ url_view( "HTTP://example.com/%61" ) ];
+
+    assert( hits.size() == 1 );
+    assert( hits.at( "http://EXAMPLE.com/./a" ) == 2 );
+    @endcode
+
+    @par Iterator Invalidation
+    Inserting into the map or clearing it
+    invalidates all iterators, references to
+    mapped values, and views of the keys.
+
+    @tparam T The mapped type.
+
+    @see
+        @ref url_set,
+        @ref url_view_base::compare.
+*/
+template<class T>
+class url_map
+{
+    template<bool IsConst>
+    class iterator_impl;
+
+    detail::url_table t_;
+    std::vector<T> v_;
+
+public:
+    /** The mapped type
+    */
+    using mapped_type = T;
+
+    /** The key type
+    */
+    using key_type = url_view;
+
+    /** The reference type
+
+        Iterators return a pair of a view of
+        the key and a reference to the value.
+    */
+    using reference = std::pair<url_view, T&>;
+
+    /// @copydoc reference
+    using const_reference = std::pair<url_view, T const&>;
+
+    /// @copydoc reference
+    using value_type = reference;
+
+    /** A random access iterator to the elements
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    using iterator = iterator_impl<false>;
+#endif
+
+    /** A random access iterator to the elements
+    */
+#ifdef BOOST_URL_DOCS
+    using const_iterator = __see_below__;
+#else
+    using const_iterator = iterator_impl<true>;
+#endif
+
+    /** An unsigned integer type to represent sizes.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        Default-constructed maps are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_map() = default;
+
+    /** Constructor
+
+        This function constructs an empty map
+        whose hash is seeded with `seed`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param seed The seed for the hash.
+    */
+    explicit
+    url_map(std::size_t seed) noexcept
+        : t_(seed)
+    {
+    }
+
+    /** Return the number of elements
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return true if the map is empty
+    */
+    bool
+    empty() const noexcept
+    {
+        return v_.empty();
+    }
+
+    /** Return an iterator to the first element
+    */
+    iterator
+    begin() noexcept
+    {
+        return { *this, 0 };
+    }
+
+    /// @copydoc begin
+    const_iterator
+    begin() const noexcept
+    {
+        return { *this, 0 };
+    }
+
+    /** Return an iterator to one past the last element
+    */
+    iterator
+    end() noexcept
+    {
+        return { *this, size() };
+    }
+
+    /// @copydoc end
+    const_iterator
+    end() const noexcept
+    {
+        return { *this, size() };
+    }
+
+    /** Insert an element if the key is new
+
+        If no key in the map is equivalent to
+        `u`, a copy of its string is stored
+        and the mapped value is constructed
+        from `args`. Otherwise, nothing is
+        constructed.
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return A pair of an iterator to the
+        element with the equivalent key, and
+        `true` if an element was inserted.
+
+        @param u The key.
+
+        @param args Arguments forwarded to the
+        constructor of the mapped value.
+    */
+    template<class... Args>
+    std::pair<iterator, bool>
+    try_emplace(
+        url_view_base const& u,
+        Args&&... args)
+    {
+        auto const r = t_.insert(u);
+        if(! r.second)
+            return { iterator(*this, r.first), false };
+        try
+        {
+            v_.emplace_back(
+                std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            t_.pop_back();
+            throw;
+        }
+        return { iterator(*this, r.first), true };
+    }
+
+    /** Insert an element if the key is new
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return A pair of an iterator to the
+        element with the equivalent key, and
+        `true` if an element was inserted.
+
+        @param u The key.
+
+        @param value The mapped value.
+    */
+    std::pair<iterator, bool>
+    insert(
+        url_view_base const& u,
+        T const& value)
+    {
+        return try_emplace(u, value);
+    }
+
+    /// @copydoc insert(url_view_base const&, T const&)
+    std::pair<iterator, bool>
+    insert(
+        url_view_base const& u,
+        T&& value)
+    {
+        return try_emplace(u, std::move(value));
+    }
+
+    /** Return the value for a key, inserting it if needed
+
+        If no key in the map is equivalent
+        to `u`, an element with a
+        value-initialized mapped value is
+        inserted.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return A reference to the mapped value.
+
+        @param u The key.
+    */
+    T&
+    operator[](url_view_base const& u)
+    {
+        return v_[try_emplace(u).first.i_];
+    }
+
+    /** Return the value for an existing key
+
+        @par Exception Safety
+        Exceptions thrown on missing keys.
+
+        @throw system_error
+        No key is equivalent to `u`.
+
+        @return A reference to the mapped value.
+
+        @param u The key.
+    */
+    T&
+    at(url_view_base const& u)
+    {
+        return v_[checked_index(t_.find(u))];
+    }
+
+    /// @copydoc at(url_view_base const&)
+    T const&
+    at(url_view_base const& u) const
+    {
+        return v_[checked_index(t_.find(u))];
+    }
+
+    /** Return the value for an existing key
+
+        The string is parsed as a
+        URI-reference and looked up.
+
+        @par Exception Safety
+        Exceptions thrown on missing keys
+        or invalid input.
+
+        @throw system_error
+        No key is equivalent to `s`.
+
+        @return A reference to the mapped value.
+
+        @param s The string to look up.
+    */
+    T&
+    at(core::string_view s)
+    {
+        return v_[checked_index(t_.find(s))];
+    }
+
+    /// @copydoc at(core::string_view)
+    T const&
+    at(core::string_view s) const
+    {
+        return v_[checked_index(t_.find(s))];
+    }
+
+    /** Find the element with an equivalent key
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the element,
+        or `end()` if there is none.
+
+        @param u The key to look up.
+    */
+    iterator
+    find(url_view_base const& u) noexcept
+    {
+        return { *this, t_.find(u) };
+    }
+
+    /// @copydoc find(url_view_base const&)
+    const_iterator
+    find(url_view_base const& u) const noexcept
+    {
+        return { *this, t_.find(u) };
+    }
+
+    /** Find the element with an equivalent key
+
+        The string is parsed as a
+        URI-reference and looked up. If
+        it is not valid, `end()` is returned.
+
+        @par Complexity
+        Linear in `s.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the element,
+        or `end()` if there is none.
+
+        @param s The string to look up.
+    */
+    iterator
+    find(core::string_view s) noexcept
+    {
+        return { *this, t_.find(s) };
+    }
+
+    /// @copydoc find(core::string_view)
+    const_iterator
+    find(core::string_view s) const noexcept
+    {
+        return { *this, t_.find(s) };
+    }
+
+    /** Return true if an equivalent key exists
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return `true` if the map contains
+        a key equivalent to `u`.
+
+        @param u The key to look up.
+    */
+    bool
+    contains(url_view_base const& u) const noexcept
+    {
+        return t_.find(u) != t_.size();
+    }
+
+    /// @copydoc contains(url_view_base const&) const
+    bool
+    contains(core::string_view s) const noexcept
+    {
+        return t_.find(s) != t_.size();
+    }
+
+    /** Return the number of equivalent keys, zero or one
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return `1` if the map contains a key
+        equivalent to `u`, else `0`.
+
+        @param u The key to look up.
+    */
+    std::size_t
+    count(url_view_base const& u) const noexcept
+    {
+        return contains(u);
+    }
+
+    /// @copydoc count(url_view_base const&) const
+    std::size_t
+    count(core::string_view s) const noexcept
+    {
+        return contains(s);
+    }
+
+    /** Reserve space
+
+        This function reserves room for `n`
+        elements whose keys total `bytes`
+        characters.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The number of elements.
+
+        @param bytes The total size of the keys.
+    */
+    void
+    reserve(
+        std::size_t n,
+        std::size_t bytes = 0)
+    {
+        v_.reserve(n);
+        t_.reserve(n, bytes);
+    }
+
+    /** Remove all elements
+
+        Allocated memory is kept.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept
+    {
+        v_.clear();
+        t_.clear();
+    }
+
+private:
+    std::size_t
+    checked_index(std::size_t i) const
+    {
+        if(i == t_.size())
+            detail::throw_out_of_range();
+        return i;
+    }
+};
+
+//------------------------------------------------
+
+template<class T>
+template<bool IsConst>
+class url_map<T>::iterator_impl
+{
+    using map_type = typename std::conditional<
+        IsConst, url_map const, url_map>::type;
+
+    map_type* m_ = nullptr;
+    std::size_t i_ = 0;
+
+    friend class url_map;
+    template<bool> friend class iterator_impl;
+
+    iterator_impl(
+        map_type& m,
+        std::size_t i) noexcept
+        : m_(&m)
+        , i_(i)
+    {
+    }
+
+public:
+    using value_type = typename std::conditional<
+        IsConst,
+        typename url_map::const_reference,
+        typename url_map::reference>::type;
+    using reference = value_type;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    iterator_impl() = default;
+
+    // iterator converts to const_iterator
+    template<
+        bool IsConst_ = IsConst,
+        class = typename std::enable_if<
+            IsConst_>::type>
+    iterator_impl(
+        iterator_impl<false> const& other) noexcept
+        : m_(other.m_)
+        , i_(other.i_)
+    {
+    }
+
+    reference
+    operator*() const noexcept
+    {
+        return {
+            m_->t_[i_],
+            m_->v_[i_] };
+    }
+
+    reference
+    operator[](
+        difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+
+    iterator_impl&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    iterator_impl
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++i_;
+        return tmp;
+    }
+
+    iterator_impl&
+    operator--() noexcept
+    {
+        --i_;
+        return *this;
+    }
+
+    iterator_impl
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --i_;
+        return tmp;
+    }
+
+    iterator_impl&
+    operator+=(difference_type n) noexcept
+    {
+        i_ += n;
+        return *this;
+    }
+
+    iterator_impl&
+    operator-=(difference_type n) noexcept
+    {
+        i_ -= n;
+        return *this;
+    }
+
+    friend
+    iterator_impl
+    operator+(
+        iterator_impl it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator_impl
+    operator+(
+        difference_type n,
+        iterator_impl it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator_impl
+    operator-(
+        iterator_impl it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        iterator_impl const& a,
+        iterator_impl const& b) noexcept
+    {
+        return static_cast<difference_type>(a.i_) -
+            static_cast<difference_type>(b.i_);
+    }
+
+    friend
+    bool
+    operator==(
+        iterator_impl const& a,
+        iterator_impl const& b) noexcept
+    {
+        return a.i_ == b.i_;
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator_impl const& a,
+        iterator_impl const& b) noexcept
+    {
+        return a.i_ != b.i_;
+    }
+
+    friend
+    bool
+    operator<(
+        iterator_impl const& a,
+        iterator_impl const& b) noexcept
+    {
+        return a.i_ < b.i_;
+    }
+
+    friend
+    bool
+    operator>(
+        iterator_impl const& a,
+        iterator_impl const& b) noexcept
+    {
+        return a.i_ > b.i_;
+    }
+
+    friend
+    bool
+    operator<=(
+        iterator_impl const& a,
+        iterator_impl const& b) noexcept
+    {
+        return a.i_ <= b.i_;
+    }
+
+    friend
+    bool
+    operator>=(
+        iterator_impl const& a,
+        iterator_impl const& b) noexcept
+    {
+        return a.i_ >= b.i_;
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_RULE_SET_HPP
+#define BOOST_URL_URL_RULE_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A set of glob patterns matched against urls
+
+    Each rule is a glob pattern matched
+    against the whole encoded url or against
+    one of its encoded parts:
+
+    @li `*` matches any sequence of characters
+        other than `/`
+    @li `**` matches any sequence of characters
+    @li `?` matches any character other than `/`
+    @li `\` matches the next character literally
+    @li any other character matches itself
+
+    The patterns must match the complete
+    string. Patterns for the scheme and the
+    host are matched without regard to case.
+
+    The rules of each part are compiled into
+    a single automaton, whose states are
+    advanced in parallel as bits of a word,
+    so every rule is evaluated with one scan
+    of the url. The automatons are built by
+    the first match after a rule is added.
+
+    @par Example
+    @code
+    url_rule_set rs;
+    rs.add( url_rule_set::part::host, "*.google.com" );
+    rs.add( "http?://example.org/docs*" );
+
+    std::vector< std::size_t > v;
+    rs.match( url_view( "https://mail.google.com/a" ), v );
+    assert( v.size() == 1 && v[0] == 0 );
+    @endcode
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe, except for
+    concurrent calls to const functions.
+*/
+class url_rule_set
+{
+    struct impl;
+    impl* impl_ = nullptr;
+
+public:
+    /** The parts of a url a rule can match
+    */
+    enum class part
+    {
+        /// The whole url
+        url,
+
+        /// The scheme
+        scheme,
+
+        /// The encoded authority
+        authority,
+
+        /// The encoded userinfo
+        userinfo,
+
+        /// The encoded user
+        user,
+
+        /// The encoded password
+        password,
+
+        /// The encoded host
+        host,
+
+        /// The port
+        port,
+
+        /// The encoded path
+        path,
+
+        /// The encoded query
+        query,
+
+        /// The encoded fragment
+        fragment
+    };
+
+    /// A value returned when no rule matches
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    /** Constructor
+
+        Default constructed sets have no rules.
+    */
+    BOOST_URL_DECL
+    url_rule_set() noexcept;
+
+    /// Destructor
+    BOOST_URL_DECL
+    ~url_rule_set();
+
+    /// Constructor
+    BOOST_URL_DECL
+    url_rule_set(url_rule_set&& other) noexcept;
+
+    /// Assignment
+    BOOST_URL_DECL
+    url_rule_set&
+    operator=(url_rule_set&& other) noexcept;
+
+    url_rule_set(url_rule_set const&) = delete;
+    url_rule_set& operator=(url_rule_set const&) = delete;
+
+    /** Return the number of rules
+    */
+    BOOST_URL_DECL
+    std::size_t
+    size() const noexcept;
+
+    /** Add a rule matching the whole url
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        `pattern` ends with an unescaped `\`.
+
+        @param pattern The glob pattern
+        @return The index of the rule
+    */
+    BOOST_URL_DECL
+    std::size_t
+    add(core::string_view pattern);
+
+    /** Add a rule matching a part of the url
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throws system_error
+        `pattern` ends with an unescaped `\`.
+
+        @param p The part of the url
+        @param pattern The glob pattern
+        @return The index of the rule
+    */
+    BOOST_URL_DECL
+    std::size_t
+    add(
+        part p,
+        core::string_view pattern);
+
+    /** Find every rule which matches a url
+
+        The indexes of the matching rules
+        are appended to `v` in increasing
+        order.
+
+        @par Complexity
+        Linear in the size of the url, times
+        the number of states of the automaton
+        divided by the size of a word.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The url
+        @param v The indexes of the rules
+    */
+    BOOST_URL_DECL
+    void
+    match(
+        url_view_base const& u,
+        std::vector<std::size_t>& v) const;
+
+    /** Return the first rule which matches a url
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param u The url
+        @return The index of the first
+        matching rule, or @ref npos
+    */
+    BOOST_URL_DECL
+    std::size_t
+    find_first(url_view_base const& u) const;
+};
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,339 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_URL_SET_HPP
+#define BOOST_URL_URL_SET_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/index_iterator.hpp>
+#include <boost/url/detail/url_table.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+/** A set of urls compared by normalized equivalence
+
+    Urls in the set are unique under the
+    syntax-based normalization of RFC 3986:
+    two urls are the same key when
+    @ref url_view_base::compare returns zero,
+    even if their strings differ in case or
+    percent-encoding, or have dot segments.
+    No normalized copy of a url is created to
+    insert or look it up.
+
+    The text of each inserted url is appended
+    to an arena owned by the set, and the
+    table only stores its position and hash.
+    Lookups accept any url, or a string which
+    is parsed as a URI-reference, and do not
+    allocate.
+
+    Elements are visited in insertion order,
+    and each one is the first inserted url of
+    its equivalence class, unchanged.
+
+    @par Example
+    @code
+    url_set seen;
+    seen.insert( "http://example.com/a/b" );
+
+    assert( seen.contains( "HTTP://EXAMPLE.com/a/./%62" ) );
+    assert( ! seen.insert( url_view( "http://example.com/a/c/../b" ) ).second );
+    @endcode
+
+    @par Iterator Invalidation
+    Inserting into the set or clearing it
+    invalidates all iterators. Views returned
+    by the iterators reference the arena and
+    are invalidated as well.
+
+    @see
+        @ref url_map,
+        @ref url_view_base::compare.
+*/
+class url_set
+{
+    detail::url_table t_;
+
+public:
+    /** A random access iterator to the urls in the set
+    */
+    using iterator = detail::index_iterator<
+        detail::url_table, url_view>;
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** The value type
+    */
+    using value_type = url_view;
+
+    /** The reference type
+
+        This is the type of value returned
+        when iterators of the set are
+        dereferenced.
+    */
+    using reference = url_view;
+
+    /// @copydoc reference
+    using const_reference = url_view;
+
+    /** An unsigned integer type to represent sizes.
+    */
+    using size_type = std::size_t;
+
+    /** A signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        Default-constructed sets are empty.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    url_set() noexcept = default;
+
+    /** Constructor
+
+        This function constructs an empty set
+        whose hash is seeded with `seed`.
+        Seeding with an unpredictable value
+        makes the set resistant to inputs
+        chosen to collide.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param seed The seed for the hash.
+    */
+    explicit
+    url_set(std::size_t seed) noexcept
+        : t_(seed)
+    {
+    }
+
+    /** Return the number of urls in the set
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return t_.size();
+    }
+
+    /** Return true if the set is empty
+    */
+    bool
+    empty() const noexcept
+    {
+        return t_.size() == 0;
+    }
+
+    /** Return an iterator to the first url
+    */
+    iterator
+    begin() const noexcept
+    {
+        return { t_, 0 };
+    }
+
+    /** Return an iterator to one past the last url
+    */
+    iterator
+    end() const noexcept
+    {
+        return { t_, t_.size() };
+    }
+
+    /** Insert a url
+
+        If no url in the set is equivalent
+        to `u`, a copy of its string is stored
+        in the set.
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @return A pair of an iterator to the
+        equivalent url in the set, and `true`
+        if `u` was inserted.
+
+        @param u The url to insert.
+    */
+    std::pair<iterator, bool>
+    insert(url_view_base const& u)
+    {
+        auto const r = t_.insert(u);
+        return { { t_, r.first }, r.second };
+    }
+
+    /** Insert a url
+
+        The string is parsed as a
+        URI-reference and inserted.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+        Exceptions thrown on invalid input.
+
+        @throw system_error
+        `s` is not a valid URI-reference.
+
+        @return A pair of an iterator to the
+        equivalent url in the set, and `true`
+        if the url was inserted.
+
+        @param s The string to parse.
+    */
+    BOOST_URL_DECL
+    std::pair<iterator, bool>
+    insert(core::string_view s);
+
+    /** Find an equivalent url
+
+        @par Complexity
+        Linear in `u.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the equivalent
+        url, or `end()` if there is none.
+
+        @param u The url to look up.
+    */
+    iterator
+    find(url_view_base const& u) const noexcept
+    {
+        return { t_, t_.find(u) };
+    }
+
+    /** Find an equivalent url
+
+        The string is parsed as a
+        URI-reference and looked up. If
+        it is not valid, `end()` is returned.
+
+        @par Complexity
+        Linear in `s.size()` on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return An iterator to the equivalent
+        url, or `end()` if there is none.
+
+        @param s The string to look up.
+    */
+    iterator
+    find(core::string_view s) const noexcept
+    {
+        return { t_, t_.find(s) };
+    }
+
+    /** Return true if an equivalent url exists
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return `true` if the set contains
+        a url equivalent to `u`.
+
+        @param u The url to look up.
+    */
+    bool
+    contains(url_view_base const& u) const noexcept
+    {
+        return t_.find(u) != t_.size();
+    }
+
+    /// @copydoc contains(url_view_base const&) const
+    bool
+    contains(core::string_view s) const noexcept
+    {
+        return t_.find(s) != t_.size();
+    }
+
+    /** Return the number of equivalent urls, zero or one
+
+        @par Exception Safety
+        Throws nothing.
+
+        @return `1` if the set contains a url
+        equivalent to `u`, else `0`.
+
+        @param u The url to look up.
+    */
+    std::size_t
+    count(url_view_base const& u) const noexcept
+    {
+        return contains(u);
+    }
+
+    /// @copydoc count(url_view_base const&) const
+    std::size_t
+    count(core::string_view s) const noexcept
+    {
+        return contains(s);
+    }
+
+    /** Reserve space
+
+        This function reserves room for `n`
+        urls totalling `bytes` characters, so
+        that inserting them does not rehash
+        the table or grow the arena.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param n The number of urls.
+
+        @param bytes The total size of the urls.
+    */
+    void
+    reserve(
+        std::size_t n,
+        std::size_t bytes = 0)
+    {
+        t_.reserve(n, bytes);
+    }
+
+    /** Remove all urls
+
+        Allocated memory is kept.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    void
+    clear() noexcept
+    {
+        t_.clear();
+    }
+};
+
+} // urls
+} // boost
+
+#endif
@@ -38,6 +38,7 @@ namespace urls {
 #ifndef BOOST_URL_DOCS
 namespace detail {
 struct pattern;
+struct sanitizer;
 }
 #endif
 
@@ -78,6 +79,7 @@ class BOOST_SYMBOL_VISIBLE url_view_base
     friend class params_encoded_view;
     friend class params_ref;
     friend class params_view;
+    friend class prepared_base;
     friend class segments_base;
     friend class segments_encoded_base;
     friend class segments_encoded_ref;
@@ -85,6 +87,7 @@ class BOOST_SYMBOL_VISIBLE url_view_base
     friend class segments_ref;
     friend class segments_view;
     friend struct detail::pattern;
+    friend struct detail::sanitizer;
 
     struct shared_impl;
 
@@ -147,6 +150,53 @@ protected:
     digest(std::size_t salt = 0) const noexcept;
 
 public:
+    /** Feed the normalized url to a hash algorithm
+
+        This function passes the bytes of the
+        url, as if it were normalized, to the
+        hash algorithm `h`. Urls which compare
+        equal produce the same sequence of
+        bytes, so any algorithm may be used to
+        hash urls in containers keyed by
+        normalized equivalence.
+
+        The bytes are passed in blocks, by
+        calling `h( p, n )` where `p` is a
+        `void const*` and `n` is a
+        `std::size_t`. How the bytes are split
+        into blocks is unspecified.
+
+        The `std::hash` specializations for
+        @ref url, @ref url_view and
+        @ref static_url use a seeded 64-bit
+        hash with this function.
+
+        @par Example
+        @code
+        struct my_hash
+        {
+            std::uint64_t h = 0;
+
+            void operator()( void const* p, std::size_t n ) noexcept;
+        };
+
+        my_hash h;
+        url_view( "HTTP://Example.com/%7Euser" ).hash_append( h );
+        @endcode
+
+        @par Complexity
+        Linear in `this->size()`.
+
+        @par Exception Safety
+        Throws nothing. The hash algorithm
+        must not throw.
+
+        @param h The hash algorithm to use.
+    */
+    template<class HashAlgorithm>
+    void
+    hash_append(HashAlgorithm& h) const noexcept;
+
     //--------------------------------------------
     //
     // Observers
@@ -0,0 +1,35 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/compiled_format.hpp>
+
+namespace boost {
+namespace urls {
+
+compiled_format::
+compiled_format(
+    core::string_view fmt)
+{
+    detail::compile_pattern(p_, fmt);
+}
+
+void
+compiled_format::
+vformat_to(
+    url_base& u,
+    detail::format_args args) const
+{
+    detail::apply_compiled(u, p_, args);
+}
+
+} // urls
+} // boost
+
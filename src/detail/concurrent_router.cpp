@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/concurrent_router.hpp>
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <thread>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+
+namespace {
+
+void
+drain(std::atomic<std::size_t>& readers) noexcept
+{
+    while (readers.load(
+        std::memory_order_seq_cst) != 0)
+        std::this_thread::yield();
+}
+
+} // (anon)
+
+concurrent_router_base::
+concurrent_router_base(
+    void const* p) noexcept
+    : p_(p)
+{
+    readers_[0].store(0, std::memory_order_relaxed);
+    readers_[1].store(0, std::memory_order_relaxed);
+}
+
+void const*
+concurrent_router_base::
+lock(std::size_t& idx) const noexcept
+{
+    // the readers and the writer agree on
+    // a single total order of these
+    // operations, so a reader which is not
+    // counted when the writer drains a
+    // counter loads the new pointer
+    idx = version_.load(
+        std::memory_order_seq_cst) & 1;
+    readers_[idx].fetch_add(
+        1, std::memory_order_seq_cst);
+    return p_.load(std::memory_order_seq_cst);
+}
+
+void
+concurrent_router_base::
+unlock(std::size_t idx) const noexcept
+{
+    readers_[idx].fetch_sub(
+        1, std::memory_order_release);
+}
+
+void const*
+concurrent_router_base::
+exchange(void const* p) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_);
+    void const* old = p_.exchange(
+        p, std::memory_order_seq_cst);
+    std::size_t const v = version_.load(
+        std::memory_order_relaxed);
+    // readers which loaded a stale
+    // version before the last flip
+    drain(readers_[(v + 1) & 1]);
+    version_.store(
+        v + 1, std::memory_order_seq_cst);
+    // readers which started before
+    // this flip
+    drain(readers_[v & 1]);
+    return old;
+}
+
+void const*
+concurrent_router_base::
+get() const noexcept
+{
+    return p_.load(std::memory_order_acquire);
+}
+
+#else
+
+concurrent_router_base::
+concurrent_router_base(
+    void const* p) noexcept
+    : p_(p)
+{
+}
+
+void const*
+concurrent_router_base::
+lock(std::size_t& idx) const noexcept
+{
+    idx = 0;
+    return p_;
+}
+
+void
+concurrent_router_base::
+unlock(std::size_t) const noexcept
+{
+}
+
+void const*
+concurrent_router_base::
+exchange(void const* p) noexcept
+{
+    void const* old = p_;
+    p_ = p;
+    return old;
+}
+
+void const*
+concurrent_router_base::
+get() const noexcept
+{
+    return p_;
+}
+
+#endif
+
+} // detail
+} // urls
+} // boost
@@ -50,6 +50,13 @@ throw_length_error(
     throw_errc(boost::system::errc::value_too_large, loc);
 }
 
+void
+throw_out_of_range(
+    source_location const& loc)
+{
+    throw_errc(boost::system::errc::result_out_of_range, loc);
+}
+
 } // detail
 } // url
 } // boost
@@ -17,11 +17,422 @@
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/grammar/tuple_rule.hpp>
 #include <boost/url/grammar/unsigned_rule.hpp>
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <clocale>
+#include <cstdlib>
+#if defined(__has_include)
+#if __has_include(<charconv>) && __cplusplus >= 201703L
+#include <charconv>
+#endif
+#endif
 
 namespace boost {
 namespace urls {
 namespace detail {
 
+namespace {
+
+// enough for any unsigned long long
+constexpr std::size_t max_digits = 20;
+
+constexpr char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// write the digits of `v` right to left,
+// ending at `end`, and return the first
+char*
+write_digits(
+    char* end,
+    unsigned long long int v) noexcept
+{
+    while (v >= 100)
+    {
+        auto const d = static_cast<
+            std::size_t>(v % 100) * 2;
+        v /= 100;
+        *--end = digit_pairs[d + 1];
+        *--end = digit_pairs[d];
+    }
+    if (v >= 10)
+    {
+        auto const d = static_cast<
+            std::size_t>(v) * 2;
+        *--end = digit_pairs[d + 1];
+        *--end = digit_pairs[d];
+        return end;
+    }
+    *--end = static_cast<char>('0' + v);
+    return end;
+}
+
+// the sign to write, or '\0' for none
+char
+sign_char(bool neg, char sign) noexcept
+{
+    if (neg)
+        return '-';
+    if (sign != '-')
+        return sign;
+    return '\0';
+}
+
+// encode [first, last), copying the
+// chars directly when none is reserved
+void
+encode_chars(
+    char*& out,
+    char const* first,
+    char const* last,
+    grammar::lut_chars const& cs) noexcept
+{
+    char const* it = first;
+    while (it != last && cs(*it))
+        ++it;
+    std::size_t const n = it - first;
+    if (n)
+        std::memcpy(out, first, n);
+    out += n;
+    for (; it != last; ++it)
+        encode_one(out, *it, cs);
+}
+
+std::size_t
+measure_chars(
+    char const* first,
+    char const* last,
+    grammar::lut_chars const& cs) noexcept
+{
+    std::size_t n = 0;
+    for (; first != last; ++first)
+        n += measure_one(*first, cs);
+    return n;
+}
+
+// size of a number with its sign
+// and padding, once encoded
+std::size_t
+measure_number(
+    char sign,
+    char const* first,
+    char const* last,
+    bool zeros,
+    char fill,
+    std::size_t w,
+    grammar::lut_chars const& cs) noexcept
+{
+    std::size_t dn = measure_chars(first, last, cs);
+    std::size_t n = last - first;
+    if (sign)
+    {
+        dn += measure_one(sign, cs);
+        ++n;
+    }
+    if (w > n)
+    {
+        if (!zeros)
+            dn += measure_one(fill, cs) * (w - n);
+        else
+            dn += measure_one('0', cs) * (w - n);
+    }
+    return dn;
+}
+
+// write a number with its sign and padding
+char*
+format_number(
+    char* out,
+    char sign,
+    char const* first,
+    char const* last,
+    bool zeros,
+    char fill,
+    char align,
+    std::size_t w,
+    grammar::lut_chars const& cs) noexcept
+{
+    std::size_t const n =
+        (last - first) + (sign != '\0');
+    std::size_t lpad = 0;
+    std::size_t rpad = 0;
+    if (w > n)
+    {
+        std::size_t pad = w - n;
+        if (zeros)
+        {
+            lpad = pad;
+        }
+        else
+        {
+            switch (align)
+            {
+            case '<':
+                rpad = pad;
+                break;
+            case '>':
+                lpad = pad;
+                break;
+            case '^':
+                lpad = pad / 2;
+                rpad = pad - lpad;
+                break;
+            }
+        }
+    }
+
+    if (!zeros)
+    {
+        for (std::size_t i = 0; i < lpad; ++i)
+            encode_one(out, fill, cs);
+    }
+    if (sign)
+        encode_one(out, sign, cs);
+    if (zeros)
+    {
+        for (std::size_t i = 0; i < lpad; ++i)
+            encode_one(out, '0', cs);
+    }
+    encode_chars(out, first, last, cs);
+    if (!zeros)
+    {
+        for (std::size_t i = 0; i < rpad; ++i)
+            encode_one(out, fill, cs);
+    }
+    return out;
+}
+
+#if !defined(__cpp_lib_to_chars)
+// replace the decimal point of the
+// current locale with '.'
+void
+fix_decimal_point(
+    char* first,
+    char* last) noexcept
+{
+    char const dp =
+        std::localeconv()->decimal_point[0];
+    if (dp == '.')
+        return;
+    for (; first != last; ++first)
+    {
+        if (*first == dp)
+        {
+            *first = '.';
+            return;
+        }
+    }
+}
+
+bool
+reads_back(char const* s, float v) noexcept
+{
+    return std::strtof(s, nullptr) == v;
+}
+
+bool
+reads_back(char const* s, double v) noexcept
+{
+    return std::strtod(s, nullptr) == v;
+}
+
+// the shortest decimal form of a finite,
+// non-negative `v` that reads back as `v`,
+// in the fixed or scientific notation,
+// whichever is shorter, like `std::to_chars`
+template <class T>
+std::size_t
+shortest_to_chars(
+    char* dest,
+    T v) noexcept
+{
+    if (v == 0)
+    {
+        *dest = '0';
+        return 1;
+    }
+
+    // d.ddddde[+-]xxx
+    char sci[32];
+    int n = 0;
+    for (int p = 0; p < 17; ++p)
+    {
+        n = std::snprintf(sci, sizeof(sci),
+            "%.*e", p, static_cast<double>(v));
+        if (reads_back(sci, v))
+            break;
+    }
+    fix_decimal_point(sci, sci + n);
+
+    // split into digits and exponent
+    char digits[20];
+    std::size_t nd = 0;
+    char const* it = sci;
+    for (; *it != 'e'; ++it)
+    {
+        if (*it != '.')
+            digits[nd++] = *it;
+    }
+    int const exp = std::atoi(it + 1);
+    while (nd > 1 && digits[nd - 1] == '0')
+        --nd;
+
+    // scientific: d[.ddd]e(+|-)xx
+    std::size_t const exp_digits =
+        (exp >= 100 || exp <= -100) ? 3 : 2;
+    std::size_t const sci_size =
+        nd + (nd > 1) + 2 + exp_digits;
+
+    // fixed
+    std::size_t fix_size;
+    if (exp >= 0)
+    {
+        std::size_t const int_digits = exp + 1;
+        if (nd <= int_digits)
+            fix_size = int_digits;
+        else
+            fix_size = nd + 1;
+    }
+    else
+    {
+        fix_size = 2 + (-exp - 1) + nd;
+    }
+
+    char* out = dest;
+    if (fix_size <= sci_size)
+    {
+        if (exp >= 0)
+        {
+            std::size_t const int_digits = exp + 1;
+            for (std::size_t i = 0; i < int_digits; ++i)
+                *out++ = i < nd ? digits[i] : '0';
+            if (nd > int_digits)
+            {
+                *out++ = '.';
+                std::memcpy(out,
+                    digits + int_digits,
+                    nd - int_digits);
+                out += nd - int_digits;
+            }
+        }
+        else
+        {
+            *out++ = '0';
+            *out++ = '.';
+            for (int i = 0; i < -exp - 1; ++i)
+                *out++ = '0';
+            std::memcpy(out, digits, nd);
+            out += nd;
+        }
+        return out - dest;
+    }
+    *out++ = digits[0];
+    if (nd > 1)
+    {
+        *out++ = '.';
+        std::memcpy(out, digits + 1, nd - 1);
+        out += nd - 1;
+    }
+    *out++ = 'e';
+    *out++ = exp < 0 ? '-' : '+';
+    unsigned const e = exp < 0 ? -exp : exp;
+    if (exp_digits == 3)
+        *out++ = static_cast<char>('0' + e / 100);
+    *out++ = static_cast<char>('0' + e / 10 % 10);
+    *out++ = static_cast<char>('0' + e % 10);
+    return out - dest;
+}
+#endif
+
+// write the magnitude of `v` to `dest`
+// and return the size. The sign is
+// written by the caller.
+template <class T>
+std::size_t
+float_to_chars(
+    char* dest,
+    T v,
+    char type,
+    int precision) noexcept
+{
+    bool const upper =
+        type == 'E' ||
+        type == 'F' ||
+        type == 'G';
+    if (!std::isfinite(v))
+    {
+        char const* s = std::isnan(v)
+            ? (upper ? "NAN" : "nan")
+            : (upper ? "INF" : "inf");
+        std::memcpy(dest, s, 3);
+        return 3;
+    }
+    v = std::fabs(v);
+    std::size_t n;
+#if defined(__cpp_lib_to_chars)
+    char* const end = dest +
+        float_formatter_impl::max_size;
+    std::to_chars_result r;
+    if (type == '\0' && precision < 0)
+    {
+        r = std::to_chars(dest, end, v);
+    }
+    else
+    {
+        std::chars_format fmt =
+            std::chars_format::general;
+        if (type == 'e' || type == 'E')
+            fmt = std::chars_format::scientific;
+        else if (type == 'f' || type == 'F')
+            fmt = std::chars_format::fixed;
+        r = std::to_chars(dest, end, v, fmt,
+            precision < 0 ? 6 : precision);
+    }
+    BOOST_ASSERT(r.ec == std::errc());
+    n = r.ptr - dest;
+#else
+    if (type == '\0' && precision < 0)
+    {
+        n = shortest_to_chars(dest, v);
+    }
+    else
+    {
+        char const* fmt = "%.*g";
+        if (type == 'e' || type == 'E')
+            fmt = "%.*e";
+        else if (type == 'f' || type == 'F')
+            fmt = "%.*f";
+        n = std::snprintf(
+            dest, float_formatter_impl::max_size,
+            fmt, precision < 0 ? 6 : precision,
+            static_cast<double>(v));
+        fix_decimal_point(dest, dest + n);
+    }
+#endif
+    if (upper)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (dest[i] == 'e')
+                dest[i] = 'E';
+        }
+    }
+    return n;
+}
+
+} // (anon)
+
 std::size_t
 get_uvalue( core::string_view a )
 {
@@ -48,6 +459,10 @@ parse(format_parse_context& ctx)
     char const* end = ctx.end();
     BOOST_ASSERT(it != end);
 
+    // fast path for "{}"
+    if (*it == '}')
+        return it;
+
     // fill / align
     if (end - it > 2)
     {
@@ -237,6 +652,10 @@ parse(format_parse_context& ctx)
     char const* end = ctx.end();
     BOOST_ASSERT(it != end);
 
+    // fast path for "{}"
+    if (*it == '}')
+        return it;
+
     // fill / align
     if (end - it > 2)
     {
@@ -358,31 +777,14 @@ measure(
     measure_context& ctx,
     grammar::lut_chars const& cs) const
 {
-    std::size_t dn = 0;
-    std::size_t n = 0;
-    if (v < 0)
-    {
-        dn += measure_one('-', cs);
-        ++n;
-    }
-    else if (sign != '-')
-    {
-        dn += measure_one(sign, cs);
-        ++n;
-    }
     // Use unsigned to avoid UB when v == LLONG_MIN
-    unsigned long long int uv = v < 0
+    bool const neg = v < 0;
+    unsigned long long int uv = neg
         ? 0ull - static_cast<unsigned long long int>(v)
         : static_cast<unsigned long long int>(v);
-    do
-    {
-        int d = static_cast<int>(uv % 10);
-        uv /= 10;
-        dn += measure_one('0' + static_cast<char>(d), cs);
-        ++n;
-    }
-    while (uv > 0);
-
+    char buf[max_digits];
+    char* const end = buf + max_digits;
+    char const* first = write_digits(end, uv);
     std::size_t w = width;
     if (width_idx != std::size_t(-1) ||
         !width_name.empty())
@@ -390,14 +792,9 @@ measure(
         get_width_from_args(
             width_idx, width_name, ctx.args(), w);
     }
-    if (w > n)
-    {
-        if (!zeros)
-            dn += measure_one(fill, cs) * (w - n);
-        else
-            dn += measure_one('0', cs) * (w - n);
-    }
-    return ctx.out() + dn;
+    return ctx.out() + measure_number(
+        sign_char(neg, sign), first, end,
+        zeros, fill, w, cs);
 }
 
 std::size_t
@@ -407,22 +804,9 @@ measure(
     measure_context& ctx,
     grammar::lut_chars const& cs) const
 {
-    std::size_t dn = 0;
-    std::size_t n = 0;
-    if (sign != '-')
-    {
-        dn += measure_one(sign, cs);
-        ++n;
-    }
-    do
-    {
-        int d = v % 10;
-        v /= 10;
-        dn += measure_one('0' + static_cast<char>(d), cs);
-        ++n;
-    }
-    while (v != 0);
-
+    char buf[max_digits];
+    char* const end = buf + max_digits;
+    char const* first = write_digits(end, v);
     std::size_t w = width;
     if (width_idx != std::size_t(-1) ||
         !width_name.empty())
@@ -430,14 +814,9 @@ measure(
         get_width_from_args(
             width_idx, width_name, ctx.args(), w);
     }
-    if (w > n)
-    {
-        if (!zeros)
-            dn += measure_one(fill, cs) * (w - n);
-        else
-            dn += measure_one('0', cs) * (w - n);
-    }
-    return ctx.out() + dn;
+    return ctx.out() + measure_number(
+        sign_char(false, sign), first, end,
+        zeros, fill, w, cs);
 }
 
 char*
@@ -447,33 +826,36 @@ format(
     format_context& ctx,
     grammar::lut_chars const& cs) const
 {
-    // get n digits
     // Use unsigned to avoid UB when v == LLONG_MIN
     bool const neg = v < 0;
     unsigned long long int uv = neg
         ? 0ull - static_cast<unsigned long long int>(v)
         : static_cast<unsigned long long int>(v);
-    unsigned long long int uv0 = uv;
-    unsigned long long int p = 1;
-    std::size_t n = 0;
-    if (neg || sign != '-')
-    {
-        ++n;
-    }
-    do
+    char buf[max_digits];
+    char* const end = buf + max_digits;
+    char const* first = write_digits(end, uv);
+    std::size_t w = width;
+    if (width_idx != std::size_t(-1) ||
+        !width_name.empty())
     {
-        if (uv >= 10)
-            p *= 10;
-        uv /= 10;
-        ++n;
+        get_width_from_args(
+            width_idx, width_name, ctx.args(), w);
     }
-    while (uv > 0);
-    static constexpr auto m =
-        std::numeric_limits<long long int>::digits10;
-    BOOST_ASSERT(n <= m + 2);
-    ignore_unused(m);
+    return format_number(
+        ctx.out(), sign_char(neg, sign), first, end,
+        zeros, fill, align, w, cs);
+}
 
-    // get pad
+char*
+integer_formatter_impl::
+format(
+    unsigned long long int v,
+    format_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    char buf[max_digits];
+    char* const end = buf + max_digits;
+    char const* first = write_digits(end, v);
     std::size_t w = width;
     if (width_idx != std::size_t(-1) ||
         !width_name.empty())
@@ -481,167 +863,289 @@ format(
         get_width_from_args(
             width_idx, width_name, ctx.args(), w);
     }
-    std::size_t lpad = 0;
-    std::size_t rpad = 0;
-    if (w > n)
+    return format_number(
+        ctx.out(), sign_char(false, sign), first, end,
+        zeros, fill, align, w, cs);
+}
+
+char const*
+float_formatter_impl::
+parse(format_parse_context& ctx)
+{
+    char const* it = ctx.begin();
+    char const* end = ctx.end();
+    BOOST_ASSERT(it != end);
+
+    // fast path for "{}"
+    if (*it == '}')
+        return it;
+
+    // fill / align
+    if (end - it > 2)
     {
-        std::size_t pad = w - n;
-        if (zeros)
-        {
-            lpad = pad;
-        }
-        else
+        if (*it != '{' &&
+            *it != '}' &&
+            (*(it + 1) == '<' ||
+             *(it + 1) == '>' ||
+             *(it + 1) == '^'))
         {
-            switch (align)
-            {
-            case '<':
-                rpad = pad;
-                break;
-            case '>':
-                lpad = pad;
-                break;
-            case '^':
-                lpad = pad / 2;
-                rpad = pad - lpad;
-                break;
-            }
+            fill = *it;
+            align = *(it + 1);
+            it += 2;
         }
     }
 
-    // write
-    uv = uv0;
-    char* out = ctx.out();
-    if (!zeros)
-    {
-        for (std::size_t i = 0; i < lpad; ++i)
-            encode_one(out, fill, cs);
-    }
-    if (neg)
-    {
-        encode_one(out, '-', cs);
-        --n;
-    }
-    else if (sign != '-')
-    {
-        encode_one(out, sign, cs);
-        --n;
-    }
-    if (zeros)
-    {
-        for (std::size_t i = 0; i < lpad; ++i)
-            encode_one(out, '0', cs);
-    }
-    while (n)
+    // align
+    if (align == '\0' &&
+        (*it == '<' ||
+         *it == '>' ||
+         *it == '^'))
     {
-        unsigned long long int d = uv / p;
-        encode_one(out, '0' + static_cast<char>(d), cs);
-        --n;
-        uv %= p;
-        p /= 10;
+        align = *it++;
     }
-    if (!zeros)
+
+    // sign
+    if (*it == '+' ||
+        *it == '-' ||
+        *it == ' ')
     {
-        for (std::size_t i = 0; i < rpad; ++i)
-            encode_one(out, fill, cs);
+        sign = *it++;
     }
-    return out;
-}
 
-char*
-integer_formatter_impl::
-format(
-unsigned long long int v,
-format_context& ctx,
-grammar::lut_chars const& cs) const
-{
-    // get n digits
-    unsigned long long int v0 = v;
-    unsigned long long int p = 1;
-    std::size_t n = 0;
-    if (sign != '-')
+    // #
+    if (*it == '#')
     {
-        ++n;
+        // alternate form not supported
+        ++it;
     }
-    do
+
+    // 0
+    if (*it == '0')
     {
-        if (v >= 10)
-            p *= 10;
-        v /= 10;
-        ++n;
+        zeros = *it++;
     }
-    while (v > 0);
-    static constexpr auto m =
-        std::numeric_limits<unsigned long long int>::digits10;
-    BOOST_ASSERT(n <= m + 2);
-    ignore_unused(m);
 
-    // get pad
-    std::size_t w = width;
-    if (width_idx != std::size_t(-1) ||
-        !width_name.empty())
+    // width
+    char const* it0 = it;
+    constexpr auto width_rule = grammar::variant_rule(
+        grammar::unsigned_rule<std::size_t>{},
+        grammar::tuple_rule(
+            grammar::squelch(
+                grammar::delim_rule('{')),
+            grammar::optional_rule(
+                arg_id_rule),
+            grammar::squelch(
+                grammar::delim_rule('}'))));
+    auto rw = grammar::parse(it, end, width_rule);
+    if (!rw)
     {
-        get_width_from_args(
-            width_idx, width_name, ctx.args(), w);
+        // rewind
+        it = it0;
     }
-    std::size_t lpad = 0;
-    std::size_t rpad = 0;
-    if (w > n)
+    else if (align != '\0')
     {
-        std::size_t pad = w - n;
-        if (zeros)
+        // width is ignored when align is '\0'
+        if (rw->index() == 0)
         {
-            lpad = pad;
+            // unsigned_rule
+            width = variant2::get<0>(*rw);
         }
         else
         {
-            switch (align)
+            // arg_id: store the id idx or string
+            auto& arg_id = variant2::get<1>(*rw);
+            if (!arg_id)
             {
-            case '<':
-                rpad = pad;
-                break;
-            case '>':
-                lpad = pad;
-                break;
-            case '^':
-                lpad = pad / 2;
-                rpad = pad - lpad;
-                break;
+                // empty arg_id, use and consume
+                // the next arg idx
+                width_idx = ctx.next_arg_id();
+            }
+            else if (arg_id->index() == 0)
+            {
+                // string identifier
+                width_name = variant2::get<0>(*arg_id);
+            }
+            else
+            {
+                // integer identifier: use the
+                // idx of this format_arg
+                width_idx = variant2::get<1>(*arg_id);
             }
         }
     }
 
-    // write
-    v = v0;
-    char* out = ctx.out();
-    if (!zeros)
+    // precision
+    if (*it == '.')
     {
-        for (std::size_t i = 0; i < lpad; ++i)
-            encode_one(out, fill, cs);
+        ++it;
+        auto rp = grammar::parse(
+            it, end, grammar::unsigned_rule<
+                unsigned short>{});
+        if (!rp ||
+            *rp > max_precision)
+        {
+            urls::detail::throw_invalid_argument();
+        }
+        precision = *rp;
     }
-    if (sign != '-')
+
+    // type
+    if (*it == 'e' ||
+        *it == 'E' ||
+        *it == 'f' ||
+        *it == 'F' ||
+        *it == 'g' ||
+        *it == 'G')
     {
-        encode_one(out, sign, cs);
-        --n;
+        type = *it++;
     }
-    if (zeros)
+
+    // we should have arrived at the end now
+    if (*it != '}')
     {
-        for (std::size_t i = 0; i < lpad; ++i)
-            encode_one(out, '0', cs);
+        urls::detail::throw_invalid_argument();
     }
-    while (n)
+
+    return it;
+}
+
+template <class T>
+std::size_t
+float_formatter_impl::
+measure_impl(
+    T v,
+    measure_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    char buf[max_size];
+    std::size_t const n = float_to_chars(
+        buf, v, type, precision);
+    std::size_t w = width;
+    if (width_idx != std::size_t(-1) ||
+        !width_name.empty())
     {
-        unsigned long long int d = v / p;
-        encode_one(out, '0' + static_cast<char>(d), cs);
-        --n;
-        v %= p;
-        p /= 10;
+        get_width_from_args(
+            width_idx, width_name, ctx.args(), w);
     }
-    if (!zeros)
+    return ctx.out() + measure_number(
+        sign_char(std::signbit(v), sign),
+        buf, buf + n,
+        zeros && std::isfinite(v),
+        fill, w, cs);
+}
+
+template <class T>
+char*
+float_formatter_impl::
+format_impl(
+    T v,
+    format_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    char buf[max_size];
+    std::size_t const n = float_to_chars(
+        buf, v, type, precision);
+    std::size_t w = width;
+    if (width_idx != std::size_t(-1) ||
+        !width_name.empty())
     {
-        for (std::size_t i = 0; i < rpad; ++i)
-            encode_one(out, fill, cs);
+        get_width_from_args(
+            width_idx, width_name, ctx.args(), w);
     }
-    return out;
+    return format_number(
+        ctx.out(),
+        sign_char(std::signbit(v), sign),
+        buf, buf + n,
+        zeros && std::isfinite(v),
+        fill, align, w, cs);
+}
+
+std::size_t
+float_formatter_impl::
+measure(
+    float v,
+    measure_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    return measure_impl(v, ctx, cs);
+}
+
+std::size_t
+float_formatter_impl::
+measure(
+    double v,
+    measure_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    return measure_impl(v, ctx, cs);
+}
+
+char*
+float_formatter_impl::
+format(
+    float v,
+    format_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    return format_impl(v, ctx, cs);
+}
+
+char*
+float_formatter_impl::
+format(
+    double v,
+    format_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    return format_impl(v, ctx, cs);
+}
+
+std::size_t
+formatter<ipv4_address>::
+measure(
+    ipv4_address const& a,
+    measure_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    char buf[ipv4_address::max_str_len];
+    return impl_.measure(
+        a.to_buffer(buf, sizeof(buf)), ctx, cs);
+}
+
+char*
+formatter<ipv4_address>::
+format(
+    ipv4_address const& a,
+    format_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    char buf[ipv4_address::max_str_len];
+    return impl_.format(
+        a.to_buffer(buf, sizeof(buf)), ctx, cs);
+}
+
+std::size_t
+formatter<ipv6_address>::
+measure(
+    ipv6_address const& a,
+    measure_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    char buf[ipv6_address::max_str_len];
+    return impl_.measure(
+        a.to_buffer(buf, sizeof(buf)), ctx, cs);
+}
+
+char*
+formatter<ipv6_address>::
+format(
+    ipv6_address const& a,
+    format_context& ctx,
+    grammar::lut_chars const& cs) const
+{
+    char buf[ipv6_address::max_str_len];
+    return impl_.format(
+        a.to_buffer(buf, sizeof(buf)), ctx, cs);
 }
 
 } // detail
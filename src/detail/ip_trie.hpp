@@ -0,0 +1,509 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_IP_TRIE_HPP
+#define BOOST_URL_DETAIL_IP_TRIE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// A 128-bit key, most significant word first
+struct ip_key128
+{
+    std::uint64_t hi;
+    std::uint64_t lo;
+
+    friend
+    ip_key128
+    operator&(
+        ip_key128 const& a,
+        ip_key128 const& b) noexcept
+    {
+        return { a.hi & b.hi, a.lo & b.lo };
+    }
+
+    friend
+    ip_key128
+    operator^(
+        ip_key128 const& a,
+        ip_key128 const& b) noexcept
+    {
+        return { a.hi ^ b.hi, a.lo ^ b.lo };
+    }
+};
+
+inline
+bool
+ip_is_zero(std::uint32_t k) noexcept
+{
+    return k == 0;
+}
+
+inline
+bool
+ip_is_zero(ip_key128 const& k) noexcept
+{
+    return (k.hi | k.lo) == 0;
+}
+
+// The mask of the first len bits
+inline
+std::uint32_t
+ip_mask(
+    std::uint32_t,
+    unsigned len) noexcept
+{
+    return static_cast<std::uint32_t>(
+        0xFFFFFFFFull << (32 - len));
+}
+
+inline
+ip_key128
+ip_mask(
+    ip_key128 const&,
+    unsigned len) noexcept
+{
+    std::uint64_t const ones = ~std::uint64_t(0);
+    if(len <= 64)
+        return {
+            len == 0 ? 0 : ones << (64 - len),
+            0 };
+    return { ones, ones << (128 - len) };
+}
+
+// The first bit after a mask, or zero
+inline
+std::uint32_t
+ip_next_bit(std::uint32_t m) noexcept
+{
+    return ~m & ~(~m >> 1);
+}
+
+inline
+ip_key128
+ip_next_bit(ip_key128 const& m) noexcept
+{
+    return {
+        ~m.hi & ~(~m.hi >> 1),
+        ~m.lo & ~((~m.lo >> 1) | (~m.hi << 63)) };
+}
+
+// The number of leading bits which are equal
+inline
+unsigned
+ip_common(
+    std::uint32_t a,
+    std::uint32_t b) noexcept
+{
+    if(a == b)
+        return 32;
+    return static_cast<unsigned>(
+        boost::core::countl_zero(a ^ b));
+}
+
+inline
+unsigned
+ip_common(
+    ip_key128 const& a,
+    ip_key128 const& b) noexcept
+{
+    if(a.hi != b.hi)
+        return static_cast<unsigned>(
+            boost::core::countl_zero(a.hi ^ b.hi));
+    if(a.lo != b.lo)
+        return 64 + static_cast<unsigned>(
+            boost::core::countl_zero(a.lo ^ b.lo));
+    return 128;
+}
+
+// The 6 bits of a key starting at bit off,
+// where bits after the key are zero
+inline
+unsigned
+ip_chunk(
+    std::uint32_t k,
+    unsigned off) noexcept
+{
+    return static_cast<unsigned>(
+        ((std::uint64_t(k) << 32) << off) >> 58);
+}
+
+inline
+unsigned
+ip_chunk(
+    ip_key128 const& k,
+    unsigned off) noexcept
+{
+    std::uint64_t const w = off < 64 ?
+        (k.hi << off) | ((k.lo >> 1) >> (63 - off)) :
+        k.lo << (off - 64);
+    return static_cast<unsigned>(w >> 58);
+}
+
+// Set the 6 bits of a key starting at bit
+// off, dropping bits after the key
+inline
+std::uint32_t
+ip_with_chunk(
+    std::uint32_t k,
+    unsigned off,
+    unsigned c) noexcept
+{
+    return k | static_cast<std::uint32_t>(
+        ((std::uint64_t(c) << 58) >> off) >> 32);
+}
+
+inline
+ip_key128
+ip_with_chunk(
+    ip_key128 k,
+    unsigned off,
+    unsigned c) noexcept
+{
+    std::uint64_t const w =
+        std::uint64_t(c) << 58;
+    if(off < 64)
+    {
+        k.hi |= w >> off;
+        if(off > 58)
+            k.lo |= w << (64 - off);
+    }
+    else
+    {
+        k.lo |= w >> (off - 64);
+    }
+    return k;
+}
+
+/*  A path-compressed binary radix tree of prefixes
+
+    Each node is a prefix, whose children
+    continue it with a 0 or a 1 bit after
+    any number of bits, so chains of nodes
+    with a single child do not exist and
+    the depth is bounded by the number of
+    prefixes. Nodes are stored in a single
+    vector and refer to their children by
+    index; the root is the empty prefix.
+
+    Each prefix has a nonzero value. The
+    tree holds the rules while they are
+    inserted, and ip_poptrie is compiled
+    from it for lookups.
+*/
+template<class Key>
+class ip_trie
+{
+    struct node
+    {
+        Key key;
+        Key mask;
+        std::uint32_t child[2];
+        unsigned char len;
+        unsigned char value;
+    };
+
+    std::vector<node> v_;
+    std::size_t n_ = 0;
+
+    std::uint32_t
+    push(
+        Key const& key,
+        unsigned len,
+        unsigned char value)
+    {
+        node n;
+        n.key = key;
+        n.mask = ip_mask(key, len);
+        n.child[0] = 0;
+        n.child[1] = 0;
+        n.len = static_cast<
+            unsigned char>(len);
+        n.value = value;
+        v_.push_back(n);
+        if(value != 0)
+            ++n_;
+        return static_cast<
+            std::uint32_t>(v_.size() - 1);
+    }
+
+public:
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    void
+    clear() noexcept
+    {
+        v_.clear();
+        n_ = 0;
+    }
+
+    // The value of the empty prefix
+    unsigned char
+    root_value() const noexcept
+    {
+        return v_.empty() ? 0 : v_[0].value;
+    }
+
+    /*  Continue a search for the longest
+        prefix of q which has at most len
+        bits, and return true if there is a
+        prefix of more than len bits which
+        starts with the first len bits of q.
+        The bits of q after len must be zero.
+
+        On entry, node i is a prefix of q with
+        at most len bits, and value is the
+        value of the longest prefix of q up to
+        node i. On exit they are updated to the
+        last such node of the search.
+    */
+    bool
+    probe(
+        Key const& q,
+        unsigned len,
+        std::uint32_t& i,
+        unsigned char& value) const noexcept
+    {
+        if(v_.empty())
+            return false;
+        node const* const base = v_.data();
+        for(;;)
+        {
+            node const& p = base[i];
+            if(p.len == len)
+                return (p.child[0] | p.child[1]) != 0;
+            std::uint32_t const c = p.child[
+                ! ip_is_zero(q &
+                    ip_next_bit(p.mask))];
+            if(c == 0)
+                return false;
+            node const& n = base[c];
+            // nodes without a value have
+            // two children, so there is a
+            // prefix under n
+            if(n.len > len)
+                return ip_common(q, n.key) >= len;
+            if(! ip_is_zero(
+                    (q ^ n.key) & n.mask))
+                return false;
+            i = c;
+            if(n.value != 0)
+                value = n.value;
+        }
+    }
+
+    // The bits of key after len must be zero
+    void
+    insert(
+        Key const& key,
+        unsigned len,
+        unsigned char value)
+    {
+        if(v_.empty())
+            push(Key{}, 0, 0);
+        std::uint32_t i = 0;
+        for(;;)
+        {
+            // the prefix of node i is a
+            // prefix of the key
+            if(v_[i].len == len)
+            {
+                if(v_[i].value == 0)
+                    ++n_;
+                v_[i].value = value;
+                return;
+            }
+            std::uint32_t const d = ! ip_is_zero(
+                key & ip_next_bit(v_[i].mask));
+            std::uint32_t const c = v_[i].child[d];
+            if(c == 0)
+            {
+                std::uint32_t const x =
+                    push(key, len, value);
+                v_[i].child[d] = x;
+                return;
+            }
+            unsigned cp = ip_common(key, v_[c].key);
+            if(cp > len)
+                cp = len;
+            if(cp > v_[c].len)
+                cp = v_[c].len;
+            if(cp == v_[c].len)
+            {
+                i = c;
+                continue;
+            }
+            // split the edge to c with the
+            // key, or with a new node where
+            // the key and c diverge
+            std::uint32_t x;
+            if(cp == len)
+            {
+                x = push(key, len, value);
+            }
+            else
+            {
+                x = push(key &
+                    ip_mask(key, cp), cp, 0);
+                std::uint32_t const y =
+                    push(key, len, value);
+                v_[x].child[! ip_is_zero(key &
+                    ip_next_bit(v_[x].mask))] = y;
+            }
+            v_[x].child[! ip_is_zero(v_[c].key &
+                ip_next_bit(v_[x].mask))] = c;
+            v_[i].child[d] = x;
+            return;
+        }
+    }
+};
+
+/*  A multibit trie compiled from an ip_trie
+
+    Each node covers the next 6 bits of a
+    key, and has a bitmap of the values of
+    these bits which continue to a child
+    node, and a bitmap of the values where
+    the result changes. The children of a
+    node and its distinct results are
+    contiguous, so the population count of
+    a bitmap below the bits of the key is
+    the index of the next node or of the
+    result. Lookups read one node per 6
+    bits of the longest prefix which
+    continues the key, without branching
+    on the bits themselves.
+
+    Based on "Poptrie: A Compressed Trie
+    with Population Count for Fast and
+    Scalable Software IP Routing Table
+    Lookup" (Asai, Ohara 2015).
+*/
+template<class Key>
+class ip_poptrie
+{
+    struct node
+    {
+        std::uint64_t vector;
+        std::uint64_t leafvec;
+        std::uint32_t base0;
+        std::uint32_t base1;
+    };
+
+    std::vector<node> nodes_;
+    std::vector<unsigned char> leaves_;
+
+    // Build node i for the prefix of off
+    // bits, whose longest prefix in t is
+    // node at with the given value
+    void
+    build(
+        ip_trie<Key> const& t,
+        std::size_t i,
+        Key const& prefix,
+        unsigned off,
+        std::uint32_t at,
+        unsigned char value)
+    {
+        Key q[64];
+        std::uint32_t qa[64];
+        unsigned char qv[64];
+        std::uint64_t vector = 0;
+        std::uint64_t leafvec = 0;
+        std::uint32_t const base0 =
+            static_cast<std::uint32_t>(
+                leaves_.size());
+        int prev = -1;
+        for(unsigned c = 0; c < 64; ++c)
+        {
+            q[c] = ip_with_chunk(prefix, off, c);
+            qa[c] = at;
+            qv[c] = value;
+            if(t.probe(q[c], off + 6, qa[c], qv[c]))
+            {
+                vector |= std::uint64_t(1) << c;
+                continue;
+            }
+            if(qv[c] != prev)
+            {
+                leafvec |= std::uint64_t(1) << c;
+                leaves_.push_back(qv[c]);
+                prev = qv[c];
+            }
+        }
+        std::size_t const base1 = nodes_.size();
+        nodes_.resize(base1 + static_cast<
+            std::size_t>(boost::core::popcount(
+                vector)));
+        node& n = nodes_[i];
+        n.vector = vector;
+        n.leafvec = leafvec;
+        n.base0 = base0;
+        n.base1 = static_cast<
+            std::uint32_t>(base1);
+        std::size_t j = base1;
+        for(unsigned c = 0; c < 64; ++c)
+            if((vector >> c) & 1)
+                build(t, j++, q[c], off + 6,
+                    qa[c], qv[c]);
+    }
+
+public:
+    // Replace the contents with the
+    // results of the prefixes in t
+    void
+    build(ip_trie<Key> const& t)
+    {
+        nodes_.clear();
+        leaves_.clear();
+        nodes_.resize(1);
+        build(t, 0, Key{}, 0, 0, t.root_value());
+        nodes_.shrink_to_fit();
+        leaves_.shrink_to_fit();
+    }
+
+    // The value of the longest prefix
+    // of k, or zero. Requires build.
+    unsigned char
+    find(Key const& k) const noexcept
+    {
+        node const* const base = nodes_.data();
+        node const* n = base;
+        unsigned off = 0;
+        unsigned c = ip_chunk(k, 0);
+        while((n->vector >> c) & 1)
+        {
+            n = base + n->base1 +
+                boost::core::popcount(n->vector &
+                    ((std::uint64_t(2) << c) - 1)) - 1;
+            off += 6;
+            c = ip_chunk(k, off);
+        }
+        return leaves_[n->base0 +
+            boost::core::popcount(n->leafvec &
+                ((std::uint64_t(2) << c) - 1)) - 1];
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
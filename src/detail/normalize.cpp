@@ -132,7 +132,7 @@ compare_encoded_query(
 void
 digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept
+    digest_sink& hasher) noexcept
 {
     char c = 0;
     std::size_t n = 0;
@@ -177,7 +177,7 @@ ci_compare_encoded(
 void
 ci_digest_encoded(
     core::string_view s,
-    fnv_1a& hasher) noexcept
+    digest_sink& hasher) noexcept
 {
     char c = 0;
     std::size_t n = 0;
@@ -236,7 +236,7 @@ ci_compare(
 void
 ci_digest(
     core::string_view s,
-    fnv_1a& hasher) noexcept
+    digest_sink& hasher) noexcept
 {
     for (char c: s)
     {
@@ -313,138 +313,90 @@ path_ends_with(
     return 0;
 }
 
-std::size_t
-remove_dot_segments(
-    char* dest0,
-    char const* end,
-    core::string_view input) noexcept
-{
-    // 1. The input buffer `s` is initialized with
-    // the now-appended path components and the
-    // output buffer `dest0` is initialized to
-    // the empty string.
-    char* dest = dest0;
-    bool const is_absolute = input.starts_with('/');
+namespace {
 
-    // Step 2 is a loop through 5 production rules:
-    // https://www.rfc-editor.org/rfc/rfc3986#section-5.2.4
-    //
-    // There are no transitions between all rules,
-    // which enables some optimizations.
-    //
-    // Initial:
-    // - Rule A: handle initial dots
-    // If the input buffer begins with a
-    // prefix of "../" or "./", then remove
-    // that prefix from the input buffer.
-    // Rule A can only happen at the beginning.
-    // Errata 4547: Keep "../" in the beginning
-    // https://www.rfc-editor.org/errata/eid4547
-    //
-    // Then:
-    // - Rule D: ignore a final ".." or "."
-    // if the input buffer consists only  of "."
-    // or "..", then remove that from the input
-    // buffer.
-    // Rule D can only happen after Rule A because:
-    // - B and C write "/" to the input
-    // - E writes "/" to input or returns
-    //
-    // Then:
-    // - Rule B: ignore ".": write "/" to the input
-    // - Rule C: apply "..": remove seg and write "/"
-    // - Rule E: copy complete segment
-    auto append =
-        [](char*& first, char const* last, core::string_view in)
-    {
-        // append `in` to `dest`
-        BOOST_ASSERT(in.size() <= std::size_t(last - first));
-        std::memmove(first, in.data(), in.size());
-        first += in.size();
-        ignore_unused(last);
-    };
+// append `in` to `dest`
+void
+rds_append(
+    char*& first,
+    char const* last,
+    core::string_view in) noexcept
+{
+    BOOST_ASSERT(in.size() <= std::size_t(last - first));
+    std::memmove(first, in.data(), in.size());
+    first += in.size();
+    ignore_unused(last);
+}
 
-    auto dot_starts_with = [](
-        core::string_view str, core::string_view dots, std::size_t& n)
+// starts_with for encoded/decoded dots
+// or decoded otherwise. return how many
+// chars in str match the dots
+bool
+dot_starts_with(
+    core::string_view str,
+    core::string_view dots,
+    std::size_t& n) noexcept
+{
+    n = 0;
+    for (char c: dots)
     {
-        // starts_with for encoded/decoded dots
-        // or decoded otherwise. return how many
-        // chars in str match the dots
-        n = 0;
-        for (char c: dots)
+        if (str.starts_with(c))
         {
-            if (str.starts_with(c))
-            {
-                str.remove_prefix(1);
-                ++n;
-                continue;
-            }
-
-            // In the general case, we would need to
-            // check if the next char is an encoded
-            // dot.
-            // However, an encoded dot in `str`
-            // would have already been decoded in
-            // url_base::normalize_path().
-            // This needs to be undone if
-            // `remove_dot_segments` is used in a
-            // different context.
-            // if (str.size() > 2 &&
-            //     c == '.'
-            //     &&
-            //     str[0] == '%' &&
-            //     str[1] == '2' &&
-            //     (str[2] == 'e' ||
-            //      str[2] == 'E'))
-            // {
-            //     str.remove_prefix(3);
-            //     n += 3;
-            //     continue;
-            // }
-
-            n = 0;
-            return false;
+            str.remove_prefix(1);
+            ++n;
+            continue;
         }
-        return true;
-    };
 
-    auto dot_equal = [&dot_starts_with](
-        core::string_view str, core::string_view dots)
-    {
-        std::size_t n = 0;
-        dot_starts_with(str, dots, n);
-        return n == str.size();
-    };
+        // In the general case, we would need to
+        // check if the next char is an encoded
+        // dot.
+        // However, an encoded dot in `str`
+        // would have already been decoded in
+        // url_base::normalize_path().
+        // This needs to be undone if
+        // `remove_dot_segments` is used in a
+        // different context.
+        // if (str.size() > 2 &&
+        //     c == '.'
+        //     &&
+        //     str[0] == '%' &&
+        //     str[1] == '2' &&
+        //     (str[2] == 'e' ||
+        //      str[2] == 'E'))
+        // {
+        //     str.remove_prefix(3);
+        //     n += 3;
+        //     continue;
+        // }
 
-    // Rule A
-    std::size_t n;
-    while (!input.empty())
-    {
-        if (dot_starts_with(input, "../", n))
-        {
-            // Errata 4547
-            append(dest, end, "../");
-            input.remove_prefix(n);
-            continue;
-        }
-        else if (!dot_starts_with(input, "./", n))
-        {
-            break;
-        }
-        input.remove_prefix(n);
+        n = 0;
+        return false;
     }
+    return true;
+}
 
-    // Rule D
-    if( dot_equal(input, "."))
-    {
-        input = {};
-    }
-    else if( dot_equal(input, "..") )
-    {
-        // Errata 4547
-        append(dest, end, "..");
-        input = {};
-    }
+bool
+dot_equal(
+    core::string_view str,
+    core::string_view dots) noexcept
+{
+    std::size_t n = 0;
+    dot_starts_with(str, dots, n);
+    return n == str.size();
+}
+
+// Step 2 of remove_dot_segments, applied to
+// `input` with [dest0, dest) already written
+// to the output buffer
+std::size_t
+remove_dot_segments_loop(
+    char* dest0,
+    char* dest,
+    char const* end,
+    core::string_view input,
+    bool is_absolute) noexcept
+{
+    std::size_t n;
 
     // 2. While the input buffer is not empty,
     // loop as follows:
@@ -468,7 +420,7 @@ remove_dot_segments(
             // iteration, which would append this
             // '/' to  the output, as required by
             // Rule E
-            append(dest, end, input.substr(0, 1));
+            rds_append(dest, end, input.substr(0, 1));
             input = {};
             break;
         }
@@ -492,7 +444,7 @@ remove_dot_segments(
                 }
                 else
                 {
-                    append(dest, end, "/..");
+                    rds_append(dest, end, "/..");
                 }
             }
             else if (dest0 != dest)
@@ -510,7 +462,7 @@ remove_dot_segments(
                 }
                 else
                 {
-                    append(dest, end, "/..");
+                    rds_append(dest, end, "/..");
                 }
             }
             else
@@ -518,7 +470,7 @@ remove_dot_segments(
                 // Output is empty
                 if (is_absolute)
                 {
-                    append(dest, end, "/..");
+                    rds_append(dest, end, "/..");
                 }
                 else
                 {
@@ -528,7 +480,7 @@ remove_dot_segments(
                     // paths will fall in the `dest0 != dest`
                     // case above of this rule C and then the
                     // general case of rule E for "..".
-                    append(dest, end, "..");
+                    rds_append(dest, end, "..");
                 }
             }
             input.remove_prefix(n - 1);
@@ -550,11 +502,11 @@ remove_dot_segments(
                 if (!prev_is_dotdot_seg)
                 {
                     dest = dest0 + p;
-                    append(dest, end, "/");
+                    rds_append(dest, end, "/");
                 }
                 else
                 {
-                    append(dest, end, "/..");
+                    rds_append(dest, end, "/..");
                 }
             }
             else if (dest0 != dest)
@@ -567,7 +519,7 @@ remove_dot_segments(
                 }
                 else
                 {
-                    append(dest, end, "/..");
+                    rds_append(dest, end, "/..");
                 }
             }
             else
@@ -575,7 +527,7 @@ remove_dot_segments(
                 // Output is empty: append dotdot
                 if (is_absolute)
                 {
-                    append(dest, end, "/..");
+                    rds_append(dest, end, "/..");
                 }
                 else
                 {
@@ -585,7 +537,7 @@ remove_dot_segments(
                     // paths will fall in the `dest0 != dest`
                     // case above of this rule C and then the
                     // general case of rule E for "..".
-                    append(dest, end, "..");
+                    rds_append(dest, end, "..");
                 }
             }
             input = {};
@@ -596,12 +548,12 @@ remove_dot_segments(
         std::size_t p = input.find_first_of('/', 1);
         if (p != core::string_view::npos)
         {
-            append(dest, end, input.substr(0, p));
+            rds_append(dest, end, input.substr(0, p));
             input.remove_prefix(p);
         }
         else
         {
-            append(dest, end, input);
+            rds_append(dest, end, input);
             input = {};
         }
     }
@@ -612,6 +564,98 @@ remove_dot_segments(
     return dest - dest0;
 }
 
+} // (anon)
+
+std::size_t
+remove_dot_segments(
+    char* dest0,
+    char const* end,
+    core::string_view input) noexcept
+{
+    // 1. The input buffer `s` is initialized with
+    // the now-appended path components and the
+    // output buffer `dest0` is initialized to
+    // the empty string.
+    char* dest = dest0;
+    bool const is_absolute = input.starts_with('/');
+
+    // Step 2 is a loop through 5 production rules:
+    // https://www.rfc-editor.org/rfc/rfc3986#section-5.2.4
+    //
+    // There are no transitions between all rules,
+    // which enables some optimizations.
+    //
+    // Initial:
+    // - Rule A: handle initial dots
+    // If the input buffer begins with a
+    // prefix of "../" or "./", then remove
+    // that prefix from the input buffer.
+    // Rule A can only happen at the beginning.
+    // Errata 4547: Keep "../" in the beginning
+    // https://www.rfc-editor.org/errata/eid4547
+    //
+    // Then:
+    // - Rule D: ignore a final ".." or "."
+    // if the input buffer consists only  of "."
+    // or "..", then remove that from the input
+    // buffer.
+    // Rule D can only happen after Rule A because:
+    // - B and C write "/" to the input
+    // - E writes "/" to input or returns
+    //
+    // Then:
+    // - Rule B: ignore ".": write "/" to the input
+    // - Rule C: apply "..": remove seg and write "/"
+    // - Rule E: copy complete segment
+    // Rule A
+    std::size_t n;
+    while (!input.empty())
+    {
+        if (dot_starts_with(input, "../", n))
+        {
+            // Errata 4547
+            rds_append(dest, end, "../");
+            input.remove_prefix(n);
+            continue;
+        }
+        else if (!dot_starts_with(input, "./", n))
+        {
+            break;
+        }
+        input.remove_prefix(n);
+    }
+
+    // Rule D
+    if( dot_equal(input, "."))
+    {
+        input = {};
+    }
+    else if( dot_equal(input, "..") )
+    {
+        // Errata 4547
+        rds_append(dest, end, "..");
+        input = {};
+    }
+
+    return remove_dot_segments_loop(
+        dest0, dest, end, input, is_absolute);
+}
+
+std::size_t
+remove_dot_segments(
+    char* dest0,
+    char* dest,
+    char const* end,
+    core::string_view input) noexcept
+{
+    BOOST_ASSERT(dest0 <= dest);
+    BOOST_ASSERT(
+        dest0 == dest || *dest0 == '/');
+    BOOST_ASSERT(input.starts_with('/'));
+    return remove_dot_segments_loop(
+        dest0, dest, end, input, true);
+}
+
 char
 path_pop_back( core::string_view& s )
 {
@@ -651,18 +695,18 @@ pop_last_segment(
         // a complete path segment, then replace
         // that prefix with "/" in the input
         // buffer; otherwise,
+        // The "/" is kept, as it ends the
+        // previous segment.
         n = detail::path_ends_with(str, "/./");
         if (n)
         {
-            seg = str.substr(str.size() - n);
-            str.remove_suffix(n);
+            str.remove_suffix(n - 1);
             continue;
         }
         n = detail::path_ends_with(str, "/.");
         if (n)
         {
-            seg = str.substr(str.size() - n, 1);
-            str.remove_suffix(n);
+            str.remove_suffix(n - 1);
             continue;
         }
 
@@ -748,7 +792,7 @@ void
 normalized_path_digest(
     core::string_view str,
     bool remove_unmatched,
-    fnv_1a& hasher) noexcept
+    digest_sink& hasher) noexcept
 {
     core::string_view seg;
     std::size_t level = 0;
@@ -10,11 +10,13 @@
 
 #include <boost/url/detail/config.hpp>
 #include "pattern.hpp"
+#include <boost/url/detail/compiled_pattern.hpp>
 #include "pct_format.hpp"
 #include "boost/url/detail/replacement_field_rule.hpp"
 #include <boost/url/grammar/alpha_chars.hpp>
 #include <boost/url/grammar/optional_rule.hpp>
 #include <boost/url/grammar/token_rule.hpp>
+#include <boost/url/grammar/unsigned_rule.hpp>
 #include <boost/url/rfc/detail/charsets.hpp>
 #include <boost/url/rfc/detail/host_rule.hpp>
 #include <boost/url/rfc/detail/path_rules.hpp>
@@ -27,11 +29,13 @@ namespace detail {
 
 static constexpr auto lhost_chars = host_chars + ':';
 
+template<class Source>
 void
 pattern::
-apply(
+apply_impl(
     url_base& u,
-    format_args const& args) const
+    format_args const& args,
+    Source& src)
 {
     // measure total
     struct sizes
@@ -47,107 +51,105 @@ apply(
     };
     sizes n;
 
-    format_parse_context pctx(nullptr, nullptr, 0);
+    using parts = parts_base;
     measure_context mctx(args);
-    if (!scheme.empty())
+    if (src.has_scheme)
     {
-        pctx = {scheme, pctx.next_arg_id()};
-        n.scheme = pct_vmeasure(
-            grammar::alpha_chars, pctx, mctx);
+        n.scheme = src.measure(
+            parts::id_scheme,
+            grammar::alpha_chars, mctx);
         mctx.advance_to(0);
     }
-    if (has_authority)
+    if (src.has_authority)
     {
-        if (has_user)
+        if (src.has_user)
         {
-            pctx = {user, pctx.next_arg_id()};
-            n.user = pct_vmeasure(
-                user_chars, pctx, mctx);
+            n.user = src.measure(
+                parts::id_user,
+                user_chars, mctx);
             mctx.advance_to(0);
-            if (has_pass)
+            if (src.has_pass)
             {
-                pctx = {pass, pctx.next_arg_id()};
-                n.pass = pct_vmeasure(
-                    password_chars, pctx, mctx);
+                n.pass = src.measure(
+                    parts::id_pass,
+                    password_chars, mctx);
                 mctx.advance_to(0);
             }
         }
-        if (host.starts_with('['))
+        if (src.ip_literal)
         {
-            BOOST_ASSERT(host.ends_with(']'));
-            pctx = {host.substr(1, host.size() - 2), pctx.next_arg_id()};
-            n.host = pct_vmeasure(
-                lhost_chars, pctx, mctx) + 2;
+            n.host = src.measure(
+                parts::id_host,
+                lhost_chars, mctx) + 2;
             mctx.advance_to(0);
         }
         else
         {
-            pctx = {host, pctx.next_arg_id()};
-            n.host = pct_vmeasure(
-                host_chars, pctx, mctx);
+            n.host = src.measure(
+                parts::id_host,
+                host_chars, mctx);
             mctx.advance_to(0);
         }
-        if (has_port)
+        if (src.has_port)
         {
-            pctx = {port, pctx.next_arg_id()};
-            n.port = pct_vmeasure(
-                grammar::digit_chars, pctx, mctx);
+            n.port = src.measure(
+                parts::id_port,
+                grammar::digit_chars, mctx);
             mctx.advance_to(0);
         }
     }
-    if (!path.empty())
+    if (src.has_path)
     {
-        pctx = {path, pctx.next_arg_id()};
-        n.path = pct_vmeasure(
-            path_chars, pctx, mctx);
+        n.path = src.measure(
+            parts::id_path,
+            path_chars, mctx);
         mctx.advance_to(0);
     }
-    if (has_query)
+    if (src.has_query)
     {
-        pctx = {query, pctx.next_arg_id()};
-        n.query = pct_vmeasure(
-            query_chars, pctx, mctx);
+        n.query = src.measure(
+            parts::id_query,
+            query_chars, mctx);
         mctx.advance_to(0);
     }
-    if (has_frag)
+    if (src.has_frag)
     {
-        pctx = {frag, pctx.next_arg_id()};
-        n.frag = pct_vmeasure(
-            fragment_chars, pctx, mctx);
+        n.frag = src.measure(
+            parts::id_frag,
+            fragment_chars, mctx);
         mctx.advance_to(0);
     }
     std::size_t const n_total =
         n.scheme +
         (n.scheme != 0) * 1 + // ":"
-        has_authority * 2 +   // "//"
+        src.has_authority * 2 + // "//"
         n.user +
-        has_pass * 1 +        // ":"
+        src.has_pass * 1 +      // ":"
         n.pass +
-        has_user * 1 +        // "@"
+        src.has_user * 1 +      // "@"
         n.host +
-        has_port * 1 +        // ":"
+        src.has_port * 1 +      // ":"
         n.port +
         n.path +
-        has_query * 1 +       // "?"
+        src.has_query * 1 +     // "?"
         n.query +
-        has_frag * 1 +        // "#"
+        src.has_frag * 1 +      // "#"
         n.frag;
     u.reserve(n_total);
 
     // Apply
-    pctx = {nullptr, nullptr, 0};
+    src.reset();
     format_context fctx(nullptr, args);
     url_base::op_t op(u);
-    using parts = parts_base;
-    if (!scheme.empty())
+    if (src.has_scheme)
     {
         auto dest = u.resize_impl(
             parts::id_scheme,
             n.scheme + 1, op);
-        pctx = {scheme, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        const char* dest1 = pct_vformat(
-            grammar::alpha_chars, pctx, fctx);
+        const char* dest1 = src.format(
+            parts::id_scheme,
+            grammar::alpha_chars, fctx);
         dest[n.scheme] = ':';
         // validate
         if (!grammar::parse({dest, dest1}, scheme_rule()))
@@ -155,28 +157,28 @@ apply(
             throw_invalid_argument();
         }
     }
-    if (has_authority)
+    if (src.has_authority)
     {
-        if (has_user)
+        if (src.has_user)
         {
             auto dest = u.set_user_impl(
                 n.user, op);
-            pctx = {user, pctx.next_arg_id()};
             fctx.advance_to(dest);
-            char const* dest1 = pct_vformat(
-                user_chars, pctx, fctx);
+            char const* dest1 = src.format(
+                parts::id_user,
+                user_chars, fctx);
             u.impl_.decoded_[parts::id_user] =
                 detail::to_size_type(
                     pct_string_view(dest, dest1 - dest)
                         ->decoded_size());
-            if (has_pass)
+            if (src.has_pass)
             {
                 char* destp = u.set_password_impl(
                     n.pass, op);
-                pctx = {pass, pctx.next_arg_id()};
                 fctx.advance_to(destp);
-                dest1 = pct_vformat(
-                    password_chars, pctx, fctx);
+                dest1 = src.format(
+                    parts::id_pass,
+                    password_chars, fctx);
                 u.impl_.decoded_[parts::id_pass] =
                     detail::to_size_type(
                         pct_string_view({destp, dest1})
@@ -185,14 +187,13 @@ apply(
         }
         auto dest = u.set_host_impl(
             n.host, op);
-        if (host.starts_with('['))
+        if (src.ip_literal)
         {
-            BOOST_ASSERT(host.ends_with(']'));
-            pctx = {host.substr(1, host.size() - 2), pctx.next_arg_id()};
             *dest++ = '[';
             fctx.advance_to(dest);
-            char* dest1 =
-                pct_vformat(lhost_chars, pctx, fctx);
+            char* dest1 = src.format(
+                parts::id_host,
+                lhost_chars, fctx);
             *dest1++ = ']';
             u.impl_.decoded_[parts::id_host] =
                 detail::to_size_type(
@@ -201,10 +202,10 @@ apply(
         }
         else
         {
-            pctx = {host, pctx.next_arg_id()};
             fctx.advance_to(dest);
-            char const* dest1 =
-                pct_vformat(host_chars, pctx, fctx);
+            char const* dest1 = src.format(
+                parts::id_host,
+                host_chars, fctx);
             u.impl_.decoded_[parts::id_host] =
                 detail::to_size_type(
                     pct_string_view(dest, dest1 - dest)
@@ -217,13 +218,13 @@ apply(
             h.addr,
             sizeof(u.impl_.ip_addr_));
         u.impl_.host_type_ = h.host_type;
-        if (has_port)
+        if (src.has_port)
         {
             dest = u.set_port_impl(n.port, op);
-            pctx = {port, pctx.next_arg_id()};
             fctx.advance_to(dest);
-            char const* dest1 = pct_vformat(
-                grammar::digit_chars, pctx, fctx);
+            char const* dest1 = src.format(
+                parts::id_port,
+                grammar::digit_chars, fctx);
             u.impl_.decoded_[parts::id_port] =
                 detail::to_size_type(
                     pct_string_view(dest, dest1 - dest)
@@ -234,15 +235,15 @@ apply(
                 u.impl_.port_number_ = p.port_number;
         }
     }
-    if (!path.empty())
+    if (src.has_path)
     {
         auto dest = u.resize_impl(
             parts::id_path,
             n.path, op);
-        pctx = {path, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        auto dest1 = pct_vformat(
-            path_chars, pctx, fctx);
+        auto dest1 = src.format(
+            parts::id_path,
+            path_chars, fctx);
         pct_string_view npath(dest, dest1 - dest);
         u.impl_.decoded_[parts::id_path] +=
             detail::to_size_type(
@@ -305,16 +306,16 @@ apply(
             *dest = '.';
         }
     }
-    if (has_query)
+    if (src.has_query)
     {
         auto dest = u.resize_impl(
             parts::id_query,
             n.query + 1, op);
         *dest++ = '?';
-        pctx = {query, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        auto dest1 = pct_vformat(
-            query_chars, pctx, fctx);
+        auto dest1 = src.format(
+            parts::id_query,
+            query_chars, fctx);
         pct_string_view nquery(dest, dest1 - dest);
         u.impl_.decoded_[parts::id_query] +=
             detail::to_size_type(
@@ -327,16 +328,16 @@ apply(
                     nquery.end(), '&') + 1);
         }
     }
-    if (has_frag)
+    if (src.has_frag)
     {
         auto dest = u.resize_impl(
             parts::id_frag,
             n.frag + 1, op);
         *dest++ = '#';
-        pctx = {frag, pctx.next_arg_id()};
         fctx.advance_to(dest);
-        auto dest1 = pct_vformat(
-            fragment_chars, pctx, fctx);
+        auto dest1 = src.format(
+            parts::id_frag,
+            fragment_chars, fctx);
         u.impl_.decoded_[parts::id_frag] +=
             detail::to_size_type(
                 make_pct_string_view(
@@ -345,6 +346,381 @@ apply(
     }
 }
 
+namespace {
+
+core::string_view
+component(
+    pattern const& p,
+    int id) noexcept
+{
+    using parts = parts_base;
+    switch(id)
+    {
+    case parts::id_scheme:
+        return p.scheme;
+    case parts::id_user:
+        return p.user;
+    case parts::id_pass:
+        return p.pass;
+    case parts::id_host:
+        if (p.host.starts_with('['))
+        {
+            BOOST_ASSERT(p.host.ends_with(']'));
+            return p.host.substr(1, p.host.size() - 2);
+        }
+        return p.host;
+    case parts::id_port:
+        return p.port;
+    case parts::id_path:
+        return p.path;
+    case parts::id_query:
+        return p.query;
+    default:
+        BOOST_ASSERT(id == parts::id_frag);
+        return p.frag;
+    }
+}
+
+grammar::lut_chars
+component_chars(
+    int id,
+    bool ip_literal) noexcept
+{
+    using parts = parts_base;
+    switch(id)
+    {
+    case parts::id_scheme:
+        return grammar::alpha_chars;
+    case parts::id_user:
+        return user_chars;
+    case parts::id_pass:
+        return password_chars;
+    case parts::id_host:
+        if (ip_literal)
+            return lhost_chars;
+        return host_chars;
+    case parts::id_port:
+        return grammar::digit_chars;
+    case parts::id_path:
+        return path_chars;
+    case parts::id_query:
+        return query_chars;
+    default:
+        BOOST_ASSERT(id == parts::id_frag);
+        return fragment_chars;
+    }
+}
+
+// Tokenizes the components of a pattern
+// each time they are measured or formatted
+class pattern_source
+{
+    pattern const& p_;
+    format_parse_context pctx_{nullptr, nullptr, 0};
+
+public:
+    bool has_scheme;
+    bool has_authority;
+    bool has_user;
+    bool has_pass;
+    bool ip_literal;
+    bool has_port;
+    bool has_path;
+    bool has_query;
+    bool has_frag;
+
+    explicit
+    pattern_source(
+        pattern const& p) noexcept
+        : p_(p)
+        , has_scheme(!p.scheme.empty())
+        , has_authority(p.has_authority)
+        , has_user(p.has_user)
+        , has_pass(p.has_pass)
+        , ip_literal(p.host.starts_with('['))
+        , has_port(p.has_port)
+        , has_path(!p.path.empty())
+        , has_query(p.has_query)
+        , has_frag(p.has_frag)
+    {
+    }
+
+    void
+    reset() noexcept
+    {
+        pctx_ = {nullptr, nullptr, 0};
+    }
+
+    std::size_t
+    measure(
+        int id,
+        grammar::lut_chars const& cs,
+        measure_context& mctx)
+    {
+        pctx_ = {component(p_, id), pctx_.next_arg_id()};
+        return pct_vmeasure(cs, pctx_, mctx);
+    }
+
+    char*
+    format(
+        int id,
+        grammar::lut_chars const& cs,
+        format_context& fctx)
+    {
+        pctx_ = {component(p_, id), pctx_.next_arg_id()};
+        return pct_vformat(cs, pctx_, fctx);
+    }
+};
+
+// Walks the pieces of a compiled pattern,
+// copying literals and formatting fields
+class compiled_source
+{
+    compiled_pattern const& cp_;
+    std::size_t next_id_ = 0;
+
+    template<class Context>
+    format_arg
+    field_arg(
+        compiled_pattern::piece const& pc,
+        format_parse_context& pctx,
+        Context& ctx) const
+    {
+        using kind = compiled_pattern::kind;
+        switch(pc.k)
+        {
+        case kind::index:
+            return ctx.arg(pc.id);
+        case kind::name:
+            return ctx.arg(core::string_view(
+                cp_.fmt.data() + pc.name, pc.n));
+        default:
+            BOOST_ASSERT(pc.k == kind::next);
+            return ctx.arg(pctx.next_arg_id());
+        }
+    }
+
+public:
+    bool has_scheme;
+    bool has_authority;
+    bool has_user;
+    bool has_pass;
+    bool ip_literal;
+    bool has_port;
+    bool has_path;
+    bool has_query;
+    bool has_frag;
+
+    explicit
+    compiled_source(
+        compiled_pattern const& cp) noexcept
+        : cp_(cp)
+        , has_scheme(cp.has_scheme)
+        , has_authority(cp.has_authority)
+        , has_user(cp.has_user)
+        , has_pass(cp.has_pass)
+        , ip_literal(cp.ip_literal)
+        , has_port(cp.has_port)
+        , has_path(cp.has_path)
+        , has_query(cp.has_query)
+        , has_frag(cp.has_frag)
+    {
+    }
+
+    void
+    reset() noexcept
+    {
+        next_id_ = 0;
+    }
+
+    std::size_t
+    measure(
+        int id,
+        grammar::lut_chars const& cs,
+        measure_context& mctx)
+    {
+        auto it = cp_.pieces.data() + cp_.first[id + 1];
+        auto const end = cp_.pieces.data() + cp_.first[id + 2];
+        char const* const fend = cp_.fmt.data() + cp_.fmt.size();
+        for (; it != end; ++it)
+        {
+            if (it->k == compiled_pattern::kind::literal)
+            {
+                mctx.advance_to(mctx.out() + it->n);
+                continue;
+            }
+            format_parse_context pctx(
+                cp_.fmt.data() + it->pos, fend, next_id_);
+            field_arg(*it, pctx, mctx).measure(pctx, mctx, cs);
+            next_id_ = pctx.next_arg_id();
+        }
+        return mctx.out();
+    }
+
+    char*
+    format(
+        int id,
+        grammar::lut_chars const& cs,
+        format_context& fctx)
+    {
+        auto it = cp_.pieces.data() + cp_.first[id + 1];
+        auto const end = cp_.pieces.data() + cp_.first[id + 2];
+        char const* const fend = cp_.fmt.data() + cp_.fmt.size();
+        for (; it != end; ++it)
+        {
+            if (it->k == compiled_pattern::kind::literal)
+            {
+                char* out = fctx.out();
+                std::memcpy(out, cp_.lits.data() + it->pos, it->n);
+                fctx.advance_to(out + it->n);
+                continue;
+            }
+            format_parse_context pctx(
+                cp_.fmt.data() + it->pos, fend, next_id_);
+            field_arg(*it, pctx, fctx).format(pctx, fctx, cs);
+            next_id_ = pctx.next_arg_id();
+        }
+        return fctx.out();
+    }
+};
+
+// Splits a component into encoded
+// literals and replacement fields
+void
+compile_component(
+    compiled_pattern& cp,
+    core::string_view s,
+    grammar::lut_chars const& cs)
+{
+    using piece = compiled_pattern::piece;
+    using kind = compiled_pattern::kind;
+    char const* it = s.data();
+    char const* const end = it + s.size();
+    while (it != end)
+    {
+        // literal prefix
+        char const* it1 = it;
+        while (
+            it1 != end &&
+            *it1 != '{')
+        {
+            ++it1;
+        }
+        if (it != it1)
+        {
+            piece pc;
+            pc.pos = cp.lits.size();
+            for (char const* i = it; i != it1; ++i)
+            {
+                char buf[3];
+                char* o = buf;
+                encode_one(o, *i, cs);
+                cp.lits.append(buf, o - buf);
+            }
+            pc.n = cp.lits.size() - pc.pos;
+            cp.pieces.push_back(pc);
+        }
+        if (it1 == end)
+            break;
+
+        // {id} or {id:specs}
+        char const* const field = it1;
+        ++it1;
+        char const* const id_start = it1;
+        while (it1 != end &&
+               *it1 != ':' &&
+               *it1 != '}')
+        {
+            ++it1;
+        }
+        core::string_view id(id_start, it1 - id_start);
+        if (it1 != end &&
+            *it1 == ':')
+            ++it1;
+        piece pc;
+        pc.pos = it1 - cp.fmt.data();
+        auto idv = grammar::parse(
+            id, grammar::unsigned_rule<std::size_t>{});
+        if (idv)
+        {
+            pc.k = kind::index;
+            pc.id = *idv;
+        }
+        else if (!id.empty())
+        {
+            pc.k = kind::name;
+            pc.name = id_start - cp.fmt.data();
+            pc.n = id.size();
+        }
+        else
+        {
+            pc.k = kind::next;
+        }
+        cp.pieces.push_back(pc);
+
+        // the pattern was validated, so
+        // the field is well-formed
+        it = field;
+        auto rv = replacement_field_rule.parse(it, end);
+        BOOST_ASSERT(rv);
+        ignore_unused(rv);
+    }
+}
+
+} // (anon)
+
+void
+pattern::
+apply(
+    url_base& u,
+    format_args const& args) const
+{
+    pattern_source src(*this);
+    apply_impl(u, args, src);
+}
+
+void
+compile_pattern(
+    compiled_pattern& cp,
+    core::string_view fmt)
+{
+    cp.fmt.assign(fmt.data(), fmt.size());
+    cp.lits.clear();
+    cp.pieces.clear();
+    pattern const p =
+        parse_pattern(cp.fmt).value();
+    pattern_source const ps(p);
+    cp.has_scheme = ps.has_scheme;
+    cp.has_authority = ps.has_authority;
+    cp.has_user = ps.has_user;
+    cp.has_pass = ps.has_pass;
+    cp.ip_literal = ps.ip_literal;
+    cp.has_port = ps.has_port;
+    cp.has_path = ps.has_path;
+    cp.has_query = ps.has_query;
+    cp.has_frag = ps.has_frag;
+    using parts = parts_base;
+    for (int id = parts::id_scheme;
+        id != parts::id_end; ++id)
+    {
+        cp.first[id + 1] = cp.pieces.size();
+        compile_component(
+            cp, component(p, id),
+            component_chars(id, cp.ip_literal));
+    }
+    cp.first[parts::id_end + 1] = cp.pieces.size();
+}
+
+void
+apply_compiled(
+    url_base& u,
+    compiled_pattern const& cp,
+    format_args const& args)
+{
+    compiled_source src(cp);
+    pattern::apply_impl(u, args, src);
+}
+
 // This rule represents a pct-encoded string
 // that contains an arbitrary number of
 // replacement ids in it
@@ -54,6 +54,18 @@ struct pattern
     apply(
         url_base& u,
         format_args const& args) const;
+
+    // Sets the components of `u` from a
+    // source which measures and formats
+    // each component. This is shared by
+    // patterns and compiled patterns.
+    template<class Source>
+    static
+    void
+    apply_impl(
+        url_base& u,
+        format_args const& args,
+        Source& src);
 };
 
 BOOST_URL_DECL
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+#ifndef BOOST_URL_DETAIL_PREFIX_LENGTH_HPP
+#define BOOST_URL_DETAIL_PREFIX_LENGTH_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_types.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Parse the "/" prefix-length at the end
+// of a network in CIDR notation, and
+// remove it from `s`
+inline
+system::result<unsigned char>
+parse_prefix_length(
+    core::string_view& s,
+    unsigned max) noexcept
+{
+    auto const pos = s.rfind('/');
+    if(pos == core::string_view::npos)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    core::string_view const d =
+        s.substr(pos + 1);
+    s = s.substr(0, pos);
+    // no leading zeroes
+    if( d.empty() ||
+        d.size() > 3 || (
+            d.size() > 1 &&
+            d[0] == '0'))
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    unsigned v = 0;
+    for(char c : d)
+    {
+        if(! grammar::digit_chars(c))
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        v = 10 * v + (c - '0');
+    }
+    if(v > max)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::out_of_range);
+    }
+    return static_cast<unsigned char>(v);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,1261 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/router.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/detail/decode.hpp>
+#include <boost/url/pct_string_view.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/replacement_field_rule.hpp>
+#include <boost/url/grammar/all_chars.hpp>
+#include <boost/url/grammar/alnum_chars.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/optional_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/range_rule.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/grammar/unsigned_rule.hpp>
+#include <boost/url/rfc/detail/path_rules.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// the kinds of segments, in the
+// order of their precedence
+enum class seg_kind : unsigned char
+{
+    literal,
+    // {id}
+    field,
+    // {id?}
+    optional,
+    // {id*}
+    star,
+    // {id+}
+    plus
+};
+
+// A path segment template
+struct segment_template
+{
+    // the decoded literal, or the id
+    // of the replacement field
+    std::string str;
+
+    // the name of the rule which
+    // constrains the field
+    std::string rule;
+
+    seg_kind kind = seg_kind::literal;
+
+    bool
+    is_dot() const noexcept
+    {
+        return kind == seg_kind::literal &&
+            str == ".";
+    }
+
+    bool
+    is_dotdot() const noexcept
+    {
+        return kind == seg_kind::literal &&
+            str == "..";
+    }
+
+    // replacement fields with the same
+    // modifier and rule are the same node
+    friend
+    bool
+    operator==(
+        segment_template const& a,
+        segment_template const& b) noexcept
+    {
+        if (a.kind != b.kind)
+            return false;
+        if (a.kind == seg_kind::literal)
+            return a.str == b.str;
+        return a.rule == b.rule;
+    }
+};
+
+// The rules which can constrain a replacement
+// field, as in {id:uint64}. Rules added to the
+// router come after the builtin rules.
+enum field_rule : std::uint16_t
+{
+    rule_none,
+    rule_digits,
+    rule_uint64,
+    rule_alpha,
+    rule_alnum,
+    rule_hex,
+    rule_uuid,
+    rule_custom
+};
+
+constexpr char const* builtin_rules[] = {
+    "",
+    "digits",
+    "uint64",
+    "alpha",
+    "alnum",
+    "hex",
+    "uuid"
+};
+
+constexpr grammar::lut_chars rule_name_chars(
+    "-_"
+    "0123456789"
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz");
+
+bool
+is_rule_name(core::string_view s) noexcept
+{
+    return
+        !s.empty() &&
+        grammar::find_if_not(
+            s.data(), s.data() + s.size(),
+            rule_name_chars) == s.data() + s.size();
+}
+
+// A segment template is either a literal string
+// or a replacement field (as in a format_string).
+// Fields cannot contain format specs, might be
+// constrained by a rule after a colon, and might
+// have one of the following modifiers:
+// - ?: optional segment
+// - *: zero or more segments
+// - +: one or more segments
+struct segment_template_rule_t
+{
+    using value_type = segment_template;
+
+    system::result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const noexcept
+    {
+        segment_template t;
+        if (it != end &&
+            *it == '{')
+        {
+            // replacement field
+            auto it0 = it;
+            ++it;
+            auto send =
+                grammar::find_if(
+                    it, end, grammar::lut_chars('}'));
+            if (send != end)
+            {
+                core::string_view s(it, send);
+                seg_kind kind = seg_kind::field;
+                if (s.ends_with('?'))
+                    kind = seg_kind::optional;
+                else if (s.ends_with('*'))
+                    kind = seg_kind::star;
+                else if (s.ends_with('+'))
+                    kind = seg_kind::plus;
+                if (kind != seg_kind::field)
+                    s.remove_suffix(1);
+                core::string_view r;
+                auto const colon = s.find(':');
+                bool const has_rule =
+                    colon != core::string_view::npos;
+                if (has_rule)
+                {
+                    r = s.substr(colon + 1);
+                    s = s.substr(0, colon);
+                }
+                if ((s.empty() ||
+                        grammar::parse(s, arg_id_rule)) &&
+                    (!has_rule ||
+                        is_rule_name(r)))
+                {
+                    it = send + 1;
+                    t.kind = kind;
+                    t.str = s;
+                    t.rule = r;
+                    return t;
+                }
+            }
+            it = it0;
+        }
+        // literal segment
+        auto rv = grammar::parse(
+            it, end, urls::detail::segment_rule);
+        BOOST_ASSERT(rv);
+        rv->decode({}, urls::string_token::assign_to(t.str));
+        return t;
+    }
+};
+
+constexpr auto segment_template_rule = segment_template_rule_t{};
+
+constexpr auto path_template_rule =
+    grammar::tuple_rule(
+        grammar::squelch(
+            grammar::optional_rule(
+                grammar::delim_rule('/'))),
+        grammar::range_rule(
+            segment_template_rule,
+            grammar::tuple_rule(
+                grammar::squelch(grammar::delim_rule('/')),
+                segment_template_rule)));
+
+constexpr std::size_t npos = std::size_t(-1);
+constexpr std::uint32_t npos32 = std::uint32_t(-1);
+
+// A node in the tree of routes, which
+// is only used to insert routes
+struct build_node
+{
+    segment_template seg;
+
+    // index of the resource
+    std::size_t resource = npos;
+
+    // index of the parent node
+    std::size_t parent = npos;
+
+    // the rule which constrains the field
+    std::uint16_t rule = rule_none;
+
+    // indexes of the child nodes
+    std::vector<std::size_t> children;
+};
+
+// A node in the flat trie. The children of
+// a node are contiguous, with the literals
+// first, sorted by size and then by value,
+// followed by the replacement fields in
+// the order of their precedence, where
+// constrained fields come first.
+struct flat_node
+{
+    // index of the first child
+    std::uint32_t first = 0;
+
+    // number of literal children
+    std::uint32_t nlit = 0;
+
+    // number of children
+    std::uint32_t n = 0;
+
+    // index of the parent node
+    std::uint32_t parent = npos32;
+
+    // index of the resource
+    std::uint32_t resource = npos32;
+
+    // the decoded literal, or the id
+    // of the field, in the string pool
+    std::uint32_t str = 0;
+    std::uint32_t len = 0;
+
+    seg_kind kind = seg_kind::literal;
+
+    // the rule which constrains the field
+    std::uint16_t rule = rule_none;
+
+    bool
+    is_literal() const noexcept
+    {
+        return kind == seg_kind::literal;
+    }
+
+    bool
+    has_modifier() const noexcept
+    {
+        return kind > seg_kind::field;
+    }
+};
+
+using seg_iter =
+    segments_encoded_view::const_iterator;
+
+} // (anon)
+
+struct router_base::impl
+{
+    // the routes as they are inserted
+    std::vector<build_node> tree;
+
+    // the frozen routes
+    std::vector<flat_node> nodes;
+    std::string pool;
+    std::size_t max_captures = 0;
+
+    // the rules added to the router, whose
+    // ids start at rule_custom
+    std::vector<std::string> rule_names;
+    std::vector<std::unique_ptr<route_rule>> rules;
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::atomic<bool> frozen{false};
+    std::mutex m;
+#else
+    bool frozen = false;
+#endif
+
+    impl()
+    {
+        // root node with no resource
+        tree.emplace_back();
+    }
+
+    std::size_t
+    insert(
+        core::string_view path,
+        std::size_t n);
+
+    void
+    add_rule(
+        core::string_view name,
+        std::unique_ptr<route_rule> r);
+
+    // return the id of a rule, or
+    // rule_none if there is none
+    std::uint16_t
+    find_rule(core::string_view name) const noexcept;
+
+    // return true if the segment satisfies
+    // the rule of the field, and the value
+    // of the segment for integer rules
+    bool
+    check(
+        flat_node const& c,
+        pct_string_view s,
+        std::uint64_t& v) const noexcept;
+
+    void
+    freeze();
+
+    void
+    freeze_once();
+
+    core::string_view
+    str(flat_node const& c) const noexcept
+    {
+        return { pool.data() + c.str, c.len };
+    }
+
+    flat_node const*
+    find_literal(
+        flat_node const& cur,
+        pct_string_view s) const noexcept;
+
+    flat_node const*
+    try_match(
+        seg_iter it,
+        seg_iter end,
+        flat_node const* cur,
+        int level,
+        core::string_view*& matches,
+        core::string_view*& ids,
+        std::uint64_t*& values) const noexcept;
+
+    flat_node const*
+    find_optional_resource(
+        flat_node const* root,
+        core::string_view*& matches,
+        core::string_view*& ids,
+        std::uint64_t*& values) const noexcept;
+};
+
+std::size_t
+router_base::
+impl::
+insert(
+    core::string_view path,
+    std::size_t n)
+{
+    // Parse dynamic route segments
+    if (path.starts_with("/"))
+        path.remove_prefix(1);
+    auto segsr =
+        grammar::parse(path, path_template_rule);
+    if (!segsr)
+        segsr.value();
+    auto segs = *segsr;
+
+    // the dot segments must not
+    // leave the root
+    {
+        int level = 0;
+        std::size_t depth = 0;
+        for (auto const& seg: segs)
+        {
+            if (seg.is_dot())
+                continue;
+            if (seg.is_dotdot())
+            {
+                if (depth == 0)
+                    --level;
+                else
+                    --depth;
+                continue;
+            }
+            if (level < 0)
+            {
+                ++level;
+                continue;
+            }
+            ++depth;
+        }
+        if (level != 0)
+            urls::detail::throw_invalid_argument();
+    }
+
+    // rules only constrain one segment,
+    // and they must exist
+    for (auto const& seg: segs)
+    {
+        if (seg.rule.empty())
+            continue;
+        if (seg.kind == seg_kind::star ||
+            seg.kind == seg_kind::plus ||
+            find_rule(seg.rule) == rule_none)
+            urls::detail::throw_invalid_argument();
+    }
+
+    // Iterate existing nodes
+    std::size_t cur = 0;
+    int level = 0;
+    for (auto it = segs.begin(); it != segs.end(); ++it)
+    {
+        segment_template seg = *it;
+        if (seg.is_dot())
+            continue;
+        if (seg.is_dotdot())
+        {
+            // discount unmatched leaf or
+            // keep track of levels behind root
+            if (cur == 0)
+            {
+                --level;
+                continue;
+            }
+            // move to parent deleting current
+            // if it carries no resource
+            std::size_t p = tree[cur].parent;
+            if (cur == tree.size() - 1 &&
+                tree[cur].resource == npos &&
+                tree[cur].children.empty())
+            {
+                auto& cs = tree[p].children;
+                cs.erase(std::remove(
+                    cs.begin(), cs.end(), cur),
+                    cs.end());
+                tree.pop_back();
+            }
+            cur = p;
+            continue;
+        }
+        // discount unmatched root parent
+        if (level < 0)
+        {
+            ++level;
+            continue;
+        }
+        // look for child
+        auto& cs = tree[cur].children;
+        auto cit = std::find_if(
+            cs.begin(), cs.end(),
+            [this, &seg](std::size_t ci)
+            {
+                return tree[ci].seg == seg;
+            });
+        if (cit != cs.end())
+        {
+            // move to existing child
+            cur = *cit;
+            continue;
+        }
+        // create child if it doesn't exist
+        build_node child;
+        child.rule = find_rule(seg.rule);
+        child.seg = std::move(seg);
+        child.parent = cur;
+        tree.push_back(std::move(child));
+        tree[cur].children.push_back(
+            tree.size() - 1);
+        cur = tree.size() - 1;
+    }
+    BOOST_ASSERT(level == 0);
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    frozen.store(false, std::memory_order_relaxed);
+#else
+    frozen = false;
+#endif
+    if (tree[cur].resource != npos)
+        return tree[cur].resource;
+    tree[cur].resource = n;
+    return n;
+}
+
+void
+router_base::
+impl::
+add_rule(
+    core::string_view name,
+    std::unique_ptr<route_rule> r)
+{
+    if (!is_rule_name(name) ||
+        find_rule(name) != rule_none ||
+        rules.size() >= std::size_t(
+            std::uint16_t(-1) - rule_custom))
+        urls::detail::throw_invalid_argument();
+    rule_names.emplace_back(name);
+    try
+    {
+        rules.push_back(std::move(r));
+    }
+    catch(...)
+    {
+        rule_names.pop_back();
+        throw;
+    }
+}
+
+std::uint16_t
+router_base::
+impl::
+find_rule(core::string_view name) const noexcept
+{
+    for (std::uint16_t i = rule_digits;
+        i < rule_custom; ++i)
+    {
+        if (name == builtin_rules[i])
+            return i;
+    }
+    for (std::size_t i = 0; i < rule_names.size(); ++i)
+    {
+        if (name == rule_names[i])
+            return static_cast<
+                std::uint16_t>(rule_custom + i);
+    }
+    return rule_none;
+}
+
+namespace {
+
+// return true if s is not empty and every
+// decoded char of s is in the set
+template<class CharSet>
+bool
+all_of(
+    pct_string_view s,
+    CharSet const& cs) noexcept
+{
+    if (s.empty())
+        return false;
+    if (s.decoded_size() == s.size())
+    {
+        char const* const end =
+            s.data() + s.size();
+        return grammar::find_if_not(
+            s.data(), end, cs) == end;
+    }
+    for (char c: *s)
+    {
+        if (!cs(c))
+            return false;
+    }
+    return true;
+}
+
+// decode s into a buffer of n chars,
+// unless it is longer than that
+bool
+decode_small(
+    pct_string_view s,
+    char* buf,
+    std::size_t n,
+    core::string_view& out) noexcept
+{
+    std::size_t const dn = s.decoded_size();
+    if (dn > n)
+        return false;
+    if (dn == s.size())
+    {
+        out = s;
+        return true;
+    }
+    urls::detail::decode_unsafe(
+        buf, buf + dn, s);
+    out = core::string_view(buf, dn);
+    return true;
+}
+
+} // (anon)
+
+bool
+router_base::
+impl::
+check(
+    flat_node const& c,
+    pct_string_view s,
+    std::uint64_t& v) const noexcept
+{
+    v = 0;
+    switch (c.rule)
+    {
+    case rule_none:
+        return true;
+    case rule_digits:
+        return all_of(s, grammar::digit_chars);
+    case rule_uint64:
+    {
+        char buf[20];
+        core::string_view d;
+        if (!decode_small(s, buf, sizeof(buf), d))
+            return false;
+        auto rv = grammar::parse(d,
+            grammar::unsigned_rule<std::uint64_t>{});
+        if (!rv)
+            return false;
+        v = *rv;
+        return true;
+    }
+    case rule_alpha:
+        return all_of(s, grammar::alpha_chars);
+    case rule_alnum:
+        return all_of(s, grammar::alnum_chars);
+    case rule_hex:
+        return all_of(s, grammar::hexdig_chars);
+    case rule_uuid:
+    {
+        // 8-4-4-4-12 hexadecimal digits
+        char buf[36];
+        core::string_view d;
+        if (s.decoded_size() != sizeof(buf) ||
+            !decode_small(s, buf, sizeof(buf), d))
+            return false;
+        for (std::size_t i = 0; i < d.size(); ++i)
+        {
+            if (i == 8 || i == 13 ||
+                i == 18 || i == 23)
+            {
+                if (d[i] != '-')
+                    return false;
+            }
+            else if (!grammar::hexdig_chars(d[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    default:
+        break;
+    }
+    return rules[c.rule - rule_custom]->match(s);
+}
+
+void
+router_base::
+impl::
+freeze()
+{
+    std::vector<flat_node> ns;
+    std::string ps;
+    std::vector<std::size_t> captures;
+    std::size_t max_c = 0;
+
+    // breadth first, so the children
+    // of each node are contiguous
+    std::vector<std::size_t> order;
+    order.reserve(tree.size());
+    ns.reserve(tree.size());
+    captures.reserve(tree.size());
+    order.push_back(0);
+    ns.emplace_back();
+    ns.back().resource = static_cast<
+        std::uint32_t>(tree[0].resource);
+    captures.push_back(0);
+    std::vector<std::size_t> cs;
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        build_node const& t = tree[order[i]];
+        cs = t.children;
+        std::stable_sort(
+            cs.begin(), cs.end(),
+            [this](std::size_t a, std::size_t b)
+            {
+                auto const& sa = tree[a].seg;
+                auto const& sb = tree[b].seg;
+                if (sa.kind != sb.kind)
+                    return sa.kind < sb.kind;
+                if (sa.kind != seg_kind::literal)
+                    return
+                        tree[a].rule != rule_none &&
+                        tree[b].rule == rule_none;
+                if (sa.str.size() != sb.str.size())
+                    return sa.str.size() < sb.str.size();
+                return sa.str < sb.str;
+            });
+        ns[i].first = static_cast<
+            std::uint32_t>(order.size());
+        ns[i].n = static_cast<
+            std::uint32_t>(cs.size());
+        for (std::size_t c: cs)
+        {
+            build_node const& tc = tree[c];
+            if (tc.seg.kind == seg_kind::literal)
+                ++ns[i].nlit;
+            order.push_back(c);
+            flat_node f;
+            f.parent = static_cast<std::uint32_t>(i);
+            f.resource = static_cast<
+                std::uint32_t>(tc.resource);
+            f.kind = tc.seg.kind;
+            f.rule = tc.rule;
+            f.str = static_cast<
+                std::uint32_t>(ps.size());
+            f.len = static_cast<
+                std::uint32_t>(tc.seg.str.size());
+            ps.append(tc.seg.str);
+            ns.push_back(f);
+            std::size_t const nc = captures[i] +
+                (tc.seg.kind != seg_kind::literal);
+            captures.push_back(nc);
+            if (max_c < nc)
+                max_c = nc;
+        }
+    }
+    BOOST_ASSERT(ns.size() == tree.size());
+    nodes = std::move(ns);
+    pool = std::move(ps);
+    max_captures = max_c;
+}
+
+void
+router_base::
+impl::
+freeze_once()
+{
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    if (frozen.load(std::memory_order_acquire))
+        return;
+    std::lock_guard<std::mutex> lock(m);
+    if (frozen.load(std::memory_order_relaxed))
+        return;
+    freeze();
+    frozen.store(true, std::memory_order_release);
+#else
+    if (frozen)
+        return;
+    freeze();
+    frozen = true;
+#endif
+}
+
+flat_node const*
+router_base::
+impl::
+find_literal(
+    flat_node const& cur,
+    pct_string_view s) const noexcept
+{
+    // binary search the literal children
+    // by size and then by value
+    flat_node const* lo = nodes.data() + cur.first;
+    flat_node const* hi = lo + cur.nlit;
+    std::size_t const dn = s.decoded_size();
+    bool const plain = dn == s.size();
+    while (lo != hi)
+    {
+        flat_node const* mid = lo + (hi - lo) / 2;
+        int cmp;
+        if (mid->len != dn)
+            cmp = mid->len < dn ? -1 : 1;
+        else if (plain)
+            cmp = dn == 0 ? 0 : std::memcmp(
+                pool.data() + mid->str, s.data(), dn);
+        else
+            cmp = -(*s).compare(str(*mid));
+        if (cmp < 0)
+            lo = mid + 1;
+        else if (cmp > 0)
+            hi = mid;
+        else
+            return mid;
+    }
+    return nullptr;
+}
+
+flat_node const*
+router_base::
+impl::
+find_optional_resource(
+    flat_node const* root,
+    core::string_view*& matches,
+    core::string_view*& ids,
+    std::uint64_t*& values) const noexcept
+{
+    BOOST_ASSERT(root);
+    if (root->resource != npos32)
+        return root;
+    flat_node const* it =
+        nodes.data() + root->first + root->nlit;
+    flat_node const* end =
+        nodes.data() + root->first + root->n;
+    for (; it != end; ++it)
+    {
+        auto& c = *it;
+        if (c.kind != seg_kind::optional &&
+            c.kind != seg_kind::star)
+            continue;
+        // Child nodes are also
+        // potentially optional.
+        auto matches0 = matches;
+        auto ids0 = ids;
+        auto values0 = values;
+        *matches++ = {};
+        *ids++ = str(c);
+        *values++ = 0;
+        auto n = find_optional_resource(
+            &c, matches, ids, values);
+        if (n)
+            return n;
+        matches = matches0;
+        ids = ids0;
+        values = values0;
+    }
+    return nullptr;
+}
+
+flat_node const*
+router_base::
+impl::
+try_match(
+    seg_iter it,
+    seg_iter end,
+    flat_node const* cur,
+    int level,
+    core::string_view*& matches,
+    core::string_view*& ids,
+    std::uint64_t*& values) const noexcept
+{
+    flat_node const* const root = nodes.data();
+    while (it != end)
+    {
+        pct_string_view s = *it;
+        if (*s == ".")
+        {
+            // ignore segment
+            ++it;
+            continue;
+        }
+        if (*s == "..")
+        {
+            // move back to the parent node
+            ++it;
+            if (level <= 0 &&
+                cur != root)
+            {
+                if (!cur->is_literal())
+                {
+                    --matches;
+                    --ids;
+                    --values;
+                }
+                cur = root + cur->parent;
+            }
+            else
+                // there's no parent, so we
+                // discount that from the implicit
+                // tree beyond terminals
+                --level;
+            continue;
+        }
+
+        // we are in the implicit tree above the
+        // root, so discount that as a level
+        if (level < 0)
+        {
+            ++level;
+            ++it;
+            continue;
+        }
+
+        // at most one literal child matches,
+        // and every field matches. We branch
+        // when more than one child might match
+        // or a field has a modifier. Otherwise,
+        // we can just consume the node and input
+        // without any recursive function calls.
+        flat_node const* lit = find_literal(*cur, s);
+        flat_node const* first =
+            root + cur->first + cur->nlit;
+        flat_node const* last =
+            root + cur->first + cur->n;
+        bool branch = false;
+        if (first != last)
+        {
+            branch =
+                lit ||
+                last - first > 1 ||
+                first->has_modifier();
+        }
+
+        // attempt to match each child node
+        flat_node const* r = nullptr;
+        bool match_any = false;
+        if (lit)
+        {
+            // just continue from the
+            // next segment
+            if (branch)
+            {
+                r = try_match(
+                    std::next(it), end,
+                    lit, level,
+                    matches, ids, values);
+            }
+            else
+            {
+                cur = lit;
+                match_any = true;
+            }
+        }
+        for (auto cit = first;
+            !r && !match_any && cit != last;
+            ++cit)
+        {
+            auto& c = *cit;
+            // a segment which does not satisfy
+            // the rule of the field prunes
+            // this branch
+            std::uint64_t v = 0;
+            bool const valid =
+                c.rule == rule_none ||
+                check(c, s, v);
+            if (!c.has_modifier())
+            {
+                if (!valid)
+                    continue;
+                // just continue from the
+                // next segment
+                if (branch)
+                {
+                    auto matches0 = matches;
+                    auto ids0 = ids;
+                    auto values0 = values;
+                    *matches++ = *it;
+                    *ids++ = str(c);
+                    *values++ = v;
+                    r = try_match(
+                        std::next(it), end, &c,
+                        level, matches, ids, values);
+                    if (!r)
+                    {
+                        // rewind
+                        matches = matches0;
+                        ids = ids0;
+                        values = values0;
+                    }
+                }
+                else
+                {
+                    // only path possible
+                    *matches++ = *it;
+                    *ids++ = str(c);
+                    *values++ = v;
+                    cur = &c;
+                    match_any = true;
+                }
+            }
+            else if (c.kind == seg_kind::optional)
+            {
+                // attempt to match by ignoring
+                // and not ignoring the segment.
+                // we first try the complete
+                // continuation consuming the
+                // input, which is the
+                // longest and most likely
+                // match
+                auto matches0 = matches;
+                auto ids0 = ids;
+                auto values0 = values;
+                if (valid)
+                {
+                    *matches++ = *it;
+                    *ids++ = str(c);
+                    *values++ = v;
+                    r = try_match(
+                        std::next(it), end,
+                        &c, level, matches, ids, values);
+                    if (r)
+                        break;
+                    // rewind
+                    matches = matches0;
+                    ids = ids0;
+                    values = values0;
+                }
+                // try complete continuation
+                // consuming no segment
+                *matches++ = {};
+                *ids++ = str(c);
+                *values++ = 0;
+                r = try_match(
+                    it, end, &c,
+                    level, matches, ids, values);
+                if (r)
+                    break;
+                // rewind
+                matches = matches0;
+                ids = ids0;
+                values = values0;
+            }
+            else
+            {
+                // check if the next segments
+                // won't send us to a parent
+                // directory
+                auto first_seg = it;
+                std::size_t ndotdot = 0;
+                std::size_t nnondot = 0;
+                auto it1 = it;
+                bool const is_star =
+                    c.kind == seg_kind::star;
+                while (it1 != end)
+                {
+                    if (*it1 == "..")
+                    {
+                        ++ndotdot;
+                        if (ndotdot >= (nnondot + is_star))
+                            break;
+                    }
+                    else if (*it1 != ".")
+                    {
+                        ++nnondot;
+                    }
+                    ++it1;
+                }
+                if (it1 != end)
+                    break;
+
+                // attempt to match many
+                // segments
+                auto matches0 = matches;
+                auto ids0 = ids;
+                auto values0 = values;
+                *matches++ = *it;
+                *ids++ = str(c);
+                *values++ = 0;
+                // if this is a plus seg, we
+                // already consumed the first
+                // segment
+                if (!is_star)
+                {
+                    ++first_seg;
+                }
+                // {*} is usually the last
+                // match in a path.
+                // try complete continuation
+                // match for every subrange
+                // from {last, last} to
+                // {first, last}.
+                // We also try {last, last}
+                // first because it is the
+                // longest match.
+                auto start = end;
+                while (start != first_seg)
+                {
+                    r = try_match(
+                        start, end, &c,
+                        level, matches, ids, values);
+                    if (r)
+                    {
+                        core::string_view prev = *std::prev(start);
+                        *matches0 = {
+                            matches0->data(),
+                            prev.data() + prev.size()};
+                        break;
+                    }
+                    matches = matches0 + 1;
+                    ids = ids0 + 1;
+                    values = values0 + 1;
+                    --start;
+                }
+                if (r)
+                {
+                    break;
+                }
+                // start == first
+                matches = matches0 + 1;
+                ids = ids0 + 1;
+                values = values0 + 1;
+                r = try_match(
+                    start, end, &c,
+                    level, matches, ids, values);
+                if (r)
+                {
+                    if (is_star)
+                        *matches0 = {};
+                    break;
+                }
+            }
+        }
+        // r represent we already found a terminal
+        // node which is a match
+        if (r)
+            return r;
+        // if we couldn't match anything, we go
+        // one level up in the implicit tree
+        // because the path might still have a
+        // "..".
+        if (!match_any)
+            ++level;
+        ++it;
+    }
+    if (level != 0)
+    {
+        // the path ended below or above an
+        // existing node
+        return nullptr;
+    }
+    if (cur->resource == npos32)
+    {
+        // we consumed all the input and reached
+        // a node with no resource, but it might
+        // still have child optional segments
+        // with resources we can reach without
+        // consuming any input
+        return find_optional_resource(
+            cur, matches, ids, values);
+    }
+    return cur;
+}
+
+router_base::
+router_base()
+    : impl_(new impl{})
+{
+}
+
+router_base::
+~router_base()
+{
+    delete impl_;
+}
+
+router_base::
+router_base(router_base&& other) noexcept
+    : impl_(other.impl_)
+{
+    other.impl_ = nullptr;
+}
+
+router_base&
+router_base::
+operator=(router_base&& other) noexcept
+{
+    if (this != &other)
+    {
+        delete impl_;
+        impl_ = other.impl_;
+        other.impl_ = nullptr;
+    }
+    return *this;
+}
+
+std::size_t
+router_base::
+insert_impl(
+    core::string_view pattern,
+    std::size_t n)
+{
+    if (!impl_)
+        impl_ = new impl{};
+    return impl_->insert(pattern, n);
+}
+
+void
+router_base::
+add_rule_impl(
+    core::string_view name,
+    std::unique_ptr<route_rule> r)
+{
+    if (!impl_)
+        impl_ = new impl{};
+    impl_->add_rule(name, std::move(r));
+}
+
+void
+router_base::
+freeze_impl()
+{
+    if (impl_)
+        impl_->freeze_once();
+}
+
+std::size_t
+router_base::
+find_impl(
+    segments_encoded_view path,
+    core::string_view* matches,
+    core::string_view* ids,
+    std::uint64_t* values,
+    std::size_t capacity,
+    std::size_t& n) const
+{
+    n = 0;
+    if (!impl_)
+        return npos;
+    impl_->freeze_once();
+
+    // the routes need more matches
+    // than the container can hold
+    BOOST_ASSERT(
+        capacity >= impl_->max_captures);
+    if (capacity < impl_->max_captures)
+        return npos;
+
+    // parse_path is inconsistent for empty paths
+    if (path.empty())
+        path = segments_encoded_view("./");
+
+    // Iterate nodes from the root
+    core::string_view* it = matches;
+    flat_node const* p = impl_->try_match(
+        path.begin(), path.end(),
+        impl_->nodes.data(), 0,
+        it, ids, values);
+    if (!p)
+        return npos;
+    BOOST_ASSERT(it >= matches);
+    n = static_cast<std::size_t>(it - matches);
+    return p->resource;
+}
+
+} // detail
+} // urls
+} // boost
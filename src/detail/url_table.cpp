@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/detail/url_table.hpp>
+#include <boost/url/detail/wyhash.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+std::size_t
+url_table::
+find(url_view_base const& u) const noexcept
+{
+    if(v_.empty())
+        return v_.size();
+    std::size_t const i =
+        find_impl(u, digest(u));
+    if(i == 0)
+        return v_.size();
+    return i - 1;
+}
+
+std::size_t
+url_table::
+find(core::string_view s) const noexcept
+{
+    auto rv = parse_uri_reference(s);
+    if(! rv)
+        return v_.size();
+    return find(*rv);
+}
+
+std::pair<std::size_t, bool>
+url_table::
+insert(url_view_base const& u)
+{
+    std::size_t const hash = digest(u);
+    if(! v_.empty())
+    {
+        std::size_t const i =
+            find_impl(u, hash);
+        if(i != 0)
+            return { i - 1, false };
+    }
+    if(2 * (v_.size() + 1) > tab_.size())
+        rehash(tab_.empty() ?
+            16 : 2 * tab_.size());
+    // grow everything first, so that
+    // a throw leaves the table unchanged
+    if(v_.size() == v_.capacity())
+        v_.reserve(v_.empty() ?
+            8 : 2 * v_.size());
+    auto const s = u.buffer();
+    std::size_t const pos = arena_.size();
+    arena_.append(s.data(), s.size());
+    v_.push_back({ hash, pos, s.size() });
+    std::size_t const mask = tab_.size() - 1;
+    std::size_t j = hash & mask;
+    while(tab_[j] != 0)
+        j = (j + 1) & mask;
+    tab_[j] = v_.size();
+    return { v_.size() - 1, true };
+}
+
+void
+url_table::
+pop_back() noexcept
+{
+    BOOST_ASSERT(! v_.empty());
+    // No entry was inserted after this
+    // one, so none was displaced past
+    // its slot and the slot can simply
+    // be emptied.
+    entry const& e = v_.back();
+    std::size_t const mask = tab_.size() - 1;
+    std::size_t j = e.hash & mask;
+    while(tab_[j] != v_.size())
+        j = (j + 1) & mask;
+    tab_[j] = 0;
+    arena_.resize(e.pos);
+    v_.pop_back();
+}
+
+url_view
+url_table::
+get(std::size_t i) const noexcept
+{
+    BOOST_ASSERT(i < v_.size());
+    entry const& e = v_[i];
+    // keys were valid when inserted
+    return *parse_uri_reference(
+        core::string_view(
+            arena_.data() + e.pos, e.n));
+}
+
+void
+url_table::
+reserve(
+    std::size_t n,
+    std::size_t bytes)
+{
+    v_.reserve(n);
+    arena_.reserve(bytes);
+    if(2 * n <= tab_.size())
+        return;
+    std::size_t cap = 16;
+    while(cap < 2 * n)
+        cap *= 2;
+    rehash(cap);
+}
+
+void
+url_table::
+clear() noexcept
+{
+    arena_.clear();
+    v_.clear();
+    for(auto& slot : tab_)
+        slot = 0;
+}
+
+//------------------------------------------------
+
+std::size_t
+url_table::
+digest(url_view_base const& u) const noexcept
+{
+    wyhash h(seed_);
+    u.hash_append(h);
+    return static_cast<
+        std::size_t>(h.digest());
+}
+
+// Returns one plus the index of the
+// equivalent entry, or zero if none.
+std::size_t
+url_table::
+find_impl(
+    url_view_base const& u,
+    std::size_t hash) const noexcept
+{
+    BOOST_ASSERT(! tab_.empty());
+    std::size_t const mask = tab_.size() - 1;
+    std::size_t j = hash & mask;
+    for(;;)
+    {
+        std::size_t const slot = tab_[j];
+        if(slot == 0)
+            return 0;
+        if( v_[slot - 1].hash == hash &&
+            get(slot - 1).compare(u) == 0)
+            return slot;
+        j = (j + 1) & mask;
+    }
+}
+
+void
+url_table::
+rehash(std::size_t cap)
+{
+    std::vector<std::size_t> tab(cap, 0);
+    std::size_t const mask = cap - 1;
+    for(std::size_t i = 0; i < v_.size(); ++i)
+    {
+        std::size_t j = v_[i].hash & mask;
+        while(tab[j] != 0)
+            j = (j + 1) & mask;
+        tab[j] = i + 1;
+    }
+    tab_.swap(tab);
+}
+
+} // detail
+} // urls
+} // boost
+
@@ -26,6 +26,38 @@ vformat_to(
         .value().apply(u, args);
 }
 
+void
+vformat_to(
+    url_base& u,
+    core::string_view fmt,
+    static_pattern const& sp,
+    detail::format_args args)
+{
+    using parts = parts_base;
+    auto const part = [&](int id)
+    {
+        return fmt.substr(
+            sp.first[id + 1],
+            sp.last[id + 1] - sp.first[id + 1]);
+    };
+    pattern p;
+    p.scheme = part(parts::id_scheme);
+    p.user = part(parts::id_user);
+    p.pass = part(parts::id_pass);
+    p.host = part(parts::id_host);
+    p.port = part(parts::id_port);
+    p.path = part(parts::id_path);
+    p.query = part(parts::id_query);
+    p.frag = part(parts::id_frag);
+    p.has_authority = sp.has_authority;
+    p.has_user = sp.has_user;
+    p.has_pass = sp.has_pass;
+    p.has_port = sp.has_port;
+    p.has_query = sp.has_query;
+    p.has_frag = sp.has_frag;
+    p.apply(u, args);
+}
+
 
 } // detail
 } // urls
@@ -0,0 +1,270 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/ip_matcher.hpp>
+#include "detail/ip_trie.hpp"
+#include <cstdint>
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+detail::ip_key128
+ip_key(ipv6_address::bytes_type const& b) noexcept
+{
+    detail::ip_key128 k{ 0, 0 };
+    for(std::size_t i = 0; i < 8; ++i)
+    {
+        k.hi = (k.hi << 8) | b[i];
+        k.lo = (k.lo << 8) | b[i + 8];
+    }
+    return k;
+}
+
+// The IPv4 address in the last
+// four bytes of an IPv6 address
+std::uint32_t
+ip_v4_key(ipv6_address::bytes_type const& b) noexcept
+{
+    return
+        std::uint32_t(b[12]) << 24 |
+        std::uint32_t(b[13]) << 16 |
+        std::uint32_t(b[14]) <<  8 |
+        std::uint32_t(b[15]);
+}
+
+} // (anon)
+
+struct ip_matcher::impl
+{
+    detail::ip_trie<std::uint32_t> v4;
+    detail::ip_trie<detail::ip_key128> v6;
+    detail::ip_poptrie<std::uint32_t> v4_lookup;
+    detail::ip_poptrie<detail::ip_key128> v6_lookup;
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::atomic<bool> frozen{false};
+    std::mutex m;
+#else
+    bool frozen = false;
+#endif
+
+    void
+    thaw() noexcept
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        frozen.store(false, std::memory_order_relaxed);
+#else
+        frozen = false;
+#endif
+    }
+
+    BOOST_NOINLINE
+    void
+    freeze()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lock(m);
+        if (frozen.load(std::memory_order_relaxed))
+            return;
+        v4_lookup.build(v4);
+        v6_lookup.build(v6);
+        frozen.store(true, std::memory_order_release);
+#else
+        v4_lookup.build(v4);
+        v6_lookup.build(v6);
+        frozen = true;
+#endif
+    }
+
+    // matches only pay for the check
+    void
+    freeze_once()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        if (frozen.load(std::memory_order_acquire))
+            return;
+#else
+        if (frozen)
+            return;
+#endif
+        freeze();
+    }
+};
+
+ip_matcher::
+ip_matcher() noexcept = default;
+
+ip_matcher::
+~ip_matcher()
+{
+    delete impl_;
+}
+
+ip_matcher::
+ip_matcher(ip_matcher&& other) noexcept
+    : impl_(other.impl_)
+{
+    other.impl_ = nullptr;
+}
+
+ip_matcher&
+ip_matcher::
+operator=(ip_matcher&& other) noexcept
+{
+    if (this != &other)
+    {
+        delete impl_;
+        impl_ = other.impl_;
+        other.impl_ = nullptr;
+    }
+    return *this;
+}
+
+std::size_t
+ip_matcher::
+size() const noexcept
+{
+    if (!impl_)
+        return 0;
+    return impl_->v4.size() + impl_->v6.size();
+}
+
+void
+ip_matcher::
+clear() noexcept
+{
+    delete impl_;
+    impl_ = nullptr;
+}
+
+void
+ip_matcher::
+insert(
+    ipv4_network const& net,
+    bool match)
+{
+    if (!impl_)
+        impl_ = new impl{};
+    impl_->v4.insert(
+        net.address().to_uint(),
+        static_cast<unsigned>(
+            net.prefix_length()),
+        match ? 2 : 1);
+    impl_->thaw();
+}
+
+void
+ip_matcher::
+insert(
+    ipv6_network const& net,
+    bool match)
+{
+    if (!impl_)
+        impl_ = new impl{};
+    unsigned char const v = match ? 2 : 1;
+    auto const b = net.address().to_bytes();
+    if( net.prefix_length() >= 96 &&
+        net.address().is_v4_mapped())
+        impl_->v4.insert(
+            ip_v4_key(b),
+            static_cast<unsigned>(
+                net.prefix_length() - 96),
+            v);
+    else
+        impl_->v6.insert(
+            ip_key(b),
+            static_cast<unsigned>(
+                net.prefix_length()),
+            v);
+    impl_->thaw();
+}
+
+void
+ip_matcher::
+insert(
+    core::string_view s,
+    bool match)
+{
+    bool const v6 =
+        s.find(':') != core::string_view::npos;
+    if(s.find('/') == core::string_view::npos)
+    {
+        if(v6)
+            insert(ipv6_network(
+                ipv6_address(s), 128), match);
+        else
+            insert(ipv4_network(
+                ipv4_address(s), 32), match);
+        return;
+    }
+    if(v6)
+        insert(ipv6_network(s), match);
+    else
+        insert(ipv4_network(s), match);
+}
+
+bool
+ip_matcher::
+matches(
+    ipv4_address const& addr) const
+{
+    if (!impl_)
+        return false;
+    impl_->freeze_once();
+    return impl_->v4_lookup.find(
+        addr.to_uint()) == 2;
+}
+
+bool
+ip_matcher::
+matches(
+    ipv6_address const& addr) const
+{
+    if (!impl_)
+        return false;
+    impl_->freeze_once();
+    detail::ip_key128 const k =
+        ip_key(addr.to_bytes());
+    // mapped addresses are IPv4 addresses,
+    // and take the same path as them, like
+    // the rules inside ::ffff:0:0/96
+    if( k.hi == 0 &&
+        (k.lo >> 32) == 0xffff)
+        return impl_->v4_lookup.find(
+            static_cast<std::uint32_t>(k.lo)) == 2;
+    return impl_->v6_lookup.find(k) == 2;
+}
+
+bool
+ip_matcher::
+matches(
+    url_view_base const& u) const
+{
+    switch(u.host_type())
+    {
+    case host_type::ipv4:
+        return matches(
+            u.host_ipv4_address());
+    case host_type::ipv6:
+        return matches(
+            u.host_ipv6_address());
+    default:
+        return false;
+    }
+}
+
+} // urls
+} // boost
@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/ipv4_network.hpp>
+#include <boost/url/detail/except.hpp>
+#include "detail/prefix_length.hpp"
+#include <cstring>
+#include <ostream>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+ipv4_address::uint_type
+ipv4_mask(std::size_t len) noexcept
+{
+    // shifting 64 bits lets a prefix
+    // of 0 shift by 32
+    return static_cast<
+        ipv4_address::uint_type>(
+            (0xFFFFFFFFull << (32 - len)) &
+                0xFFFFFFFF);
+}
+
+} // (anon)
+
+ipv4_network::
+ipv4_network(
+    ipv4_address const& addr,
+    std::size_t prefix_length)
+{
+    if(prefix_length > 32)
+        detail::throw_out_of_range();
+    addr_ = addr.to_uint() &
+        ipv4_mask(prefix_length);
+    len_ = static_cast<
+        unsigned char>(prefix_length);
+}
+
+ipv4_network::
+ipv4_network(
+    core::string_view s)
+    : ipv4_network(
+        parse_ipv4_network(s
+            ).value(BOOST_URL_POS))
+{
+}
+
+ipv4_address
+ipv4_network::
+netmask() const noexcept
+{
+    return ipv4_address(
+        ipv4_mask(len_));
+}
+
+bool
+ipv4_network::
+contains(
+    ipv4_address const& addr) const noexcept
+{
+    return ((addr.to_uint() ^ addr_) &
+        ipv4_mask(len_)) == 0;
+}
+
+bool
+ipv4_network::
+contains(
+    ipv4_network const& other) const noexcept
+{
+    return
+        other.len_ >= len_ &&
+        ((other.addr_ ^ addr_) &
+            ipv4_mask(len_)) == 0;
+}
+
+core::string_view
+ipv4_network::
+to_buffer(
+    char* dest,
+    std::size_t dest_size) const
+{
+    if(dest_size < max_str_len)
+        detail::throw_length_error();
+    auto const s = address().to_buffer(
+        dest, dest_size);
+    char* p = dest + s.size();
+    *p++ = '/';
+    if(len_ >= 10)
+        *p++ = static_cast<char>(
+            '0' + len_ / 10);
+    *p++ = static_cast<char>(
+        '0' + len_ % 10);
+    return core::string_view(
+        dest, p - dest);
+}
+
+void
+ipv4_network::
+write_ostream(
+    std::ostream& os) const
+{
+    char buf[max_str_len];
+    os << to_buffer(buf, sizeof(buf));
+}
+
+void
+ipv4_network::
+to_string_impl(
+    string_token::arg& t) const
+{
+    char buf[max_str_len];
+    auto const s = to_buffer(
+        buf, sizeof(buf));
+    char* dest = t.prepare(s.size());
+    std::memcpy(dest, s.data(), s.size());
+}
+
+//------------------------------------------------
+
+auto
+parse_ipv4_network(
+    core::string_view s) noexcept ->
+        system::result<ipv4_network>
+{
+    auto const len =
+        detail::parse_prefix_length(s, 32);
+    if(! len)
+        return len.error();
+    auto const addr =
+        parse_ipv4_address(s);
+    if(! addr)
+        return addr.error();
+    ipv4_network n(*addr, *len);
+    // host bits must be zero
+    if(n.address() != *addr)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    return n;
+}
+
+} // urls
+} // boost
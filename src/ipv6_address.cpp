@@ -19,6 +19,68 @@
 namespace boost {
 namespace urls {
 
+namespace detail {
+
+// For each set of zero words, with word
+// i in bit i, the first longest run of at
+// least two of them as (position << 4) |
+// length, or zero
+static constexpr unsigned char ipv6_zero_runs[256] = {
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+    0x42, 0x42, 0x42, 0x02, 0x42, 0x42, 0x12, 0x03,
+    0x33, 0x33, 0x33, 0x33, 0x24, 0x24, 0x15, 0x06,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+    0x52, 0x52, 0x52, 0x02, 0x52, 0x52, 0x12, 0x03,
+    0x52, 0x52, 0x52, 0x02, 0x22, 0x22, 0x13, 0x04,
+    0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x03,
+    0x34, 0x34, 0x34, 0x34, 0x25, 0x25, 0x16, 0x07,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+    0x42, 0x42, 0x42, 0x02, 0x42, 0x42, 0x12, 0x03,
+    0x33, 0x33, 0x33, 0x33, 0x24, 0x24, 0x15, 0x06,
+    0x62, 0x62, 0x62, 0x02, 0x62, 0x62, 0x12, 0x03,
+    0x62, 0x62, 0x62, 0x02, 0x22, 0x22, 0x13, 0x04,
+    0x62, 0x62, 0x62, 0x02, 0x62, 0x62, 0x12, 0x03,
+    0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x03,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x13, 0x04,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x35, 0x35, 0x35, 0x35, 0x26, 0x26, 0x17, 0x08,
+};
+
+// The lowercase hex digits of each byte
+static constexpr char ipv6_hex_pairs[] =
+    "000102030405060708090a0b0c0d0e0f"
+    "101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f"
+    "303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f"
+    "505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f"
+    "707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f"
+    "909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeaf"
+    "b0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf"
+    "d0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeef"
+    "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+} // detail
+
 ipv6_address::
 ipv6_address(
     ipv4_address const& addr) noexcept
@@ -103,125 +165,71 @@ ipv6_address::
 print_impl(
     char* dest) const noexcept
 {
-    auto const count_zeroes =
-    []( unsigned char const* first,
-        unsigned char const* const last)
-    {
-        std::size_t n = 0;
-        while(first != last)
-        {
-            if( first[0] != 0 ||
-                first[1] != 0)
-                break;
-            n += 2;
-            first += 2;
-        }
-        return n;
-    };
-    auto const print_hex =
-    []( char* dest,
-        unsigned short v)
-    {
-        char const* const dig =
-            "0123456789abcdef";
-        if(v >= 0x1000)
-        {
-            *dest++ = dig[v>>12];
-            v &= 0x0fff;
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x100)
-        {
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x10)
-        {
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else
-        {
-            *dest++ = dig[v];
-        }
-        return dest;
-    };
+    // RFC 5952: the first longest run of
+    // two or more zero words becomes "::",
+    // and digits are lowercase without
+    // leading zeroes
     auto const dest0 = dest;
-    // find longest run of zeroes
-    std::size_t best_len = 0;
-    int best_pos = -1;
-    auto it = addr_.data();
-    auto const v4 =
-        is_v4_mapped();
-    auto const end = v4 ?
-        (it + addr_.size() - 4)
-        : it + addr_.size();
-    while(it != end)
+    if(is_v4_mapped())
     {
-        auto n = count_zeroes(
-            it, end);
-        if(n == 0)
-        {
-            it += 2;
-            continue;
-        }
-        if(n > best_len)
-        {
-            best_pos = static_cast<
-                int>(it - addr_.data());
-            best_len = n;
-        }
-        it += n;
+        std::memcpy(dest, "::ffff:", 7);
+        dest += 7;
+        ipv4_address::bytes_type bytes;
+        bytes[0] = addr_[12];
+        bytes[1] = addr_[13];
+        bytes[2] = addr_[14];
+        bytes[3] = addr_[15];
+        ipv4_address a(bytes);
+        dest += a.print_impl(dest);
+        return dest - dest0;
     }
-    it = addr_.data();
-    if(best_pos != 0)
+
+    unsigned z = 0;
+    for(unsigned i = 0; i < 8; ++i)
+        z |= static_cast<unsigned>((
+            addr_[2 * i] |
+            addr_[2 * i + 1]) == 0) << i;
+    unsigned const run =
+        detail::ipv6_zero_runs[z];
+    unsigned const len = run & 0xf;
+    unsigned const head =
+        len != 0 ? run >> 4 : 8;
+
+    // each word is written as four
+    // digits and the position advances
+    // past the significant ones, which
+    // stays within max_str_len
+    auto const put =
+    [this](char* out, unsigned i)
     {
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
-    }
-    else
+        unsigned const hi = addr_[2 * i];
+        unsigned const lo = addr_[2 * i + 1];
+        unsigned const v = hi * 256 + lo;
+        std::size_t const nd = 1 +
+            (v > 0xf) + (v > 0xff) + (v > 0xfff);
+        char t[8] = {};
+        std::memcpy(t, &detail::ipv6_hex_pairs[2 * hi], 2);
+        std::memcpy(t + 2, &detail::ipv6_hex_pairs[2 * lo], 2);
+        std::memcpy(out, t + 4 - nd, 4);
+        return out + nd;
+    };
+    unsigned i = 0;
+    while(i < head)
     {
-        *dest++ = ':';
-        it += best_len;
-        if(it == end)
+        dest = put(dest, i);
+        if(++i < head)
             *dest++ = ':';
     }
-    while(it != end)
-    {
-        *dest++ = ':';
-        if(it - addr_.data() ==
-            best_pos)
-        {
-            it += best_len;
-            if(it == end)
-                *dest++ = ':';
-            continue;
-        }
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
-    }
-    if(v4)
+    if(len == 0)
+        return dest - dest0;
+    *dest++ = ':';
+    *dest++ = ':';
+    i += len;
+    while(i < 8)
     {
-        ipv4_address::bytes_type bytes;
-        bytes[0] = it[0];
-        bytes[1] = it[1];
-        bytes[2] = it[2];
-        bytes[3] = it[3];
-        ipv4_address a(bytes);
-        *dest++ = ':';
-        dest += a.print_impl(dest);
+        dest = put(dest, i);
+        if(++i < 8)
+            *dest++ = ':';
     }
     return dest - dest0;
 }
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/ipv6_network.hpp>
+#include <boost/url/detail/except.hpp>
+#include "detail/prefix_length.hpp"
+#include <cstring>
+#include <ostream>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// the mask of byte i of a prefix
+unsigned char
+ipv6_mask(
+    std::size_t len,
+    std::size_t i) noexcept
+{
+    if(len >= 8 * i + 8)
+        return 0xff;
+    if(len <= 8 * i)
+        return 0;
+    return static_cast<unsigned char>(
+        0xff00 >> (len - 8 * i));
+}
+
+} // (anon)
+
+ipv6_network::
+ipv6_network(
+    ipv6_address const& addr,
+    std::size_t prefix_length)
+{
+    if(prefix_length > 128)
+        detail::throw_out_of_range();
+    auto b = addr.to_bytes();
+    for(std::size_t i = 0; i < 16; ++i)
+        b[i] &= ipv6_mask(prefix_length, i);
+    addr_ = ipv6_address(b);
+    len_ = static_cast<
+        unsigned char>(prefix_length);
+}
+
+ipv6_network::
+ipv6_network(
+    core::string_view s)
+    : ipv6_network(
+        parse_ipv6_network(s
+            ).value(BOOST_URL_POS))
+{
+}
+
+ipv6_address
+ipv6_network::
+netmask() const noexcept
+{
+    ipv6_address::bytes_type b;
+    for(std::size_t i = 0; i < 16; ++i)
+        b[i] = ipv6_mask(len_, i);
+    return ipv6_address(b);
+}
+
+bool
+ipv6_network::
+contains(
+    ipv6_address const& addr) const noexcept
+{
+    auto const a = addr.to_bytes();
+    auto const n = addr_.to_bytes();
+    for(std::size_t i = 0; i < 16; ++i)
+        if((a[i] ^ n[i]) & ipv6_mask(len_, i))
+            return false;
+    return true;
+}
+
+bool
+ipv6_network::
+contains(
+    ipv6_network const& other) const noexcept
+{
+    return
+        other.len_ >= len_ &&
+        contains(other.addr_);
+}
+
+core::string_view
+ipv6_network::
+to_buffer(
+    char* dest,
+    std::size_t dest_size) const
+{
+    if(dest_size < max_str_len)
+        detail::throw_length_error();
+    auto const s = addr_.to_buffer(
+        dest, dest_size);
+    char* p = dest + s.size();
+    *p++ = '/';
+    if(len_ >= 100)
+        *p++ = static_cast<char>(
+            '0' + len_ / 100);
+    if(len_ >= 10)
+        *p++ = static_cast<char>(
+            '0' + len_ / 10 % 10);
+    *p++ = static_cast<char>(
+        '0' + len_ % 10);
+    return core::string_view(
+        dest, p - dest);
+}
+
+void
+ipv6_network::
+write_ostream(
+    std::ostream& os) const
+{
+    char buf[max_str_len];
+    os << to_buffer(buf, sizeof(buf));
+}
+
+void
+ipv6_network::
+to_string_impl(
+    string_token::arg& t) const
+{
+    char buf[max_str_len];
+    auto const s = to_buffer(
+        buf, sizeof(buf));
+    char* dest = t.prepare(s.size());
+    std::memcpy(dest, s.data(), s.size());
+}
+
+//------------------------------------------------
+
+auto
+parse_ipv6_network(
+    core::string_view s) noexcept ->
+        system::result<ipv6_network>
+{
+    auto const len =
+        detail::parse_prefix_length(s, 128);
+    if(! len)
+        return len.error();
+    auto const addr =
+        parse_ipv6_address(s);
+    if(! addr)
+        return addr.error();
+    ipv6_network n(*addr, *len);
+    // host bits must be zero
+    if(n.address() != *addr)
+    {
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+    return n;
+}
+
+} // urls
+} // boost
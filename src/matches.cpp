@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
 //
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -7,7 +7,12 @@
 // Official repository: https://github.com/boostorg/url
 //
 
-#include "../matches.hpp"
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/matches.hpp>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <stdexcept>
 
 namespace boost {
 namespace urls {
@@ -56,6 +61,33 @@ operator[]( core::string_view id ) const
     return at(id);
 }
 
+std::uint64_t
+matches_base::
+integer( size_type pos ) const
+{
+    std::uint64_t const* v = values();
+    if (v && pos < size())
+    {
+        return v[pos];
+    }
+    boost::throw_exception(
+        std::out_of_range(""));
+}
+
+std::uint64_t
+matches_base::
+integer( core::string_view id ) const
+{
+    std::uint64_t const* v = values();
+    for (std::size_t i = 0; v && i < size(); ++i)
+    {
+        if (ids()[i] == id)
+            return v[i];
+    }
+    boost::throw_exception(
+        std::out_of_range(""));
+}
+
 auto
 matches_base::
 find( core::string_view id ) const
@@ -95,4 +127,3 @@ empty() const noexcept
 
 } // urls
 } // boost
-
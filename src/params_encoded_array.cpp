@@ -0,0 +1,38 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/params_encoded_array.hpp>
+
+namespace boost {
+namespace urls {
+
+params_encoded_array::
+params_encoded_array(
+    params_encoded_view const& ps)
+    : ps_(ps)
+    , data_(ps.buffer().data())
+{
+    v_.reserve(ps_.size());
+    for(param_pct_view p : ps_)
+        v_.push_back({
+            static_cast<std::size_t>(
+                p.key.data() - data_),
+            p.key.size(),
+            p.key.decoded_size(),
+            p.value.size(),
+            p.value.decoded_size(),
+            p.has_value });
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/params_index.hpp>
+#include <boost/url/decode_view.hpp>
+#include <boost/url/detail/fnv_1a.hpp>
+#include <boost/url/detail/params_iter_impl.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// Digest of the string with ASCII
+// letters folded to lowercase, so
+// keys which are equal ignoring case
+// land in the same slot.
+template<class String>
+std::size_t
+ci_key_digest(
+    String const& s) noexcept
+{
+    detail::fnv_1a h(0);
+    for(char c : s)
+        h.put(grammar::to_lower(c));
+    return h.digest();
+}
+
+} // (anon)
+
+params_index::
+params_index(
+    params_view const& ps)
+    : ps_(ps)
+{
+    std::size_t const n = ps_.size();
+    if(n == 0)
+        return;
+    std::size_t cap = 8;
+    while(cap < 2 * n)
+        cap *= 2;
+    std::size_t const mask = cap - 1;
+    v_.reserve(n);
+    tab_.resize(cap, 0);
+    // last entry of each chain, so that
+    // duplicates are linked in order
+    std::vector<std::size_t> tail(n);
+    detail::params_iter_impl it(ps_.ref_);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        auto const k = it.key();
+        v_.push_back({
+            ci_key_digest(*k),
+            it.pos, it.nk, it.dk, 0, 1 });
+        entry const& e = v_.back();
+        std::size_t j = e.hash & mask;
+        for(;;)
+        {
+            std::size_t& slot = tab_[j];
+            if(slot == 0)
+            {
+                slot = i + 1;
+                tail[i] = i;
+                break;
+            }
+            std::size_t const h = slot - 1;
+            if( v_[h].hash == e.hash &&
+                grammar::ci_is_equal(*key(h), *k))
+            {
+                v_[tail[h]].next = i + 1;
+                tail[h] = i;
+                ++v_[h].n;
+                break;
+            }
+            j = (j + 1) & mask;
+        }
+        it.increment();
+    }
+}
+
+auto
+params_index::
+find(
+    core::string_view key,
+    ignore_case_param ic) const noexcept ->
+        iterator
+{
+    std::size_t i = find_head(key);
+    if(i == 0)
+        return ps_.end();
+    if(ic)
+        return make_iterator(i - 1);
+    do
+    {
+        if(*this->key(i - 1) == key)
+            return make_iterator(i - 1);
+        i = v_[i - 1].next;
+    }
+    while(i != 0);
+    return ps_.end();
+}
+
+std::size_t
+params_index::
+count(
+    core::string_view key,
+    ignore_case_param ic) const noexcept
+{
+    std::size_t i = find_head(key);
+    if(i == 0)
+        return 0;
+    if(ic)
+        return v_[i - 1].n;
+    std::size_t n = 0;
+    do
+    {
+        if(*this->key(i - 1) == key)
+            ++n;
+        i = v_[i - 1].next;
+    }
+    while(i != 0);
+    return n;
+}
+
+std::string
+params_index::
+get_or(
+    core::string_view key,
+    core::string_view value,
+    ignore_case_param ic) const
+{
+    auto const it = find(key, ic);
+    if(it == ps_.end())
+        return std::string(value);
+    param_pct_view const p =
+        it.it_.dereference();
+    if(! p.has_value)
+        return std::string();
+    auto opt = ps_.opt_;
+    return p.value.decode(opt);
+}
+
+//------------------------------------------------
+
+// Returns one plus the index of the chain
+// head whose key matches ignoring case,
+// or zero if there is none.
+std::size_t
+params_index::
+find_head(
+    core::string_view key) const noexcept
+{
+    if(tab_.empty())
+        return 0;
+    std::size_t const mask = tab_.size() - 1;
+    std::size_t const hash = ci_key_digest(key);
+    std::size_t j = hash & mask;
+    for(;;)
+    {
+        std::size_t const slot = tab_[j];
+        if(slot == 0)
+            return 0;
+        entry const& e = v_[slot - 1];
+        if( e.hash == hash &&
+            e.dk == key.size() &&
+            grammar::ci_is_equal(
+                *this->key(slot - 1), key))
+            return slot;
+        j = (j + 1) & mask;
+    }
+}
+
+pct_string_view
+params_index::
+key(std::size_t i) const noexcept
+{
+    entry const& e = v_[i];
+    return make_pct_string_view_unsafe(
+        ps_.ref_.begin() + e.pos,
+        e.nk - 1, e.dk);
+}
+
+auto
+params_index::
+make_iterator(
+    std::size_t i) const noexcept ->
+        iterator
+{
+    return iterator(
+        detail::params_iter_impl(
+            ps_.ref_, v_[i].pos, i),
+        ps_.opt_);
+}
+
+} // urls
+} // boost
+
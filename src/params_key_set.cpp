@@ -0,0 +1,248 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/params_key_set.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+// FNV-1a over the characters, with
+// a final mix so every bit of the
+// result depends on every character
+template<class String>
+std::uint64_t
+digest(
+    String const& s,
+    std::uint64_t seed,
+    bool ic) noexcept
+{
+    std::uint64_t h =
+        seed ^ 0xcbf29ce484222325ULL;
+    for(char c : s)
+    {
+        if(ic)
+            c = grammar::to_lower(c);
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// The slot of a key is its first hash plus
+// the displacement of its bucket times its
+// second hash. The second hash is odd, so
+// the displacements of a bucket visit every
+// slot of a power of two table.
+std::size_t
+slot_of(
+    std::uint64_t h,
+    std::uint32_t d,
+    std::size_t mask) noexcept
+{
+    return static_cast<std::size_t>(
+        (h + d * ((h >> 17) | 1)) & mask);
+}
+
+std::size_t
+bucket_of(
+    std::uint64_t h,
+    std::size_t nb) noexcept
+{
+    return static_cast<std::size_t>(
+        (h >> 32) % nb);
+}
+
+} // (anon)
+
+void
+params_key_set::
+build(
+    core::string_view const* keys,
+    std::size_t n)
+{
+    // copy the unique keys
+    std::unordered_set<std::string> seen;
+    keys_.clear();
+    offsets_.clear();
+    offsets_.push_back(0);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        std::string k(keys[i]);
+        if(ic_)
+            for(char& c : k)
+                c = grammar::to_lower(c);
+        if(! seen.insert(std::move(k)).second)
+            continue;
+        keys_.append(keys[i].data(), keys[i].size());
+        if(keys_.size() > (std::numeric_limits<
+                std::uint32_t>::max)())
+            detail::throw_length_error();
+        offsets_.push_back(static_cast<
+            std::uint32_t>(keys_.size()));
+    }
+    n = offsets_.size() - 1;
+    disp_.clear();
+    slots_.clear();
+    if(n == 0)
+    {
+        offsets_.clear();
+        return;
+    }
+
+    // hash and displace: place the largest
+    // buckets first, each with the smallest
+    // displacement which moves all of its keys
+    // to free slots. When no displacement
+    // works, try another seed, and after a few
+    // seeds, a larger table.
+    std::size_t size = 1;
+    while(size < n)
+        size <<= 1;
+    std::size_t const nb = (n + 1) / 2;
+    std::vector<std::uint64_t> h(n);
+    std::vector<std::vector<std::uint32_t>> buckets;
+    std::vector<std::size_t> order(nb);
+    std::vector<std::size_t> placed;
+    for(;;)
+    {
+        for(std::uint64_t seed = 0; seed < 8; ++seed)
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                h[i] = digest(core::string_view(
+                    keys_.data() + offsets_[i],
+                    offsets_[i + 1] - offsets_[i]),
+                    seed, ic_);
+            buckets.assign(nb, {});
+            for(std::size_t i = 0; i < n; ++i)
+                buckets[bucket_of(h[i], nb)].push_back(
+                    static_cast<std::uint32_t>(i));
+            for(std::size_t b = 0; b < nb; ++b)
+                order[b] = b;
+            std::stable_sort(order.begin(), order.end(),
+                [&buckets](std::size_t a, std::size_t b)
+                {
+                    return buckets[a].size() >
+                        buckets[b].size();
+                });
+
+            disp_.assign(nb, 0);
+            slots_.assign(size, 0);
+            std::size_t const mask = size - 1;
+            bool ok = true;
+            for(std::size_t b : order)
+            {
+                auto const& keys = buckets[b];
+                if(keys.empty())
+                    break;
+                bool found = false;
+                for(std::size_t d = 0; d < size; ++d)
+                {
+                    placed.clear();
+                    for(std::uint32_t i : keys)
+                    {
+                        std::size_t const s = slot_of(
+                            h[i], static_cast<
+                                std::uint32_t>(d), mask);
+                        if(slots_[s] != 0)
+                            break;
+                        slots_[s] = i + 1;
+                        placed.push_back(s);
+                    }
+                    if(placed.size() == keys.size())
+                    {
+                        disp_[b] = static_cast<
+                            std::uint32_t>(d);
+                        found = true;
+                        break;
+                    }
+                    for(std::size_t s : placed)
+                        slots_[s] = 0;
+                }
+                if(! found)
+                {
+                    ok = false;
+                    break;
+                }
+            }
+            if(ok)
+            {
+                seed_ = seed;
+                return;
+            }
+        }
+        size <<= 1;
+    }
+}
+
+namespace {
+
+template<class String>
+bool
+find_key(
+    String const& key,
+    std::string const& keys,
+    std::vector<std::uint32_t> const& offsets,
+    std::vector<std::uint32_t> const& disp,
+    std::vector<std::uint32_t> const& slots,
+    std::uint64_t seed,
+    bool ic) noexcept
+{
+    if(slots.empty())
+        return false;
+    std::uint64_t const h =
+        digest(key, seed, ic);
+    std::uint32_t const i = slots[slot_of(
+        h, disp[bucket_of(h, disp.size())],
+        slots.size() - 1)];
+    if(i == 0)
+        return false;
+    core::string_view const k(
+        keys.data() + offsets[i - 1],
+        offsets[i] - offsets[i - 1]);
+    if(ic)
+        return grammar::ci_is_equal(key, k);
+    return key == k;
+}
+
+} // (anon)
+
+bool
+params_key_set::
+contains(
+    core::string_view key) const noexcept
+{
+    return find_key(key, keys_, offsets_,
+        disp_, slots_, seed_, ic_);
+}
+
+bool
+params_key_set::
+contains(
+    decode_view const& key) const noexcept
+{
+    return find_key(key, keys_, offsets_,
+        disp_, slots_, seed_, ic_);
+}
+
+} // urls
+} // boost
@@ -0,0 +1,200 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/prepared_base.hpp>
+#include <boost/url/decode.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <boost/url/detail/path.hpp>
+#include <boost/url/rfc/detail/charsets.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace boost {
+namespace urls {
+
+prepared_base::
+prepared_base(
+    url_view_base const& base)
+    : base_(base)
+{
+    // Without an authority the merged path
+    // may need a shield or encoded colons,
+    // which url_base::resolve takes care of.
+    if( ! base_.has_scheme() ||
+        ! base_.has_authority())
+        return;
+
+    // the path kept by an empty reference
+    url u(base_);
+    u.normalize_path();
+    path_ = u.encoded_path();
+    path_nseg_ = u.impl().nseg_;
+    path_dn_ = u.impl().decoded_[
+        detail::parts_base::id_path];
+
+    // The path merged with a relative
+    // reference starts with everything up
+    // to the last slash of the base path.
+    // Removing its dot segments now leaves
+    // it with a trailing slash and at most
+    // a leading run of "/..", so it can be
+    // kept as the start of the output of
+    // remove_dot_segments.
+    auto const p = base_.encoded_path();
+    auto const i = p.find_last_of('/');
+    u.set_encoded_path(
+        i == core::string_view::npos ?
+            core::string_view("/", 1) :
+            p.substr(0, i + 1));
+    u.normalize_path();
+    dir_ = u.encoded_path();
+    BOOST_ASSERT(
+        ! dir_.empty() && dir_.back() == '/');
+    fast_ = true;
+}
+
+system::result<void>
+prepared_base::
+resolve(
+    url_view_base const& ref,
+    url_base& dest) const
+{
+    if(! base_.has_scheme())
+    {
+        BOOST_URL_RETURN_EC(
+            error::not_a_base);
+    }
+    // ref may be a view of dest
+    auto const db = dest.buffer();
+    std::less<char const*> lt;
+    if( ! lt(ref.data(), db.data()) &&
+        lt(ref.data(), db.data() + db.size()))
+    {
+        url const tmp(ref);
+        return resolve(tmp, dest);
+    }
+    if( ! fast_ ||
+        ref.has_scheme() ||
+        ref.has_authority())
+    {
+        dest.copy(base_);
+        return dest.resolve(ref);
+    }
+
+    using parts = detail::parts_base;
+    detail::url_impl const& bi = base_.impl();
+    detail::url_impl const& ri = ref.impl();
+    auto const rpath = ri.get(parts::id_path);
+    bool const keep_path = rpath.empty();
+    detail::url_impl const& qi =
+        (keep_path && ! ref.has_query()) ?
+            bi : ri;
+    auto const query = qi.get(parts::id_query);
+    auto const frag = ri.get(parts::id_frag);
+    std::size_t const prefix =
+        bi.offset(parts::id_path);
+    core::string_view dir;
+    if(keep_path)
+        dir = path_;
+    else if(! ref.is_path_absolute())
+        dir = dir_;
+
+    url_base::op_t op(dest);
+    dest.reserve_impl(
+        prefix + dir.size() + rpath.size() +
+        query.size() + frag.size(), op);
+    char* const s = dest.s_;
+
+    // scheme and authority
+    std::memcpy(s, base_.data(), prefix);
+
+    // path
+    char* const p0 = s + prefix;
+    if(! dir.empty())
+        std::memcpy(p0, dir.data(), dir.size());
+    std::size_t np = dir.size();
+    if(! keep_path)
+    {
+        char* const it = p0 + dir.size();
+        std::memcpy(it, rpath.data(), rpath.size());
+        char* const last =
+            url_base::normalize_octets(
+                it, it, it + rpath.size(),
+                detail::segment_chars,
+                detail::empty_chars);
+        if(dir.empty())
+        {
+            np = detail::remove_dot_segments(
+                p0, last, core::string_view(
+                    p0, last - p0));
+        }
+        else
+        {
+            // the input starts at the last
+            // slash of the directory
+            np = detail::remove_dot_segments(
+                p0, it - 1, last,
+                core::string_view(
+                    it - 1, last - it + 1));
+        }
+    }
+
+    // query and fragment
+    char* const q0 = p0 + np;
+    std::memcpy(q0, query.data(), query.size());
+    char* const f0 = q0 + query.size();
+    std::memcpy(f0, frag.data(), frag.size());
+
+    detail::url_impl& impl = dest.impl_;
+    impl = bi;
+    impl.cs_ = s;
+    impl.from_ = parts::from::url;
+    impl.offset_[parts::id_query] =
+        detail::to_size_type(q0 - s);
+    impl.offset_[parts::id_frag] =
+        detail::to_size_type(f0 - s);
+    impl.offset_[parts::id_end] =
+        detail::to_size_type(
+            f0 - s + frag.size());
+    impl.decoded_[parts::id_query] =
+        qi.decoded_[parts::id_query];
+    impl.nparam_ = qi.nparam_;
+    impl.decoded_[parts::id_frag] =
+        ri.decoded_[parts::id_frag];
+    if(keep_path)
+    {
+        impl.nseg_ =
+            detail::to_size_type(path_nseg_);
+        impl.decoded_[parts::id_path] =
+            detail::to_size_type(path_dn_);
+    }
+    else
+    {
+        core::string_view const p(p0, np);
+        if(p == "/")
+            impl.nseg_ = 0;
+        else
+            impl.nseg_ = detail::to_size_type(
+                std::count(p.begin(), p.end(), '/'));
+        impl.decoded_[parts::id_path] =
+            detail::to_size_type(
+                detail::decode_bytes_unsafe(p));
+    }
+    s[dest.size()] = '\0';
+    return {};
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,535 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/public_suffix_list.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+namespace boost {
+namespace urls {
+
+/*  Layout of a compiled list
+
+    All integers are little endian.
+
+    header
+        8 bytes     magic
+        uint32      number of nodes
+        uint32      size of the label pool
+
+    nodes, 12 bytes each, where the children
+    of a node are contiguous and sorted by
+    their labels, and the root comes first
+        uint32      offset of the label in the
+                    pool (low 24 bits) and its
+                    size (high 8 bits)
+        uint32      index of the first child
+        uint16      number of children
+        uint16      flags
+
+    label pool
+*/
+
+namespace {
+
+constexpr char magic[8] = {
+    'B', 'U', 'P', 'S', 'L', '\x01', '\0', '\0' };
+constexpr std::size_t header_size = 16;
+constexpr std::size_t node_size = 12;
+
+// the labels so far are a rule
+constexpr std::uint16_t is_rule = 1;
+
+// the labels so far are an exception rule
+constexpr std::uint16_t is_exception = 2;
+
+// "*" followed by the labels so far is a rule
+constexpr std::uint16_t is_wildcard = 4;
+
+// a list with only the root
+constexpr unsigned char empty_list[
+    header_size + node_size] = {
+    'B', 'U', 'P', 'S', 'L', 1, 0, 0,
+    1, 0, 0, 0,
+    0, 0, 0, 0 };
+
+std::uint32_t
+load32(unsigned char const* p) noexcept
+{
+    return
+        std::uint32_t(p[0]) |
+        (std::uint32_t(p[1]) << 8) |
+        (std::uint32_t(p[2]) << 16) |
+        (std::uint32_t(p[3]) << 24);
+}
+
+std::uint16_t
+load16(unsigned char const* p) noexcept
+{
+    return static_cast<std::uint16_t>(
+        p[0] | (p[1] << 8));
+}
+
+void
+store32(
+    std::vector<unsigned char>& v,
+    std::uint32_t x)
+{
+    v.push_back(static_cast<unsigned char>(x));
+    v.push_back(static_cast<unsigned char>(x >> 8));
+    v.push_back(static_cast<unsigned char>(x >> 16));
+    v.push_back(static_cast<unsigned char>(x >> 24));
+}
+
+void
+store16(
+    std::vector<unsigned char>& v,
+    std::uint16_t x)
+{
+    v.push_back(static_cast<unsigned char>(x));
+    v.push_back(static_cast<unsigned char>(x >> 8));
+}
+
+// Compare the decoded, lower case
+// label s with the label t
+int
+compare_label(
+    core::string_view s,
+    unsigned char const* t,
+    std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < s.size())
+    {
+        unsigned char c;
+        signed char hi, lo;
+        if (s[i] == '%' &&
+            i + 2 < s.size() &&
+            (hi = grammar::hexdig_value(s[i + 1])) >= 0 &&
+            (lo = grammar::hexdig_value(s[i + 2])) >= 0)
+        {
+            c = static_cast<unsigned char>(
+                (hi << 4) | lo);
+            i += 3;
+        }
+        else
+        {
+            c = static_cast<unsigned char>(s[i]);
+            ++i;
+        }
+        c = static_cast<unsigned char>(
+            grammar::to_lower(static_cast<char>(c)));
+        if (j == n)
+            return 1;
+        if (c != t[j])
+            return c < t[j] ? -1 : 1;
+        ++j;
+    }
+    return j == n ? 0 : -1;
+}
+
+// a view of the nodes of a compiled list
+struct trie
+{
+    unsigned char const* nodes;
+    unsigned char const* pool;
+
+    unsigned char const*
+    node(std::size_t i) const noexcept
+    {
+        return nodes + i * node_size;
+    }
+
+    std::uint16_t
+    flags(std::size_t i) const noexcept
+    {
+        return load16(node(i) + 10);
+    }
+
+    // Return the child of i with the
+    // label s, or 0 if there is none
+    std::size_t
+    child(
+        std::size_t i,
+        core::string_view s) const noexcept
+    {
+        unsigned char const* p = node(i);
+        std::size_t lo = load32(p + 4);
+        std::size_t hi = lo + load16(p + 8);
+        while (lo < hi)
+        {
+            std::size_t const mid = lo + (hi - lo) / 2;
+            std::uint32_t const label =
+                load32(node(mid));
+            int const r = compare_label(s,
+                pool + (label & 0xffffff),
+                label >> 24);
+            if (r == 0)
+                return mid;
+            if (r < 0)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        return 0;
+    }
+};
+
+} // (anon)
+
+public_suffix_list::
+public_suffix_list() noexcept
+    : data_(empty_list)
+    , size_(sizeof(empty_list))
+{
+}
+
+public_suffix_list::
+public_suffix_list(
+    public_suffix_list const& other)
+    : storage_(other.storage_)
+    , data_(other.data_)
+    , size_(other.size_)
+{
+    if (!storage_.empty())
+        data_ = storage_.data();
+}
+
+public_suffix_list::
+public_suffix_list(
+    public_suffix_list&& other) noexcept
+    : storage_(std::move(other.storage_))
+    , data_(other.data_)
+    , size_(other.size_)
+{
+    other.storage_.clear();
+    other.data_ = empty_list;
+    other.size_ = sizeof(empty_list);
+}
+
+public_suffix_list&
+public_suffix_list::
+operator=(public_suffix_list const& other)
+{
+    if (this != &other)
+    {
+        storage_ = other.storage_;
+        data_ = storage_.empty() ?
+            other.data_ : storage_.data();
+        size_ = other.size_;
+    }
+    return *this;
+}
+
+public_suffix_list&
+public_suffix_list::
+operator=(public_suffix_list&& other) noexcept
+{
+    if (this != &other)
+    {
+        storage_ = std::move(other.storage_);
+        data_ = other.data_;
+        size_ = other.size_;
+        other.storage_.clear();
+        other.data_ = empty_list;
+        other.size_ = sizeof(empty_list);
+    }
+    return *this;
+}
+
+public_suffix_list
+public_suffix_list::
+compile(core::string_view text)
+{
+    // build the trie with one
+    // map of children per node
+    struct tnode
+    {
+        std::map<std::string, std::size_t> children;
+        std::uint16_t flags = 0;
+    };
+    std::vector<tnode> tree(1);
+
+    std::size_t pos = 0;
+    while (pos < text.size())
+    {
+        std::size_t eol = text.find('\n', pos);
+        if (eol == core::string_view::npos)
+            eol = text.size();
+        core::string_view line =
+            text.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        // a rule ends at the first whitespace
+        std::size_t const ws =
+            line.find_first_of(" \t\r");
+        if (ws != core::string_view::npos)
+            line = line.substr(0, ws);
+        if (line.empty() ||
+            line.starts_with("//"))
+            continue;
+
+        std::uint16_t flag = is_rule;
+        if (line.starts_with('!'))
+        {
+            flag = is_exception;
+            line.remove_prefix(1);
+        }
+        else if (line.starts_with('*'))
+        {
+            flag = is_wildcard;
+            line.remove_prefix(1);
+            if (!line.empty())
+            {
+                if (!line.starts_with('.'))
+                    detail::throw_invalid_argument();
+                line.remove_prefix(1);
+                if (line.empty())
+                    detail::throw_invalid_argument();
+            }
+        }
+        if (line.empty() &&
+            flag != is_wildcard)
+            detail::throw_invalid_argument();
+
+        // insert the labels from right to left
+        std::size_t n = 0;
+        std::size_t end = line.size();
+        while (end > 0)
+        {
+            std::size_t const dot =
+                line.rfind('.', end - 1);
+            std::size_t const start =
+                dot == core::string_view::npos ?
+                    0 : dot + 1;
+            core::string_view const label =
+                line.substr(start, end - start);
+            if (label.empty() ||
+                label.size() > 255 ||
+                label.contains('*'))
+                detail::throw_invalid_argument();
+            std::string key;
+            key.reserve(label.size());
+            for (char c: label)
+                key.push_back(grammar::to_lower(c));
+            auto it = tree[n].children.find(key);
+            if (it == tree[n].children.end())
+            {
+                std::size_t const id = tree.size();
+                tree[n].children.emplace(
+                    std::move(key), id);
+                tree.emplace_back();
+                n = id;
+            }
+            else
+            {
+                n = it->second;
+            }
+            if (start == 0)
+                break;
+            end = start - 1;
+            if (end == 0)
+                detail::throw_invalid_argument();
+        }
+        tree[n].flags |= flag;
+    }
+
+    // number the nodes breadth first, so
+    // the children of a node are contiguous
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> index(tree.size());
+    order.reserve(tree.size());
+    order.push_back(0);
+    for (std::size_t k = 0; k < order.size(); ++k)
+    {
+        for (auto const& c: tree[order[k]].children)
+        {
+            index[c.second] = order.size();
+            order.push_back(c.second);
+        }
+    }
+
+    // intern the labels
+    std::string pool;
+    std::unordered_map<std::string, std::size_t> offsets;
+    std::vector<std::uint32_t> labels(tree.size(), 0);
+    for (auto const& t: tree)
+    {
+        for (auto const& c: t.children)
+        {
+            auto r = offsets.emplace(
+                c.first, pool.size());
+            if (r.second)
+                pool.append(c.first);
+            labels[c.second] = static_cast<
+                std::uint32_t>(r.first->second |
+                    (c.first.size() << 24));
+        }
+    }
+    if (pool.size() > 0xffffff ||
+        tree.size() > 0xffffffff)
+        detail::throw_length_error();
+
+    public_suffix_list psl;
+    auto& v = psl.storage_;
+    v.reserve(header_size +
+        tree.size() * node_size + pool.size());
+    for (char c: magic)
+        v.push_back(static_cast<unsigned char>(c));
+    store32(v, static_cast<
+        std::uint32_t>(tree.size()));
+    store32(v, static_cast<
+        std::uint32_t>(pool.size()));
+    for (std::size_t id: order)
+    {
+        auto const& t = tree[id];
+        if (t.children.size() > 0xffff)
+            detail::throw_length_error();
+        store32(v, labels[id]);
+        store32(v, t.children.empty() ?
+            0 : static_cast<std::uint32_t>(
+                index[t.children.begin()->second]));
+        store16(v, static_cast<
+            std::uint16_t>(t.children.size()));
+        store16(v, t.flags);
+    }
+    for (char c: pool)
+        v.push_back(static_cast<unsigned char>(c));
+    psl.data_ = v.data();
+    psl.size_ = v.size();
+    return psl;
+}
+
+public_suffix_list
+public_suffix_list::
+load(
+    void const* data,
+    std::size_t size)
+{
+    auto const p = static_cast<
+        unsigned char const*>(data);
+    if (size < header_size ||
+        std::memcmp(p, magic, sizeof(magic)) != 0)
+        detail::throw_invalid_argument();
+    std::size_t const n = load32(p + 8);
+    std::size_t const pool = load32(p + 12);
+    if (n == 0 ||
+        (size - header_size) / node_size < n ||
+        size - header_size - n * node_size != pool)
+        detail::throw_invalid_argument();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        unsigned char const* q =
+            p + header_size + i * node_size;
+        std::uint32_t const label = load32(q);
+        std::size_t const first = load32(q + 4);
+        std::size_t const count = load16(q + 8);
+        if ((label & 0xffffff) + (label >> 24) > pool ||
+            (count > 0 && (
+                first <= i ||
+                first > n ||
+                count > n - first)))
+            detail::throw_invalid_argument();
+    }
+    public_suffix_list psl;
+    psl.data_ = p;
+    psl.size_ = size;
+    return psl;
+}
+
+std::size_t
+public_suffix_list::
+find(core::string_view host) const noexcept
+{
+    if (host.ends_with('.'))
+        host.remove_suffix(1);
+    if (host.empty() ||
+        host.ends_with('.'))
+        return core::string_view::npos;
+
+    std::size_t const n = load32(data_ + 8);
+    trie const t{
+        data_ + header_size,
+        data_ + header_size + n * node_size };
+
+    // when no rule matches, the
+    // suffix is the last label
+    std::size_t best = host.rfind('.');
+    best = best == core::string_view::npos ?
+        0 : best + 1;
+
+    std::size_t i = 0;
+    std::size_t end = host.size();
+    for (;;)
+    {
+        std::size_t const dot =
+            host.rfind('.', end - 1);
+        std::size_t const start =
+            dot == core::string_view::npos ?
+                0 : dot + 1;
+        core::string_view const label =
+            host.substr(start, end - start);
+        if (label.empty())
+            break;
+        if (t.flags(i) & is_wildcard)
+            best = start;
+        i = t.child(i, label);
+        if (i == 0)
+            break;
+        std::uint16_t const f = t.flags(i);
+        if (f & is_exception)
+        {
+            // the suffix is the exception
+            // without its leftmost label
+            if (end == host.size())
+                return core::string_view::npos;
+            return end + 1;
+        }
+        if (f & is_rule)
+            best = start;
+        if (start == 0)
+            break;
+        end = start - 1;
+        if (end == 0)
+            break;
+    }
+    return best;
+}
+
+core::string_view
+public_suffix_list::
+registrable_domain(
+    core::string_view host) const noexcept
+{
+    std::size_t const pos = find(host);
+    if (pos == core::string_view::npos ||
+        pos < 2)
+        return {};
+    std::size_t const dot =
+        host.rfind('.', pos - 2);
+    std::size_t const start =
+        dot == core::string_view::npos ?
+            0 : dot + 1;
+    if (start == pos - 1)
+        return {};
+    return host.substr(start,
+        host.size() - (host.ends_with('.') ? 1 : 0) - start);
+}
+
+} // urls
+} // boost
@@ -0,0 +1,648 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/sanitize.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/path.hpp>
+#include <boost/url/grammar/alpha_chars.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/rfc/detail/charsets.hpp>
+#include <boost/url/rfc/detail/host_rule.hpp>
+#include <boost/url/rfc/detail/port_rule.hpp>
+#include <boost/url/rfc/detail/scheme_rule.hpp>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+struct sanitizer
+{
+    // The components found in the input.
+    // A component is absent when its data
+    // is null.
+    struct parts
+    {
+        core::string_view scheme;
+        core::string_view user;
+        core::string_view password;
+        core::string_view host;
+        core::string_view port;
+        core::string_view path;
+        core::string_view query;
+        core::string_view fragment;
+        bool inferred = false;
+    };
+
+    static
+    bool
+    is_port(core::string_view s) noexcept
+    {
+        return grammar::find_if_not(
+            s.begin(), s.end(),
+            grammar::digit_chars) == s.end();
+    }
+
+    // path [ "?" query ] [ "#" fragment ]
+    static
+    void
+    split_relative(
+        core::string_view s,
+        parts& out) noexcept
+    {
+        auto const n = s.find_first_of("?#");
+        out.path = s.substr(0, n);
+        if(n == core::string_view::npos)
+            return;
+        if(s[n] == '#')
+        {
+            out.fragment = s.substr(n + 1);
+            return;
+        }
+        auto const m = s.find('#', n + 1);
+        if(m == core::string_view::npos)
+        {
+            out.query = s.substr(n + 1);
+            return;
+        }
+        out.query = s.substr(n + 1, m - n - 1);
+        out.fragment = s.substr(m + 1);
+    }
+
+    // [ userinfo "@" ] host [ ":" port ] relative
+    static
+    void
+    split_authority(
+        core::string_view s,
+        parts& out) noexcept
+    {
+        auto const n = s.find_first_of("/?#");
+        core::string_view hostinfo = s.substr(0, n);
+        auto const at = hostinfo.find_last_of('@');
+        if(at != core::string_view::npos)
+        {
+            core::string_view const ui =
+                hostinfo.substr(0, at);
+            auto const c = ui.find(':');
+            out.user = ui.substr(0, c);
+            if(c != core::string_view::npos)
+                out.password = ui.substr(c + 1);
+            hostinfo = hostinfo.substr(at + 1);
+        }
+
+        // the port follows the first colon,
+        // except in IP literals
+        std::size_t c = 0;
+        if(hostinfo.starts_with('['))
+            c = hostinfo.find(']');
+        if(c != core::string_view::npos)
+            c = hostinfo.find(':', c);
+        out.host = hostinfo;
+        if(c != core::string_view::npos)
+        {
+            // an invalid port stays in the
+            // host, where it is escaped
+            core::string_view const port =
+                hostinfo.substr(c + 1);
+            if(is_port(port))
+            {
+                out.host = hostinfo.substr(0, c);
+                out.port = port;
+            }
+        }
+        split_relative(s.substr(
+            hostinfo.data() + hostinfo.size() -
+                s.data()), out);
+    }
+
+    // The first segment of a relative reference
+    // is used as the authority when it looks like
+    // one. This ambiguous interpretation is what
+    // makes inputs like "www.boost.org" work in
+    // browsers, although "www.boost.org" is a
+    // valid path segment.
+    static
+    bool
+    looks_like_authority(
+        core::string_view s) noexcept
+    {
+        core::string_view const seg =
+            s.substr(0, s.find_first_of("/?#"));
+        auto const d = seg.find_first_of(".:");
+        return
+            d != core::string_view::npos &&
+            d != seg.size() - 1 &&
+            parse_authority(seg).has_value();
+    }
+
+    static
+    void
+    split(
+        core::string_view s,
+        bool infer,
+        parts& out) noexcept
+    {
+        if(! s.data())
+            s = core::string_view("", 0);
+        if(s.starts_with("//"))
+            return split_authority(
+                s.substr(2), out);
+        if(s.starts_with('/'))
+            return split_relative(s, out);
+
+        // scheme ":"
+        if( ! s.empty() &&
+            grammar::alpha_chars(s.front()))
+        {
+            static constexpr
+                grammar::lut_chars scheme_chars(
+                    "0123456789+-.ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
+            auto const n = static_cast<std::size_t>(
+                grammar::find_if_not(
+                    s.begin() + 1, s.end(),
+                    scheme_chars) - s.begin());
+            if(n < s.size() && s[n] == ':')
+            {
+                core::string_view const rest =
+                    s.substr(n + 1);
+                // "www.boost.org:8080" is a
+                // host and port, not a scheme
+                if( infer &&
+                    s.substr(0, n).find('.') !=
+                        core::string_view::npos &&
+                    ! rest.empty() &&
+                    grammar::digit_chars(rest.front()) &&
+                    looks_like_authority(s))
+                {
+                    out.inferred = true;
+                    return split_authority(s, out);
+                }
+                out.scheme = s.substr(0, n);
+                if(rest.starts_with("//"))
+                    return split_authority(
+                        rest.substr(2), out);
+                return split_relative(rest, out);
+            }
+        }
+
+        if( infer &&
+            looks_like_authority(s))
+        {
+            out.inferred = true;
+            return split_authority(s, out);
+        }
+        split_relative(s, out);
+    }
+
+    //--------------------------------------------
+
+    // Characters outside the set are escaped,
+    // as well as percent signs which do not
+    // begin a valid escape.
+    static
+    bool
+    is_escape(
+        char const* it,
+        char const* end) noexcept
+    {
+        return
+            end - it >= 3 &&
+            grammar::hexdig_chars(it[1]) &&
+            grammar::hexdig_chars(it[2]);
+    }
+
+    // encoded and decoded sizes of a part
+    struct sizes
+    {
+        std::size_t n = 0;
+        std::size_t dn = 0;
+    };
+
+    template<class CharSet>
+    static
+    sizes
+    measure(
+        core::string_view s,
+        CharSet const& cs,
+        char const* s0,
+        sanitize_report& r) noexcept
+    {
+        sizes z;
+        char const* it = s.data();
+        char const* const end = it + s.size();
+        while(it != end)
+        {
+            ++z.dn;
+            if( *it == '%' &&
+                is_escape(it, end))
+            {
+                z.n += 3;
+                it += 3;
+                continue;
+            }
+            if(cs(*it))
+            {
+                z.n += 1;
+            }
+            else
+            {
+                if(r.escaped++ == 0)
+                    r.first_escaped = static_cast<
+                        std::size_t>(it - s0);
+                z.n += 3;
+            }
+            ++it;
+        }
+        return z;
+    }
+
+    template<class CharSet>
+    static
+    char*
+    write(
+        char* dest,
+        core::string_view s,
+        CharSet const& cs) noexcept
+    {
+        char const* const hex = hexdigs[0];
+        char const* it = s.data();
+        char const* const end = it + s.size();
+        while(it != end)
+        {
+            if( *it == '%' &&
+                is_escape(it, end))
+            {
+                *dest++ = *it++;
+                *dest++ = *it++;
+                *dest++ = *it++;
+                continue;
+            }
+            if(cs(*it))
+            {
+                *dest++ = *it;
+            }
+            else
+            {
+                auto const c =
+                    static_cast<unsigned char>(*it);
+                *dest++ = '%';
+                *dest++ = hex[c >> 4];
+                *dest++ = hex[c & 0xf];
+            }
+            ++it;
+        }
+        return dest;
+    }
+
+    //--------------------------------------------
+
+    static
+    sanitize_report
+    apply(
+        core::string_view s,
+        url_base& dest,
+        sanitize_opts const& opts)
+    {
+        // s may be a view of dest
+        auto const db = dest.buffer();
+        std::less<char const*> lt;
+        if( ! lt(s.data(), db.data()) &&
+            lt(s.data(), db.data() + db.size()))
+        {
+            std::string const tmp(s);
+            return apply(tmp, dest, opts);
+        }
+
+        //----------------------------------------
+        //
+        // Diagnose
+        //
+        // The components are measured as they
+        // will be written. When nothing changes,
+        // the input was a valid URI-reference.
+        //
+        sanitize_report r;
+        parts p;
+        split(s, opts.infer_authority, p);
+        bool const add_scheme =
+            ! p.scheme.data() &&
+            p.host.data() &&
+            ! opts.default_scheme.empty();
+        r.inferred_authority = p.inferred;
+        r.added_scheme = add_scheme;
+        char const* const s0 = s.data();
+        core::string_view const scheme =
+            add_scheme ? opts.default_scheme : p.scheme;
+        bool const has_authority =
+            p.host.data() != nullptr;
+
+        sizes user;
+        sizes pass;
+        sizes host;
+        host_rule_t::value_type hv;
+        bool verbatim_host = false;
+        std::uint16_t port_number = 0;
+        if(has_authority)
+        {
+            if(p.user.data())
+                user = measure(p.user,
+                    user_chars, s0, r);
+            if(p.password.data())
+                pass = measure(p.password,
+                    password_chars, s0, r);
+            auto rv = grammar::parse(
+                p.host, host_rule);
+            if(rv)
+            {
+                hv = *rv;
+                verbatim_host = true;
+                host.n = p.host.size();
+                host.dn = p.host.size() - 2 * std::count(
+                    p.host.begin(), p.host.end(), '%');
+            }
+            else
+            {
+                hv.host_type = host_type::name;
+                host = measure(p.host,
+                    host_chars, s0, r);
+            }
+            if(p.port.data())
+            {
+                auto pv = grammar::parse(
+                    p.port, port_rule{});
+                if( pv &&
+                    pv->has_number)
+                    port_number = pv->number;
+            }
+        }
+
+        // a path which starts with "//" would
+        // look like the authority, and colons in
+        // the first segment of a relative-ref
+        // would look like the scheme
+        bool const add_dot_segment =
+            ! has_authority &&
+            p.path.starts_with("//");
+        core::string_view first_seg;
+        if( ! scheme.data() &&
+            ! has_authority &&
+            ! p.path.starts_with('/'))
+            first_seg = p.path.substr(
+                0, p.path.find('/'));
+        core::string_view const rest_path =
+            p.path.substr(first_seg.size());
+        sizes path;
+        path.n = path.dn = 2 * add_dot_segment;
+        sizes const path0 = measure(first_seg,
+            segment_chars - ':', s0, r);
+        sizes const path1 = measure(rest_path,
+            path_chars, s0, r);
+        path.n += path0.n + path1.n;
+        path.dn += path0.dn + path1.dn;
+        sizes query;
+        if(p.query.data())
+            query = measure(p.query,
+                query_chars, s0, r);
+        sizes frag;
+        if(p.fragment.data())
+            frag = measure(p.fragment,
+                fragment_chars, s0, r);
+        r.valid =
+            r.escaped == 0 &&
+            ! add_scheme &&
+            ! p.inferred &&
+            ! add_dot_segment;
+
+        //----------------------------------------
+        //
+        // Index
+        //
+        using parts_base = detail::parts_base;
+        url_impl u(parts_base::from::url);
+        if(scheme.data())
+            u.apply_scheme(scheme);
+        if(has_authority)
+        {
+            if(p.user.data())
+            {
+                u.set_size(parts_base::id_user,
+                    2 + user.n);
+                u.set_size(parts_base::id_pass,
+                    p.password.data() ?
+                        pass.n + 2 : 1);
+                u.decoded_[parts_base::id_user] =
+                    to_size_type(user.dn);
+                u.decoded_[parts_base::id_pass] =
+                    to_size_type(pass.dn);
+            }
+            else
+            {
+                u.set_size(parts_base::id_user, 2);
+            }
+            u.host_type_ = hv.host_type;
+            std::memcpy(u.ip_addr_,
+                hv.addr, sizeof(u.ip_addr_));
+            u.set_size(parts_base::id_host, host.n);
+            u.decoded_[parts_base::id_host] =
+                to_size_type(host.dn);
+            if(p.port.data())
+            {
+                u.port_number_ = port_number;
+                u.set_size(parts_base::id_port,
+                    1 + p.port.size());
+            }
+        }
+        u.set_size(parts_base::id_path, path.n);
+        u.decoded_[parts_base::id_path] =
+            to_size_type(path.dn);
+        if(p.query.data())
+        {
+            u.set_size(parts_base::id_query,
+                1 + query.n);
+            u.decoded_[parts_base::id_query] =
+                to_size_type(query.dn);
+        }
+        if(p.fragment.data())
+        {
+            u.set_size(parts_base::id_frag,
+                1 + frag.n);
+            u.decoded_[parts_base::id_frag] =
+                to_size_type(frag.dn);
+        }
+
+        //----------------------------------------
+        //
+        // Write
+        //
+        std::size_t const n =
+            u.offset(parts_base::id_end);
+        if(n == 0)
+        {
+            dest.clear();
+            return r;
+        }
+        url_base::op_t op(dest);
+        dest.reserve_impl(n, op);
+        char* const d0 = dest.s_;
+        char* it = d0;
+        if(scheme.data())
+        {
+            std::memcpy(it,
+                scheme.data(), scheme.size());
+            it += scheme.size();
+            *it++ = ':';
+        }
+        if(has_authority)
+        {
+            *it++ = '/';
+            *it++ = '/';
+            if(p.user.data())
+            {
+                it = write(it, p.user, user_chars);
+                if(p.password.data())
+                {
+                    *it++ = ':';
+                    it = write(it, p.password,
+                        password_chars);
+                }
+                *it++ = '@';
+            }
+            if(verbatim_host)
+            {
+                std::memcpy(it,
+                    p.host.data(), p.host.size());
+                it += p.host.size();
+            }
+            else
+            {
+                it = write(it, p.host, host_chars);
+            }
+            if(p.port.data())
+            {
+                *it++ = ':';
+                std::memcpy(it,
+                    p.port.data(), p.port.size());
+                it += p.port.size();
+            }
+        }
+        char* const path_first = it;
+        if(add_dot_segment)
+        {
+            *it++ = '/';
+            *it++ = '.';
+        }
+        it = write(it, first_seg,
+            segment_chars - ':');
+        it = write(it, rest_path, path_chars);
+        core::string_view const written_path(
+            path_first, it - path_first);
+        if(p.query.data())
+        {
+            *it++ = '?';
+            it = write(it, p.query, query_chars);
+        }
+        if(p.fragment.data())
+        {
+            *it++ = '#';
+            it = write(it, p.fragment,
+                fragment_chars);
+        }
+        BOOST_ASSERT(
+            static_cast<std::size_t>(
+                it - d0) == n);
+        *it = '\0';
+
+        // count the segments and params
+        // of the result, like the parser
+        std::size_t nseg = 0;
+        if(! written_path.empty())
+        {
+            nseg = std::count(
+                written_path.begin(),
+                written_path.end(), '/');
+            if(written_path.front() != '/')
+                ++nseg;
+        }
+        u.nseg_ = to_size_type(
+            path_segments(written_path, nseg));
+        if(p.query.data())
+        {
+            core::string_view const q(
+                d0 + u.offset(parts_base::id_query) + 1,
+                query.n);
+            u.nparam_ = to_size_type(1 + std::count(
+                q.begin(), q.end(), '&'));
+        }
+        u.cs_ = d0;
+        dest.impl_ = u;
+        BOOST_ASSERT(parse_uri_reference(
+            core::string_view(d0, n)).has_value());
+        return r;
+    }
+
+    static
+    void
+    check(sanitize_opts const& opts)
+    {
+        if( ! opts.default_scheme.empty() &&
+            ! grammar::parse(
+                opts.default_scheme,
+                scheme_rule{}))
+            detail::throw_invalid_argument();
+    }
+};
+
+} // detail
+
+sanitize_report
+sanitize_url(
+    core::string_view s,
+    url_base& dest,
+    sanitize_opts const& opts)
+{
+    detail::sanitizer::check(opts);
+    return detail::sanitizer::apply(
+        s, dest, opts);
+}
+
+std::size_t
+sanitize_urls(
+    core::string_view const* s,
+    std::size_t n,
+    url* dest,
+    sanitize_opts const& opts,
+    sanitize_report* reports)
+{
+    detail::sanitizer::check(opts);
+    std::size_t changed = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        sanitize_report const r =
+            detail::sanitizer::apply(
+                s[i], dest[i], opts);
+        changed += ! r.valid;
+        if(reports)
+            reports[i] = r;
+    }
+    return changed;
+}
+
+} // urls
+} // boost
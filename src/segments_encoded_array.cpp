@@ -0,0 +1,35 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/segments_encoded_array.hpp>
+
+namespace boost {
+namespace urls {
+
+segments_encoded_array::
+segments_encoded_array(
+    segments_encoded_view const& ps)
+    : ps_(ps)
+    , data_(ps.buffer().data())
+{
+    v_.reserve(ps_.size());
+    for(pct_string_view s : ps_)
+        v_.push_back({
+            static_cast<std::size_t>(
+                s.data() - data_),
+            s.size(),
+            s.decoded_size() });
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,616 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/uri_template.hpp>
+#include <boost/url/parse.hpp>
+#include <boost/url/detail/encode.hpp>
+#include <boost/url/detail/format_args.hpp>
+#include <boost/url/grammar/alnum_chars.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/recycled.hpp>
+#include <boost/url/rfc/gen_delim_chars.hpp>
+#include <boost/url/rfc/sub_delim_chars.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+constexpr grammar::lut_chars
+    u_chars = unreserved_chars;
+
+constexpr grammar::lut_chars
+    ur_chars = unreserved_chars +
+        gen_delim_chars + sub_delim_chars;
+
+struct is_ctl_or_space
+{
+    constexpr
+    bool
+    operator()(char c) const noexcept
+    {
+        return
+            static_cast<unsigned char>(c) <= 0x20 ||
+            c == 0x7f;
+    }
+};
+
+// ASCII chars which may not appear
+// in the literals of a template
+constexpr grammar::lut_chars
+    bad_literal_chars =
+        grammar::lut_chars(is_ctl_or_space{}) +
+        "\"'<>\\^`{|}";
+
+bool
+is_pct(
+    char const* it,
+    char const* end) noexcept
+{
+    return
+        end - it >= 3 &&
+        it[0] == '%' &&
+        grammar::hexdig_chars(it[1]) &&
+        grammar::hexdig_chars(it[2]);
+}
+
+// the expansion rules of an operator
+struct op_info
+{
+    core::string_view first;
+    char sep;
+    bool named;
+    core::string_view ifemp;
+    bool reserved;
+};
+
+op_info
+get_op(char op) noexcept
+{
+    switch(op)
+    {
+    default:
+    case ' ': return { "", ',', false, "", false };
+    case '+': return { "", ',', false, "", true };
+    case '#': return { "#", ',', false, "", true };
+    case '.': return { ".", '.', false, "", false };
+    case '/': return { "/", '/', false, "", false };
+    case ';': return { ";", ';', true, "", false };
+    case '?': return { "?", '&', true, "=", false };
+    case '&': return { "&", '&', true, "=", false };
+    }
+}
+
+// the first n characters of an
+// UTF-8 string
+core::string_view
+prefix(
+    core::string_view s,
+    std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    while(i < s.size())
+    {
+        auto const c =
+            static_cast<unsigned char>(s[i]);
+        // continuation bytes belong
+        // to the previous character
+        if((c & 0xc0) != 0x80)
+        {
+            if(n == 0)
+                break;
+            --n;
+        }
+        ++i;
+    }
+    return s.substr(0, i);
+}
+
+class measure_sink
+{
+    std::size_t n_ = 0;
+
+public:
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    void
+    append(core::string_view s) noexcept
+    {
+        n_ += s.size();
+    }
+
+    void
+    append(char) noexcept
+    {
+        ++n_;
+    }
+
+    void
+    encode(
+        core::string_view s,
+        bool reserved) noexcept
+    {
+        auto it = s.data();
+        auto const end = it + s.size();
+        grammar::lut_chars const& cs =
+            reserved ? ur_chars : u_chars;
+        while(it != end)
+        {
+            if( reserved &&
+                is_pct(it, end))
+            {
+                n_ += 3;
+                it += 3;
+                continue;
+            }
+            n_ += detail::measure_one(*it++, cs);
+        }
+    }
+};
+
+class write_sink
+{
+    char* dest_;
+
+public:
+    explicit
+    write_sink(char* dest) noexcept
+        : dest_(dest)
+    {
+    }
+
+    char*
+    get() const noexcept
+    {
+        return dest_;
+    }
+
+    void
+    append(core::string_view s) noexcept
+    {
+        if(s.empty())
+            return;
+        std::memcpy(dest_, s.data(), s.size());
+        dest_ += s.size();
+    }
+
+    void
+    append(char c) noexcept
+    {
+        *dest_++ = c;
+    }
+
+    void
+    encode(
+        core::string_view s,
+        bool reserved) noexcept
+    {
+        auto it = s.data();
+        auto const end = it + s.size();
+        grammar::lut_chars const& cs =
+            reserved ? ur_chars : u_chars;
+        while(it != end)
+        {
+            if( reserved &&
+                is_pct(it, end))
+            {
+                *dest_++ = *it++;
+                *dest_++ = *it++;
+                *dest_++ = *it++;
+                continue;
+            }
+            detail::encode_one(dest_, *it++, cs);
+        }
+    }
+};
+
+// state of a list or map expansion
+template<class Sink>
+struct each_state
+{
+    Sink& sink;
+    op_info const& info;
+    core::string_view name;
+    bool explode;
+    bool first;
+};
+
+template<class Sink>
+void
+expand_list(
+    void* p,
+    core::string_view s,
+    core::string_view)
+{
+    auto& st = *static_cast<
+        each_state<Sink>*>(p);
+    if(! st.first)
+        st.sink.append(
+            st.explode ? st.info.sep : ',');
+    st.first = false;
+    if( st.explode &&
+        st.info.named)
+    {
+        st.sink.append(st.name);
+        if(s.empty())
+        {
+            st.sink.append(st.info.ifemp);
+            return;
+        }
+        st.sink.append('=');
+    }
+    st.sink.encode(s, st.info.reserved);
+}
+
+template<class Sink>
+void
+expand_map(
+    void* p,
+    core::string_view k,
+    core::string_view v)
+{
+    auto& st = *static_cast<
+        each_state<Sink>*>(p);
+    if(! st.first)
+        st.sink.append(
+            st.explode ? st.info.sep : ',');
+    st.first = false;
+    st.sink.encode(k, st.info.reserved);
+    if(! st.explode)
+    {
+        st.sink.append(',');
+    }
+    else if(
+        st.info.named &&
+        v.empty())
+    {
+        st.sink.append(st.info.ifemp);
+        return;
+    }
+    else
+    {
+        st.sink.append('=');
+    }
+    st.sink.encode(v, st.info.reserved);
+}
+
+template_value const*
+find_arg(
+    std::initializer_list<
+        template_arg> const& args,
+    core::string_view name) noexcept
+{
+    for(auto const& a : args)
+        if(a.name == name)
+            return &a.value;
+    return nullptr;
+}
+
+template<class Sink>
+void
+expand_impl(
+    Sink& sink,
+    core::string_view s,
+    core::string_view lits,
+    std::vector<detail::template_part> const& parts,
+    std::vector<detail::template_var> const& vars,
+    std::initializer_list<template_arg> const& args)
+{
+    using kind = template_value::kind;
+    for(auto const& part : parts)
+    {
+        if(part.op == 0)
+        {
+            sink.append(lits.substr(
+                part.pos, part.n));
+            continue;
+        }
+        op_info const info = get_op(part.op);
+        bool first = true;
+        for(std::size_t i = 0; i < part.n; ++i)
+        {
+            auto const& var = vars[part.pos + i];
+            auto const name = s.substr(
+                var.pos, var.n);
+            auto const* v = find_arg(args, name);
+            if( ! v ||
+                v->type() == kind::undefined)
+                continue;
+            sink.append(first ?
+                info.first :
+                core::string_view(&info.sep, 1));
+            first = false;
+            if(v->type() == kind::string)
+            {
+                auto str = v->str();
+                if(var.prefix != 0)
+                    str = prefix(str, var.prefix);
+                if(info.named)
+                {
+                    sink.append(name);
+                    if(str.empty())
+                    {
+                        sink.append(info.ifemp);
+                        continue;
+                    }
+                    sink.append('=');
+                }
+                sink.encode(str, info.reserved);
+                continue;
+            }
+            if( info.named &&
+                ! var.explode)
+            {
+                sink.append(name);
+                sink.append('=');
+            }
+            each_state<Sink> st{
+                sink, info, name,
+                var.explode, true };
+            if(v->type() == kind::list)
+                v->each(&expand_list<Sink>, &st);
+            else
+                v->each(&expand_map<Sink>, &st);
+        }
+    }
+}
+
+} // (anon)
+
+uri_template::
+uri_template(
+    core::string_view s)
+    : uri_template(
+        parse_uri_template(s).value())
+{
+}
+
+std::size_t
+uri_template::
+measure(
+    std::initializer_list<
+        template_arg> args) const
+{
+    measure_sink sink;
+    expand_impl(sink, s_, lits_,
+        parts_, vars_, args);
+    return sink.size();
+}
+
+char*
+uri_template::
+write(
+    char* dest,
+    std::initializer_list<
+        template_arg> args) const
+{
+    write_sink sink(dest);
+    expand_impl(sink, s_, lits_,
+        parts_, vars_, args);
+    return sink.get();
+}
+
+url
+uri_template::
+expand(
+    std::initializer_list<
+        template_arg> args) const
+{
+    url u;
+    expand_to(u, args);
+    return u;
+}
+
+void
+uri_template::
+expand_to(
+    url_base& u,
+    std::initializer_list<
+        template_arg> args) const
+{
+    // the arguments may refer to the
+    // buffer of u, so the expansion is
+    // written to a scratch string first
+    grammar::recycled_ptr<std::string> tmp;
+    std::size_t const n = measure(args);
+    tmp->resize(n);
+    char* const end = write(&(*tmp)[0], args);
+    BOOST_ASSERT(end == tmp->data() + n);
+    (void)end;
+    u.copy(parse_uri_reference(*tmp).value());
+}
+
+system::result<uri_template>
+parse_uri_template(
+    core::string_view s)
+{
+    uri_template t;
+    t.s_.assign(s.data(), s.size());
+    char const* const begin = s.data();
+    char const* const end = begin + s.size();
+    char const* it = begin;
+    while(it != end)
+    {
+        if(*it != '{')
+        {
+            // literals
+            detail::template_part part;
+            part.pos = t.lits_.size();
+            while( it != end &&
+                *it != '{')
+            {
+                if(*it == '%')
+                {
+                    if(! is_pct(it, end))
+                    {
+                        // invalid pct-encoded
+                        BOOST_URL_RETURN_EC(
+                            grammar::error::invalid);
+                    }
+                    t.lits_.append(it, 3);
+                    it += 3;
+                    continue;
+                }
+                if(bad_literal_chars(*it))
+                {
+                    // invalid literal
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                }
+                char buf[3];
+                char* out = buf;
+                detail::encode_one(out, *it++, ur_chars);
+                t.lits_.append(buf, out - buf);
+            }
+            part.n = t.lits_.size() - part.pos;
+            t.parts_.push_back(part);
+            continue;
+        }
+
+        // expression
+        ++it;
+        detail::template_part part;
+        part.op = ' ';
+        part.pos = t.vars_.size();
+        if(it != end)
+        {
+            switch(*it)
+            {
+            case '+': case '#': case '.': case '/':
+            case ';': case '?': case '&':
+                part.op = *it++;
+                break;
+            case '=': case ',': case '!':
+            case '@': case '|':
+                // reserved operator
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            default:
+                break;
+            }
+        }
+        for(;;)
+        {
+            // varname
+            detail::template_var var;
+            var.pos = it - begin;
+            for(;;)
+            {
+                if(it == end)
+                {
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::need_more);
+                }
+                if( grammar::alnum_chars(*it) ||
+                    *it == '_')
+                {
+                    ++it;
+                }
+                else if(is_pct(it, end))
+                {
+                    it += 3;
+                }
+                else
+                {
+                    // empty varname
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                }
+                if( it != end &&
+                    *it == '.')
+                {
+                    // a dot must be
+                    // followed by a varchar
+                    ++it;
+                    continue;
+                }
+                if( it != end && (
+                    grammar::alnum_chars(*it) ||
+                    *it == '_' ||
+                    *it == '%'))
+                    continue;
+                break;
+            }
+            var.n = (it - begin) - var.pos;
+
+            // modifier
+            if( it != end &&
+                *it == ':')
+            {
+                ++it;
+                if( it == end ||
+                    *it < '1' ||
+                    *it > '9')
+                {
+                    // max-length
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                }
+                std::size_t n = 0;
+                int digits = 0;
+                while( it != end &&
+                    grammar::digit_chars(*it))
+                {
+                    if(++digits > 4)
+                    {
+                        // max-length is < 10000
+                        BOOST_URL_RETURN_EC(
+                            grammar::error::invalid);
+                    }
+                    n = n * 10 + (*it++ - '0');
+                }
+                var.prefix = n;
+            }
+            else if(
+                it != end &&
+                *it == '*')
+            {
+                ++it;
+                var.explode = true;
+            }
+            t.vars_.push_back(var);
+
+            if(it == end)
+            {
+                BOOST_URL_RETURN_EC(
+                    grammar::error::need_more);
+            }
+            if(*it == ',')
+            {
+                ++it;
+                continue;
+            }
+            if(*it == '}')
+            {
+                ++it;
+                break;
+            }
+            // expected "," or "}"
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        part.n = t.vars_.size() - part.pos;
+        t.parts_.push_back(part);
+    }
+    return t;
+}
+
+} // urls
+} // boost
+
@@ -0,0 +1,540 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_rule_set.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <mutex>
+#endif
+
+namespace boost {
+namespace urls {
+
+namespace {
+
+constexpr std::size_t nparts = 11;
+
+enum class token_kind : unsigned char
+{
+    // a character
+    literal,
+    // ?
+    any,
+    // *
+    star,
+    // **
+    globstar
+};
+
+struct token
+{
+    token_kind kind;
+    char c;
+};
+
+// Split a glob pattern into tokens, where
+// runs of asterisks become a single token.
+// Returns false if the pattern ends with an
+// escape character.
+bool
+tokenize(
+    core::string_view s,
+    bool fold,
+    std::vector<token>& v)
+{
+    v.clear();
+    std::size_t i = 0;
+    while (i < s.size())
+    {
+        char c = s[i];
+        if (c == '*')
+        {
+            std::size_t n = 0;
+            while (i < s.size() && s[i] == '*')
+            {
+                ++n;
+                ++i;
+            }
+            v.push_back({
+                n == 1 ?
+                    token_kind::star :
+                    token_kind::globstar,
+                0});
+            continue;
+        }
+        if (c == '?')
+        {
+            v.push_back({token_kind::any, 0});
+            ++i;
+            continue;
+        }
+        if (c == '\\')
+        {
+            if (++i == s.size())
+                return false;
+            c = s[i];
+        }
+        if (fold)
+            c = grammar::to_lower(c);
+        v.push_back({token_kind::literal, c});
+        ++i;
+    }
+    return true;
+}
+
+// The rules of one part of the url, as a
+// nondeterministic automaton which runs all
+// of them at once. Each rule has one state
+// per token plus the final state, and the
+// set of active states is a bit vector.
+//
+// On each character, a state is entered from
+// the state before it when its token matches
+// the character. The states of `*` tokens also
+// stay active when they match the character,
+// and are skipped without consuming anything.
+struct automaton
+{
+    using word = std::uint64_t;
+
+    // the number of words in a state set
+    std::size_t words = 0;
+
+    // characters which appear in the patterns
+    // have their own class, and every other
+    // character shares class zero
+    unsigned char cls[256] = {};
+    std::size_t nclasses = 1;
+
+    // the states entered from the previous
+    // state for each class
+    std::vector<word> step;
+
+    // the states which stay active
+    // for each class
+    std::vector<word> loop;
+
+    // the states which can be skipped
+    std::vector<word> skip;
+
+    // the initial states
+    std::vector<word> init;
+
+    // the final state of each rule,
+    // and the index of the rule
+    std::vector<std::pair<
+        std::size_t, std::size_t>> finals;
+
+    bool
+    empty() const noexcept
+    {
+        return finals.empty();
+    }
+
+    static
+    void
+    set(word* w, std::size_t bit) noexcept
+    {
+        w[bit / 64] |= word(1) << (bit % 64);
+    }
+
+    static
+    bool
+    test(word const* w, std::size_t bit) noexcept
+    {
+        return (w[bit / 64] >> (bit % 64)) & 1;
+    }
+
+    // add the states skipped from d to d,
+    // for the words in [lo, hi)
+    void
+    close(
+        word* d,
+        std::size_t lo,
+        std::size_t hi) const noexcept
+    {
+        word carry = 0;
+        for (std::size_t i = lo; i < hi; ++i)
+        {
+            word const x = d[i] & skip[i];
+            d[i] |= (x << 1) | carry;
+            carry = x >> 63;
+        }
+    }
+
+    void
+    build(
+        std::vector<std::pair<std::vector<
+            token>, std::size_t>> const& rules,
+        bool fold)
+    {
+        // assign the classes
+        bool used[256] = {};
+        used[static_cast<unsigned char>('/')] = true;
+        std::size_t nstates = 0;
+        for (auto const& r: rules)
+        {
+            nstates += r.first.size() + 1;
+            for (auto const& t: r.first)
+                if (t.kind == token_kind::literal)
+                    used[static_cast<
+                        unsigned char>(t.c)] = true;
+        }
+        for (std::size_t c = 0; c < 256; ++c)
+            if (used[c])
+                cls[c] = static_cast<
+                    unsigned char>(nclasses++);
+        if (fold)
+        {
+            for (char c = 'A'; c <= 'Z'; ++c)
+                cls[static_cast<unsigned char>(c)] =
+                    cls[static_cast<unsigned char>(
+                        grammar::to_lower(c))];
+        }
+        std::size_t const slash =
+            cls[static_cast<unsigned char>('/')];
+
+        words = (nstates + 63) / 64;
+        step.assign(nclasses * words, 0);
+        loop.assign(nclasses * words, 0);
+        skip.assign(words, 0);
+        init.assign(words, 0);
+        finals.clear();
+        std::size_t base = 0;
+        for (auto const& r: rules)
+        {
+            auto const& ts = r.first;
+            set(init.data(), base);
+            for (std::size_t j = 0; j < ts.size(); ++j)
+            {
+                std::size_t const s = base + j;
+                switch (ts[j].kind)
+                {
+                case token_kind::literal:
+                    set(&step[cls[static_cast<
+                        unsigned char>(ts[j].c)] * words],
+                        s + 1);
+                    break;
+                case token_kind::any:
+                    for (std::size_t k = 0; k < nclasses; ++k)
+                        if (k != slash)
+                            set(&step[k * words], s + 1);
+                    break;
+                case token_kind::star:
+                case token_kind::globstar:
+                    for (std::size_t k = 0; k < nclasses; ++k)
+                        if (k != slash ||
+                            ts[j].kind == token_kind::globstar)
+                            set(&loop[k * words], s);
+                    set(skip.data(), s);
+                    break;
+                }
+            }
+            base += ts.size();
+            finals.emplace_back(base, r.second);
+            ++base;
+        }
+        close(init.data(), 0, words);
+    }
+
+    // call f with the index of every
+    // rule which matches s
+    template<class F>
+    void
+    run(core::string_view s, F const& f) const
+    {
+        // most automatons fit in a few words
+        word buf[32];
+        std::vector<word> v;
+        word* d = buf;
+        if (words * 2 > 32)
+        {
+            v.resize(words * 2);
+            d = v.data();
+        }
+        word* t = d + words;
+        std::copy(init.begin(), init.end(), d);
+
+        // only the words in [lo, hi) have
+        // active states, and a step moves
+        // states at most one word up
+        std::size_t lo = 0;
+        std::size_t hi = words;
+        for (char ch: s)
+        {
+            std::size_t const k = cls[
+                static_cast<unsigned char>(ch)];
+            word const* st = &step[k * words];
+            word const* lp = &loop[k * words];
+            std::size_t const end =
+                hi < words ? hi + 1 : words;
+            word carry = 0;
+            for (std::size_t i = lo; i < end; ++i)
+            {
+                word const di = i < hi ? d[i] : 0;
+                t[i] =
+                    (((di << 1) | carry) & st[i]) |
+                    (di & lp[i]);
+                carry = di >> 63;
+            }
+            while (lo < end && !t[lo])
+                ++lo;
+            if (lo == end)
+                return;
+            hi = end;
+            while (!t[hi - 1])
+                --hi;
+            hi = hi < words ? hi + 1 : words;
+            if (hi > end)
+                t[end] = 0;
+            close(t, lo, hi);
+            while (!t[hi - 1])
+                --hi;
+            std::swap(d, t);
+        }
+        for (auto const& f0: finals)
+        {
+            std::size_t const i = f0.first / 64;
+            if (i >= lo && i < hi &&
+                test(d, f0.first))
+                f(f0.second);
+        }
+    }
+};
+
+core::string_view
+part_of(
+    url_view_base const& u,
+    std::size_t p) noexcept
+{
+    switch (static_cast<url_rule_set::part>(p))
+    {
+    default:
+    case url_rule_set::part::url:
+        return u.buffer();
+    case url_rule_set::part::scheme:
+        return u.scheme();
+    case url_rule_set::part::authority:
+        return u.encoded_authority();
+    case url_rule_set::part::userinfo:
+        return u.encoded_userinfo();
+    case url_rule_set::part::user:
+        return u.encoded_user();
+    case url_rule_set::part::password:
+        return u.encoded_password();
+    case url_rule_set::part::host:
+        return u.encoded_host();
+    case url_rule_set::part::port:
+        return u.port();
+    case url_rule_set::part::path:
+        return u.encoded_path();
+    case url_rule_set::part::query:
+        return u.encoded_query();
+    case url_rule_set::part::fragment:
+        return u.encoded_fragment();
+    }
+}
+
+bool
+is_folded(std::size_t p) noexcept
+{
+    return
+        p == static_cast<std::size_t>(
+            url_rule_set::part::scheme) ||
+        p == static_cast<std::size_t>(
+            url_rule_set::part::host);
+}
+
+} // (anon)
+
+struct url_rule_set::impl
+{
+    struct rule
+    {
+        std::size_t p;
+        std::string pattern;
+    };
+
+    std::vector<rule> rules;
+    automaton parts[nparts];
+
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    std::atomic<bool> frozen{false};
+    std::mutex m;
+#else
+    bool frozen = false;
+#endif
+
+    void
+    freeze()
+    {
+        std::vector<std::pair<std::vector<
+            token>, std::size_t>> rs;
+        for (std::size_t p = 0; p < nparts; ++p)
+        {
+            rs.clear();
+            for (std::size_t i = 0; i < rules.size(); ++i)
+            {
+                if (rules[i].p != p)
+                    continue;
+                rs.emplace_back();
+                rs.back().second = i;
+                tokenize(rules[i].pattern,
+                    is_folded(p), rs.back().first);
+            }
+            parts[p] = automaton();
+            if (!rs.empty())
+                parts[p].build(rs, is_folded(p));
+        }
+    }
+
+    void
+    freeze_once()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        if (frozen.load(std::memory_order_acquire))
+            return;
+        std::lock_guard<std::mutex> lock(m);
+        if (frozen.load(std::memory_order_relaxed))
+            return;
+        freeze();
+        frozen.store(true, std::memory_order_release);
+#else
+        if (frozen)
+            return;
+        freeze();
+        frozen = true;
+#endif
+    }
+};
+
+url_rule_set::
+url_rule_set() noexcept = default;
+
+url_rule_set::
+~url_rule_set()
+{
+    delete impl_;
+}
+
+url_rule_set::
+url_rule_set(url_rule_set&& other) noexcept
+    : impl_(other.impl_)
+{
+    other.impl_ = nullptr;
+}
+
+url_rule_set&
+url_rule_set::
+operator=(url_rule_set&& other) noexcept
+{
+    if (this != &other)
+    {
+        delete impl_;
+        impl_ = other.impl_;
+        other.impl_ = nullptr;
+    }
+    return *this;
+}
+
+std::size_t
+url_rule_set::
+size() const noexcept
+{
+    if (!impl_)
+        return 0;
+    return impl_->rules.size();
+}
+
+std::size_t
+url_rule_set::
+add(core::string_view pattern)
+{
+    return add(part::url, pattern);
+}
+
+std::size_t
+url_rule_set::
+add(
+    part p,
+    core::string_view pattern)
+{
+    std::vector<token> ts;
+    if (!tokenize(pattern, false, ts))
+        detail::throw_invalid_argument();
+    if (!impl_)
+        impl_ = new impl{};
+    impl_->rules.push_back({
+        static_cast<std::size_t>(p),
+        pattern});
+#if !defined(BOOST_URL_DISABLE_THREADS)
+    impl_->frozen.store(false, std::memory_order_relaxed);
+#else
+    impl_->frozen = false;
+#endif
+    return impl_->rules.size() - 1;
+}
+
+void
+url_rule_set::
+match(
+    url_view_base const& u,
+    std::vector<std::size_t>& v) const
+{
+    if (!impl_)
+        return;
+    impl_->freeze_once();
+    std::size_t const n0 = v.size();
+    for (std::size_t p = 0; p < nparts; ++p)
+    {
+        automaton const& a = impl_->parts[p];
+        if (a.empty())
+            continue;
+        a.run(part_of(u, p),
+            [&v](std::size_t i)
+            {
+                v.push_back(i);
+            });
+    }
+    std::sort(v.begin() + n0, v.end());
+}
+
+std::size_t
+url_rule_set::
+find_first(url_view_base const& u) const
+{
+    if (!impl_)
+        return npos;
+    impl_->freeze_once();
+    std::size_t r = npos;
+    for (std::size_t p = 0; p < nparts; ++p)
+    {
+        automaton const& a = impl_->parts[p];
+        if (a.empty())
+            continue;
+        a.run(part_of(u, p),
+            [&r](std::size_t i)
+            {
+                if (i < r)
+                    r = i;
+            });
+    }
+    return r;
+}
+
+} // urls
+} // boost
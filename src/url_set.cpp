@@ -0,0 +1,30 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/url_set.hpp>
+#include <boost/url/parse.hpp>
+
+namespace boost {
+namespace urls {
+
+auto
+url_set::
+insert(core::string_view s) ->
+    std::pair<iterator, bool>
+{
+    return insert(
+        parse_uri_reference(s).value());
+}
+
+} // urls
+} // boost
+
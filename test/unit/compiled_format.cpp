@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/compiled_format.hpp>
+
+#include <boost/url/static_url.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct compiled_format_test
+{
+    // a compiled format gives the same
+    // url as formatting the string
+    template <class... Args>
+    static
+    void
+    check(
+        core::string_view fmt,
+        Args const&... args)
+    {
+        url const expect = urls::format(fmt, args...);
+        compiled_format const cf(fmt);
+        BOOST_TEST_EQ(cf.str(), fmt);
+
+        url u = cf.format(args...);
+        BOOST_TEST_EQ(u.buffer(), expect.buffer());
+        BOOST_TEST_EQ(u.encoded_host(), expect.encoded_host());
+        BOOST_TEST_EQ(u.host_type(), expect.host_type());
+        BOOST_TEST_EQ(u.port_number(), expect.port_number());
+        BOOST_TEST_EQ(u.encoded_path(), expect.encoded_path());
+        BOOST_TEST_EQ(u.segments().size(), expect.segments().size());
+        BOOST_TEST_EQ(u.params().size(), expect.params().size());
+        BOOST_TEST_EQ(u.path().size(), expect.path().size());
+        BOOST_TEST_EQ(u.query().size(), expect.query().size());
+
+        // reused destination
+        static_url<256> su;
+        cf.format_to(su, args...);
+        BOOST_TEST_EQ(su.buffer(), expect.buffer());
+        cf.format_to(su, args...);
+        BOOST_TEST_EQ(su.buffer(), expect.buffer());
+    }
+
+    void
+    testFormat()
+    {
+        check("");
+        check("/");
+        check("a");
+        check("http:");
+        check("{}:", "http");
+        check("{}://", "http");
+        check("{}:///", "http");
+        check("{}://{}", "http", "a.b");
+        check("{}://[{}]", "http", "fe80::1ff:fe23:4567:890a");
+        check("{}://[{}]:{}/x", "http", "::1", 8080);
+        check("{}:?q", "http");
+        check("{}:path:to:joe", "mailto");
+        check("{}:{}/a/{}/b", "http", 'a', 'b');
+        check("{}://{}:{}@www.a.org", "http", "u", "p");
+        check("{}://{}:{}@{}:{}", "http", 'u', 'p', "a.b", 80);
+        check("{}://{}:{}@{}:", "http", 'u', 'p', "a.b");
+        check("{}://{}:{}@{}:{}/{}/{}/{}?{}",
+            "http", 'u', 'p', "a.b", 80,
+            'a', 'b', 'c', "k=v");
+        check("/{}/b/{}/d?{}", 'a', 'c', "k=v&x=y");
+        check("a?{}#{}", 'q', 'f');
+        check("{}://{}?{}#{}", "http", "a.b", 'q');
+        check("//{}", ':');
+        check("{}", "a:b");
+        check("{}", "::joe:/b:");
+        check("{}", "//joe");
+        check("{}:{}", "http", "//joe");
+        check("http{}://{}.{}.com:{}/{}/file.txt?k={}#frag-{}",
+            "s", "www", "example", 443, "path to", "v a", "f#");
+        check("/{}%20/%41x", "a b");
+        check("/{}/{}/{}", 'a', 'b');
+        check("user/{}", static_cast<long long int>(-1));
+        check("user/{}", static_cast<unsigned int>(-1));
+    }
+
+    void
+    testSpecs()
+    {
+        check("{:}", 'a');
+        check("{:^3s}", 'a');
+        check("{:.^5s}", 'a');
+        check("{:.>{}s}", 'a', 5);
+        check("{:.>{1}s}", 'a', 5);
+        check("{0:.>{2}s}/{1}", 'a', 'b', 5);
+        check("{:+d}", 99);
+        check("{:^6d}", 99);
+        check("{:>+06d}", 99);
+        check("{:.>{}d}/{}", 99, 6, 'x');
+        check("{:{}}/{}", 99, 6, 'x');
+        check("{0:.>{2}d}/{1}", 99, 'b', 6);
+
+        // named arguments
+        {
+            compiled_format const cf("{:.>{b}s}");
+            BOOST_TEST_EQ(
+                cf.format('a', arg("b", 5)).buffer(),
+                urls::format("{:.>{b}s}", 'a', arg("b", 5)).buffer());
+        }
+        {
+            compiled_format const cf("/{a}/{b}/{a}?{c}");
+            url u = cf.format(
+                arg("a", 1), arg("b", "two"), arg("c", "x=y"));
+            BOOST_TEST_EQ(u.buffer(), "/1/two/1?x=y");
+            BOOST_TEST_EQ(u.segments().size(), 3u);
+            BOOST_TEST_EQ(u.params().size(), 1u);
+        }
+    }
+
+    void
+    testApi()
+    {
+        compiled_format const cf(
+            "https://{}/users/{id}/repos?page={page}");
+        {
+            url u = cf.format(
+                "api.example.com",
+                arg("id", 42),
+                arg("page", 3));
+            BOOST_TEST_EQ(u.buffer(),
+                "https://api.example.com/users/42/repos?page=3");
+        }
+        {
+            url u = cf.format({
+                "api.example.com",
+                {"id", "a b"},
+                {"page", 1}});
+            BOOST_TEST_EQ(u.buffer(),
+                "https://api.example.com/users/a%20b/repos?page=1");
+        }
+        {
+            url u;
+            u.reserve(128);
+            char const* p = u.data();
+            for (int i = 0; i < 100; ++i)
+            {
+                cf.format_to(u, {
+                    "h",
+                    {"id", i},
+                    {"page", 100 - i}});
+            }
+            BOOST_TEST_EQ(u.buffer(),
+                "https://h/users/99/repos?page=1");
+            BOOST_TEST(u.data() == p);
+        }
+
+        // invalid format string
+        BOOST_TEST_THROWS(
+            compiled_format("{:"),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            compiled_format("http:%"),
+            system::system_error);
+
+        // invalid result
+        {
+            compiled_format const f(
+                "{}://www.a.com");
+            BOOST_TEST_THROWS(
+                f.format("1nvalid scheme"),
+                system::system_error);
+        }
+    }
+
+    void
+    run()
+    {
+#if !BOOST_WORKAROUND( BOOST_GCC_VERSION, < 60000 )
+        testFormat();
+        testSpecs();
+        testApi();
+#endif
+    }
+};
+
+TEST_SUITE(
+    compiled_format_test,
+    "boost.url.compiled_format");
+
+} // urls
+} // boost
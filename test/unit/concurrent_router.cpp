@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/concurrent_router.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+#include <type_traits>
+#include <vector>
+#if !defined(BOOST_URL_DISABLE_THREADS)
+# include <atomic>
+# include <thread>
+#endif
+
+namespace boost {
+namespace urls {
+
+static_assert(!std::is_copy_constructible<concurrent_router<int>>::value,
+    "concurrent_router should not be copyable");
+static_assert(!std::is_copy_constructible<concurrent_router<int>::snapshot>::value,
+    "snapshot should be move-only");
+static_assert(std::is_move_constructible<concurrent_router<int>::snapshot>::value,
+    "snapshot should support moves");
+
+struct concurrent_router_test
+{
+    // routes where every resource is v
+    static
+    router<int>
+    make(int v)
+    {
+        router<int> r;
+        r.insert("/a", v);
+        r.insert("/b/{id}", v);
+        r.insert("/c/{path*}", v);
+        return r;
+    }
+
+    static
+    int const*
+    find(
+        concurrent_router<int>::snapshot const& s,
+        core::string_view path,
+        matches& m)
+    {
+        return s->find(path, m);
+    }
+
+    void
+    testLoad()
+    {
+        // empty
+        {
+            concurrent_router<int> cr;
+            auto s = cr.load();
+            matches m;
+            BOOST_TEST_EQ(s->size(), 0u);
+            BOOST_TEST(!find(s, "/a", m));
+        }
+
+        // initial routes
+        {
+            concurrent_router<int> cr(make(1));
+            auto s = cr.load();
+            matches m;
+            BOOST_TEST_EQ(s->size(), 3u);
+            int const* v = find(s, "/b/42", m);
+            if (BOOST_TEST(v))
+                BOOST_TEST_EQ(*v, 1);
+            BOOST_TEST_EQ(m["id"], "42");
+            BOOST_TEST(!find(s, "/d", m));
+
+            // move
+            auto s2 = std::move(s);
+            v = find(s2, "/c/x/y", m);
+            if (BOOST_TEST(v))
+                BOOST_TEST_EQ(*v, 1);
+            BOOST_TEST_EQ(m["path"], "x/y");
+        }
+    }
+
+    void
+    testStore()
+    {
+        concurrent_router<int> cr(make(1));
+        matches m;
+        {
+            auto s = cr.load();
+            BOOST_TEST_EQ(*find(s, "/a", m), 1);
+        }
+        cr.store(make(2));
+        {
+            auto s = cr.load();
+            BOOST_TEST_EQ(*find(s, "/a", m), 2);
+        }
+
+        // routes can be removed
+        {
+            router<int> r;
+            r.insert("/d", 3);
+            cr.store(std::move(r));
+            auto s = cr.load();
+            BOOST_TEST_EQ(s->size(), 1u);
+            BOOST_TEST(!find(s, "/a", m));
+            BOOST_TEST_EQ(*find(s, "/d", m), 3);
+        }
+
+        // invalid routes never reach
+        // the concurrent router
+        {
+            router<int> r;
+            BOOST_TEST_THROWS(
+                r.insert("/a/../..", 4),
+                system::system_error);
+            r.insert("/e", 4);
+            cr.store(std::move(r));
+            auto s = cr.load();
+            BOOST_TEST_EQ(*find(s, "/e", m), 4);
+        }
+    }
+
+    void
+    testThreads()
+    {
+#if !defined(BOOST_URL_DISABLE_THREADS)
+        // readers must always see one
+        // complete version of the routes,
+        // and versions never go back
+        concurrent_router<int> cr(make(0));
+        std::atomic<bool> done{false};
+        std::atomic<std::size_t> errors{0};
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 4; ++i)
+        {
+            readers.emplace_back([&]
+            {
+                int last = 0;
+                matches m;
+                while (!done.load())
+                {
+                    auto s = cr.load();
+                    int const* a = find(s, "/a", m);
+                    int const* b = find(s, "/b/1", m);
+                    int const* c = find(s, "/c/x/y", m);
+                    if (!a || !b || !c ||
+                        *a != *b || *a != *c ||
+                        *a < last)
+                    {
+                        ++errors;
+                        continue;
+                    }
+                    last = *a;
+                }
+            });
+        }
+        for (int v = 1; v <= 200; ++v)
+            cr.store(make(v));
+        done.store(true);
+        for (auto& t: readers)
+            t.join();
+        BOOST_TEST_EQ(errors.load(), 0u);
+        auto s = cr.load();
+        matches m;
+        BOOST_TEST_EQ(*find(s, "/a", m), 200);
+#endif
+    }
+
+    void
+    run()
+    {
+        testLoad();
+        testStore();
+        testThreads();
+    }
+};
+
+TEST_SUITE(concurrent_router_test, "boost.url.concurrent_router");
+
+} // urls
+} // boost
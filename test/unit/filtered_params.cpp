@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/filtered_params.hpp>
+
+#include <boost/url/params_encoded_view.hpp>
+#include <boost/url/params_view.hpp>
+#include <boost/url/url_view.hpp>
+
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct filtered_params_test
+{
+    template<class Range>
+    static
+    std::vector<std::string>
+    strings(Range const& r)
+    {
+        std::vector<std::string> v;
+        for(auto const& s : r)
+            v.emplace_back(s.begin(), s.end());
+        return v;
+    }
+
+    void
+    testEncoded()
+    {
+        url_view u(
+            "?tr=udp%3A%2F%2Fa&dn=x+y&TR=udp%3A%2F%2Fb"
+            "&%74r=udp%3A%2F%2Fc&tr&ws=http%3A%2F%2Fd");
+        params_encoded_view ps = u.encoded_params();
+
+        // filter
+        {
+            auto r = filter_params(ps, has_key("tr"));
+            BOOST_STATIC_ASSERT(std::is_same<
+                decltype(r)::value_type,
+                param_pct_view>::value);
+            std::vector<std::string> v;
+            for(param_pct_view p : r)
+                v.emplace_back(p.value);
+            BOOST_TEST((v == std::vector<std::string>{
+                "udp%3A%2F%2Fa", "udp%3A%2F%2Fc", ""}));
+            BOOST_TEST(! r.empty());
+            BOOST_TEST_EQ(std::distance(
+                r.begin(), r.end()), 3);
+        }
+
+        // ignore case
+        {
+            auto r = filter_params(ps,
+                has_key("TR", ignore_case), param_value);
+            BOOST_STATIC_ASSERT(std::is_same<
+                decltype(r)::value_type,
+                decode_view>::value);
+            BOOST_TEST((strings(r) == std::vector<std::string>{
+                "udp://a", "udp://b", "udp://c", ""}));
+        }
+
+        // keys
+        {
+            auto r = filter_params(ps,
+                has_key("tr"), param_key);
+            BOOST_TEST((strings(r) == std::vector<std::string>{
+                "tr", "tr", "tr"}));
+        }
+
+        // plus is not a space in
+        // encoded params
+        {
+            auto r = filter_params(ps,
+                has_key("dn"), param_value);
+            BOOST_TEST((strings(r) == std::vector<std::string>{
+                "x+y"}));
+        }
+
+        // no match
+        {
+            auto r = filter_params(ps, has_key("xt"));
+            BOOST_TEST(r.empty());
+            BOOST_TEST(r.begin() == r.end());
+        }
+
+        // any callable
+        {
+            auto r = filter_params(ps,
+                [](param_pct_view const& p)
+                {
+                    return p.has_value &&
+                        (*p.value).starts_with("http");
+                },
+                [](param_pct_view const& p)
+                {
+                    return p.key;
+                });
+            BOOST_TEST((strings(r) == std::vector<std::string>{
+                "ws"}));
+        }
+    }
+
+    void
+    testDecoded()
+    {
+        url_view u("?a=1+2&b=3&A=%34&c");
+        auto r = filter_params(
+            u.params().decoded(),
+            has_key("a", ignore_case),
+            param_value);
+        BOOST_TEST((strings(r) == std::vector<std::string>{
+            "1 2", "4"}));
+
+        auto r2 = filter_params(
+            u.params().decoded(),
+            has_key("c"));
+        auto it = r2.begin();
+        BOOST_TEST(it != r2.end());
+        BOOST_TEST(! (*it).has_value);
+        BOOST_TEST(++it == r2.end());
+    }
+
+    void
+    testParams()
+    {
+        // the owning params can be
+        // filtered, but not projected
+        // to views
+        url_view u("?a=1&b=2&a=3");
+        auto r = filter_params(u.params(), has_key("a"));
+        std::vector<std::string> v;
+        for(param const& p : r)
+            v.push_back(p.value);
+        BOOST_TEST((v == std::vector<std::string>{
+            "1", "3"}));
+    }
+
+    void
+    testIterator()
+    {
+        url_view u("?a=1&b=2&a=3&a=4");
+        auto r = filter_params(u.encoded_params(),
+            has_key("a"), param_value);
+        auto it = r.begin();
+        BOOST_TEST_EQ(*it, "1");
+        auto it2 = it++;
+        BOOST_TEST_EQ(*it2, "1");
+        BOOST_TEST_EQ(*it, "3");
+        BOOST_TEST(it.base() == std::next(
+            u.encoded_params().begin(), 2));
+        ++it;
+        BOOST_TEST_EQ(*it, "4");
+        BOOST_TEST(++it == r.end());
+        BOOST_TEST(decltype(r)::iterator() ==
+            decltype(r)::iterator());
+
+        // algorithms
+        BOOST_TEST_EQ(std::count(
+            r.begin(), r.end(), "3"), 1);
+        BOOST_TEST(std::find(
+            r.begin(), r.end(), "5") == r.end());
+        BOOST_TEST_EQ(r.base().size(), 4u);
+    }
+
+    void
+    run()
+    {
+        testEncoded();
+        testDecoded();
+        testParams();
+        testIterator();
+    }
+};
+
+TEST_SUITE(filtered_params_test, "boost.url.filtered_params");
+
+} // urls
+} // boost
@@ -10,12 +10,15 @@
 // Test that header file is self-contained.
 #include <boost/url/format.hpp>
 
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv6_address.hpp>
 #include <boost/url/parse.hpp>
 #include <boost/url/static_url.hpp>
 
 #include "test_suite.hpp"
 
 #include <climits>
+#include <limits>
 
 #ifdef BOOST_TEST_CSTR_EQ
 #undef BOOST_TEST_CSTR_EQ
@@ -967,6 +970,363 @@ struct format_test
         }
     }
 
+    void
+    testIntegers()
+    {
+        auto check = [](
+            core::string_view expect,
+            url const& u)
+        {
+            BOOST_TEST_EQ(u.buffer(), expect);
+        };
+
+        check("/0", urls::format("/{}", 0));
+        check("/9", urls::format("/{}", 9));
+        check("/10", urls::format("/{}", 10));
+        check("/99", urls::format("/{}", 99));
+        check("/100", urls::format("/{}", 100));
+        check("/-1", urls::format("/{}", -1));
+        check("/-100", urls::format("/{}", -100));
+        check("/1234567890", urls::format("/{}", 1234567890));
+        check("/18446744073709551615",
+            urls::format("/{}", ULLONG_MAX));
+        check("/9223372036854775807",
+            urls::format("/{}", LLONG_MAX));
+        check("/-9223372036854775808",
+            urls::format("/{}", LLONG_MIN));
+        check("/+5", urls::format("/{:+}", 5));
+        check("/%205", urls::format("/{: }", 5));
+        check("/+5", urls::format("/{:+}", 5u));
+        check("/-0005", urls::format("/{:>05}", -5));
+        check("/..-5", urls::format("/{:.>4}", -5));
+        check("/-5..", urls::format("/{:.<4}", -5));
+        check("/.-5.", urls::format("/{:.^4}", -5));
+        check("/12345", urls::format("/{:.>3}", 12345));
+
+        // digits are encoded where reserved
+        check("?k=%201", urls::format("?k={: >2}", 1));
+    }
+
+    void
+    testFloats()
+    {
+        auto check = [](
+            core::string_view expect,
+            url const& u)
+        {
+            BOOST_TEST_EQ(u.buffer(), expect);
+        };
+
+        // shortest round trip
+        check("/0", urls::format("/{}", 0.0));
+        check("/-0", urls::format("/{}", -0.0));
+        check("/0.1", urls::format("/{}", 0.1));
+        check("/0.3", urls::format("/{}", 0.3f));
+        check("/100", urls::format("/{}", 100.0));
+        check("/1.5", urls::format("/{}", 1.5));
+        check("/-2.25", urls::format("/{}", -2.25));
+        check("/1e+300", urls::format("/{}", 1e300));
+        check("/1e-07", urls::format("/{}", 1e-7));
+        check("/1e-04", urls::format("/{}", 1e-4));
+        check("/0.001", urls::format("/{}", 1e-3));
+        check("/123456789", urls::format("/{}", 123456789.0));
+        check("/0.30000000000000004",
+            urls::format("/{}", 0.1 + 0.2));
+        check("/1.7976931348623157e+308",
+            urls::format("/{}",
+                (std::numeric_limits<double>::max)()));
+        check("/2.5", urls::format("/{}",
+            static_cast<long double>(2.5)));
+
+        // not finite
+        check("/inf", urls::format("/{}",
+            std::numeric_limits<double>::infinity()));
+        check("/-inf", urls::format("/{}",
+            -std::numeric_limits<double>::infinity()));
+        check("/nan", urls::format("/{}",
+            std::numeric_limits<double>::quiet_NaN()));
+        check("/INF", urls::format("/{:F}",
+            std::numeric_limits<double>::infinity()));
+
+        // precision and type
+        check("/3.14", urls::format("/{:.2f}", 3.14159));
+        check("/3", urls::format("/{:.0f}", 3.14159));
+        check("/3.141590", urls::format("/{:f}", 3.14159));
+        check("/3.14e+00", urls::format("/{:.2e}", 3.14159));
+        check("/3.14E+00", urls::format("/{:.2E}", 3.14159));
+        check("/3.1", urls::format("/{:.2}", 3.14159));
+        check("/1e+06", urls::format("/{:g}", 1e6));
+        check("/1E+06", urls::format("/{:G}", 1e6));
+
+        // sign and padding
+        check("/+1.5", urls::format("/{:+}", 1.5));
+        check("/-1.5", urls::format("/{:+}", -1.5));
+        check("/..1.5", urls::format("/{:.>5}", 1.5));
+        check("/1.5..", urls::format("/{:.<5}", 1.5));
+        check("/-001.5", urls::format("/{:>06}", -1.5));
+        check("/..-inf", urls::format("/{:.>06}",
+            -std::numeric_limits<double>::infinity()));
+        check("/.1.50.", urls::format("/{:.^6.2f}", 1.5));
+        check("/....1.5", urls::format(
+            "/{:.>{}}", 1.5, 7));
+
+        // largest output
+        {
+            url u = urls::format("/{:.99f}",
+                (std::numeric_limits<double>::max)());
+            BOOST_TEST_EQ(u.encoded_path().size(),
+                1u + 309 + 1 + 99);
+        }
+
+        // query and fragment
+        check("?x=0.5&y=1e+100#2.5", urls::format(
+            "?x={}&y={}#{}", 0.5, 1e100, 2.5f));
+
+        // invalid specs
+        BOOST_TEST_THROWS(
+            urls::format("/{:.}", 1.5),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            urls::format("/{:.100f}", 1.5),
+            system::system_error);
+        BOOST_TEST_THROWS(
+            urls::format("/{:d}", 1.5),
+            system::system_error);
+    }
+
+    void
+    testAddresses()
+    {
+        ipv4_address const a4(0xC0A80001);
+        ipv6_address const a6(a4);
+        {
+            url u = urls::format("http://{}/", a4);
+            BOOST_TEST_EQ(u.buffer(), "http://192.168.0.1/");
+            BOOST_TEST(u.host_type() == host_type::ipv4);
+            BOOST_TEST(u.host_ipv4_address() == a4);
+        }
+        {
+            url u = urls::format("http://[{}]:{}/", a6, 80);
+            BOOST_TEST_EQ(u.buffer(),
+                "http://[::ffff:192.168.0.1]:80/");
+            BOOST_TEST(u.host_type() == host_type::ipv6);
+            BOOST_TEST(u.host_ipv6_address() == a6);
+        }
+        {
+            ipv6_address const lo = ipv6_address::loopback();
+            url u = urls::format("http://[{}]/", lo);
+            BOOST_TEST_EQ(u.buffer(), "http://[::1]/");
+        }
+        {
+            // the colons are encoded in a
+            // first segment without a scheme
+            url u = urls::format("{}", a6);
+            BOOST_TEST_EQ(u.buffer(),
+                "%3A%3Affff%3A192.168.0.1");
+        }
+        {
+            url u = urls::format(
+                "/{:.>12}/{}",
+                ipv4_address::loopback(),
+                arg("a", a4));
+            BOOST_TEST_EQ(u.buffer(),
+                "/...127.0.0.1/192.168.0.1");
+        }
+        {
+            url u = urls::format("?{}", ipv4_address::any());
+            BOOST_TEST_EQ(u.buffer(), "?0.0.0.0");
+        }
+    }
+
+    // the constexpr parser accepts the same
+    // format strings as urls::format, and
+    // formatting with its boundaries gives
+    // the same url
+    static
+    void
+    checkStatic(core::string_view fmt)
+    {
+        detail::static_pattern_parser pr(
+            fmt.data(), fmt.size());
+        char const* err = pr.parse();
+        bool thrown = false;
+        url expect;
+        try
+        {
+            expect = urls::format(
+                fmt, 'a', 'b', 'c', arg("x", "y"));
+        }
+        catch (system::system_error const&)
+        {
+            thrown = true;
+        }
+        if (err)
+        {
+            BOOST_TEST(thrown);
+            return;
+        }
+        BOOST_TEST_LE(pr.p.nargs, 4u);
+        url u;
+        try
+        {
+            detail::vformat_to(
+                u, fmt, pr.p, detail::make_format_args(
+                    'a', 'b', 'c', arg("x", "y")));
+        }
+        catch (system::system_error const&)
+        {
+            BOOST_TEST(thrown);
+            return;
+        }
+        BOOST_TEST(! thrown);
+        BOOST_TEST_EQ(u.buffer(), expect.buffer());
+        BOOST_TEST_EQ(u.encoded_host(), expect.encoded_host());
+        BOOST_TEST_EQ(u.encoded_path(), expect.encoded_path());
+        BOOST_TEST_EQ(u.segments().size(), expect.segments().size());
+        BOOST_TEST_EQ(u.params().size(), expect.params().size());
+    }
+
+    static
+    void
+    checkInvalid(core::string_view fmt)
+    {
+        detail::static_pattern_parser pr(
+            fmt.data(), fmt.size());
+        BOOST_TEST(pr.parse() != nullptr);
+    }
+
+    static
+    void
+    checkArgs(
+        core::string_view fmt,
+        std::size_t nargs,
+        bool named)
+    {
+        detail::static_pattern_parser pr(
+            fmt.data(), fmt.size());
+        BOOST_TEST(pr.parse() == nullptr);
+        BOOST_TEST_EQ(pr.p.nargs, nargs);
+        BOOST_TEST_EQ(pr.p.named, named);
+    }
+
+    void
+    testStaticPattern()
+    {
+        // valid
+        checkStatic("");
+        checkStatic("/");
+        checkStatic("a");
+        checkStatic("{}");
+        checkStatic("http:");
+        checkStatic("{}:");
+        checkStatic("{}://");
+        checkStatic("{}:///");
+        checkStatic("{}://{}");
+        checkStatic("{}://[{}]");
+        checkStatic("http://[::1]:8080/{}");
+        checkStatic("http://[{}:{}::1]/");
+        checkStatic("{}://[{}]:{}/x");
+        checkStatic("{}:?q");
+        checkStatic("{}:path:to:joe");
+        checkStatic("{}:{}/a/{}/b");
+        checkStatic("http://{}:{}@www.a.org");
+        checkStatic("http://{}@{}:{}");
+        checkStatic("http://h:");
+        checkStatic("http://h:80{}");
+        checkStatic("http{}://{}.com:80/{x}?k={}#f-{}");
+        checkStatic("//{}");
+        checkStatic("//{}?q");
+        checkStatic("//h#f");
+        checkStatic("?{}#{}");
+        checkStatic("a?{}#{}");
+        checkStatic("/{}%20/%41x");
+        checkStatic("{x}/{}");
+        checkStatic("{:}");
+        checkStatic("{:^3s}");
+        checkStatic("{:.>{1}s}");
+        checkStatic("{0:.>{2}s}/{1}");
+        checkStatic("{:{}}/{}");
+        checkStatic("{}{}");
+        checkStatic("{}:{}");
+        checkStatic("a:b");
+        checkStatic("x");
+        checkStatic("1");
+
+        // invalid
+        checkStatic("{");
+        checkStatic("}");
+        checkStatic("{:");
+        checkStatic("{}}");
+        checkStatic("http:%");
+        checkStatic("{01}");
+        checkStatic("{a-b}");
+        checkStatic(":");
+        checkStatic("/{:{x}");
+        checkStatic("/{:{x}s");
+        checkStatic("a{b");
+        checkStatic("http://[a");
+        checkStatic("http://h:x");
+        checkStatic("http://h/ /");
+        checkStatic("http://h?#}");
+        checkStatic("/{x:<{}");
+        checkInvalid("%");
+        checkInvalid("/%2");
+        checkInvalid("/%zz");
+        checkInvalid("//a%2");
+        checkInvalid("{99999999}");
+
+        // arguments
+        checkArgs("", 0, false);
+        checkArgs("{}/{}", 2, false);
+        checkArgs("{1}", 2, false);
+        checkArgs("{x}", 0, true);
+        checkArgs("{x}/{}", 1, true);
+        checkArgs("{:.>{}s}", 2, false);
+        checkArgs("{:.>{y}s}", 1, true);
+        checkArgs("{:{}}", 1, false);
+        checkArgs("{0:.>{2}s}/{1}", 3, false);
+        checkArgs("{}://{}", 2, false);
+        checkArgs("{}:{}", 2, false);
+
+#ifdef BOOST_URL_HAS_FORMAT_STRING
+        {
+            url u = urls::format<"{}://{}:{}/rfc/{}">(
+                "https", "www.ietf.org", 80, "rfc2396.txt");
+            BOOST_TEST_EQ(u.buffer(),
+                "https://www.ietf.org:80/rfc/rfc2396.txt");
+        }
+        {
+            url u = urls::format<"https://example.com/~{}">(
+                "John Doe");
+            BOOST_TEST_EQ(u.buffer(),
+                "https://example.com/~John%20Doe");
+        }
+        {
+            url u = urls::format<"/{a}/{b}/{a}?{}">(
+                "k=v", arg("a", 1), arg("b", "two"));
+            BOOST_TEST_EQ(u.buffer(), "/1/two/1?k=v");
+        }
+        {
+            static_url<64> u;
+            urls::format_to<"{}://[{}]:{}/{:.^5s}">(
+                u, "http", "::1", 8080, 'x');
+            BOOST_TEST_EQ(u.buffer(), "http://[::1]:8080/..x..");
+            BOOST_TEST(u.host_type() == host_type::ipv6);
+        }
+        {
+            constexpr format_string fs("{}://{}/{x}");
+            static_assert(fs.pattern.nargs == 2, "");
+            static_assert(fs.pattern.named, "");
+            static_assert(fs.pattern.has_authority, "");
+            BOOST_TEST_EQ(fs.view(), "{}://{}/{x}");
+        }
+        // an invalid result still throws
+        BOOST_TEST_THROWS(
+            urls::format<"{}://www.a.com">("1nvalid scheme"),
+            system::system_error);
+#endif
+    }
+
     void
     run()
     {
@@ -979,6 +1339,10 @@ struct format_test
         testCenterAlignPad();
         testColonInFirstSegment();
         testHighByteEncode();
+        testIntegers();
+        testFloats();
+        testAddresses();
+        testStaticPattern();
 #endif
     }
 };
@@ -0,0 +1,325 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/ip_matcher.hpp>
+
+#include <boost/url/url_view.hpp>
+
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct ip_matcher_test
+{
+    void
+    testMembers()
+    {
+        // ip_matcher()
+        {
+            ip_matcher m;
+            BOOST_TEST(m.empty());
+            BOOST_TEST_EQ(m.size(), 0u);
+            BOOST_TEST(! m.matches(ipv4_address()));
+            BOOST_TEST(! m.matches(ipv6_address()));
+            BOOST_TEST(! m.matches(url_view("http://127.0.0.1/")));
+        }
+
+        // insert, size, clear
+        {
+            ip_matcher m;
+            m.insert("10.0.0.0/8");
+            m.insert("10.0.0.0/8", false);
+            m.insert(ipv4_network("10.0.0.0/16"));
+            m.insert("::1");
+            m.insert("127.0.0.1");
+            m.insert(ipv6_network("fe80::/10"));
+            BOOST_TEST_EQ(m.size(), 5u);
+            BOOST_TEST(! m.matches(ipv4_address("10.1.0.0")));
+            BOOST_TEST(m.matches(ipv4_address("10.0.1.0")));
+            BOOST_TEST(m.matches(ipv4_address("127.0.0.1")));
+            BOOST_TEST(! m.matches(ipv4_address("127.0.0.2")));
+            BOOST_TEST(m.matches(ipv6_address("::1")));
+            BOOST_TEST(m.matches(ipv6_address("febf::1")));
+            BOOST_TEST(! m.matches(ipv6_address("fec0::1")));
+            m.clear();
+            BOOST_TEST(m.empty());
+            BOOST_TEST(! m.matches(ipv4_address("127.0.0.1")));
+            m.insert("0.0.0.0/0");
+            BOOST_TEST(m.matches(ipv4_address("127.0.0.1")));
+            BOOST_TEST(! m.matches(ipv6_address("::1")));
+        }
+
+        // ip_matcher(ip_matcher&&)
+        // operator=(ip_matcher&&)
+        {
+            ip_matcher m0;
+            m0.insert("10.0.0.0/8");
+            BOOST_TEST(m0.matches(ipv4_address("10.0.0.1")));
+            ip_matcher m1(std::move(m0));
+            BOOST_TEST(m0.empty());
+            BOOST_TEST(! m0.matches(ipv4_address("10.0.0.1")));
+            BOOST_TEST(m1.matches(ipv4_address("10.0.0.1")));
+            m0.insert("::1");
+            m0 = std::move(m1);
+            BOOST_TEST_EQ(m0.size(), 1u);
+            BOOST_TEST(m0.matches(ipv4_address("10.0.0.1")));
+            BOOST_TEST(! m0.matches(ipv6_address("::1")));
+            // rules inserted after a match
+            m0.insert("10.1.0.0/16", false);
+            BOOST_TEST(! m0.matches(ipv4_address("10.1.0.1")));
+            BOOST_TEST(m0.matches(ipv4_address("10.2.0.1")));
+        }
+
+        // invalid rules
+        {
+            ip_matcher m;
+            BOOST_TEST_THROWS(
+                m.insert("10.0.0.1/8"),
+                system::system_error);
+            BOOST_TEST_THROWS(
+                m.insert("10.0.0.0/33"),
+                system::system_error);
+            BOOST_TEST_THROWS(
+                m.insert("example.com"),
+                system::system_error);
+            BOOST_TEST_THROWS(
+                m.insert("::1/"),
+                system::system_error);
+            BOOST_TEST(m.empty());
+        }
+    }
+
+    void
+    testMatch()
+    {
+        ip_matcher deny;
+        deny.insert("10.0.0.0/8");
+        deny.insert("10.1.2.0/24", false);
+        deny.insert("127.0.0.0/8");
+        deny.insert("169.254.0.0/16");
+        deny.insert("172.16.0.0/12");
+        deny.insert("192.168.0.0/16");
+        deny.insert("::1");
+        deny.insert("fc00::/7");
+        deny.insert("fe80::/10");
+
+        auto const check = [&deny](
+            core::string_view s,
+            bool expected)
+        {
+            BOOST_TEST_EQ(
+                deny.matches(url_view(s)),
+                expected);
+        };
+
+        check("http://10.9.8.7/", true);
+        check("http://10.1.2.3/", false);
+        check("http://10.1.3.3/", true);
+        check("http://127.0.0.1:8080/", true);
+        check("http://169.254.169.254/latest/meta-data/", true);
+        check("http://172.31.255.255/", true);
+        check("http://172.32.0.0/", false);
+        check("http://93.184.216.34/", false);
+        check("http://[::1]/", true);
+        check("http://[::2]/", false);
+        check("http://[fd12:3456::1]/", true);
+        check("http://[fe80::1%25eth0]/", true);
+        check("http://[2606:2800:220:1::]/", false);
+        check("http://[v1.x]/", false);
+        check("http://localhost/", false);
+        check("http://0x7f.1/", false);
+        check("/path", false);
+
+        // IPv4-mapped addresses
+        check("http://[::ffff:127.0.0.1]/", true);
+        check("http://[::ffff:10.1.2.3]/", false);
+        check("http://[::ffff:8.8.8.8]/", false);
+        // IPv4-compatible addresses are not mapped
+        check("http://[::127.0.0.1]/", false);
+    }
+
+    void
+    testMapped()
+    {
+        // IPv6 rules inside ::ffff:0:0/96
+        // apply to IPv4 addresses
+        {
+            ip_matcher m;
+            m.insert("::ffff:10.0.0.0/104");
+            BOOST_TEST(m.matches(ipv4_address("10.2.3.4")));
+            BOOST_TEST(m.matches(ipv6_address("::ffff:10.2.3.4")));
+            BOOST_TEST(! m.matches(ipv4_address("11.2.3.4")));
+            m.insert("10.2.0.0/16", false);
+            BOOST_TEST(! m.matches(ipv6_address("::ffff:10.2.3.4")));
+            BOOST_TEST_EQ(m.size(), 2u);
+        }
+
+        // both forms of an address give the
+        // same result, and shorter IPv6 rules
+        // apply to neither
+        {
+            ip_matcher m;
+            m.insert("::/0");
+            BOOST_TEST(! m.matches(ipv6_address("::ffff:10.0.0.1")));
+            BOOST_TEST(! m.matches(ipv4_address("10.0.0.1")));
+            BOOST_TEST(m.matches(ipv6_address("::1")));
+            m.insert("::ffff:0:0/96");
+            BOOST_TEST(m.matches(ipv6_address("::ffff:10.0.0.1")));
+            BOOST_TEST(m.matches(ipv4_address("10.0.0.1")));
+            m.insert("10.0.0.0/8", false);
+            BOOST_TEST(! m.matches(ipv6_address("::ffff:10.0.0.1")));
+            BOOST_TEST(! m.matches(ipv4_address("10.0.0.1")));
+            BOOST_TEST(m.matches(ipv6_address("::ffff:11.0.0.1")));
+            BOOST_TEST(m.matches(ipv4_address("11.0.0.1")));
+        }
+        {
+            ip_matcher m;
+            m.insert("0.0.0.0/0");
+            m.insert("::/0", false);
+            m.insert("192.168.0.0/16", false);
+            m.insert("::ffff:192.168.1.0/120");
+            std::mt19937 g(11);
+            for(int i = 0; i < 1000; ++i)
+            {
+                std::uint32_t const a = i % 2 ?
+                    static_cast<std::uint32_t>(g()) :
+                    0xC0A80000 | (g() & 0x1ff);
+                ipv4_address const a4(a);
+                BOOST_TEST_EQ(
+                    m.matches(a4),
+                    m.matches(ipv6_address(a4)));
+            }
+        }
+    }
+
+    // the longest containing network of a
+    // list, by comparing with each network
+    template<class Network, class Address>
+    static
+    int
+    linear_find(
+        std::vector<std::pair<Network, bool>> const& rules,
+        Address const& a)
+    {
+        int best = -1;
+        std::size_t len = 0;
+        for(auto const& r : rules)
+        {
+            if( r.first.contains(a) && (
+                best < 0 ||
+                r.first.prefix_length() >= len))
+            {
+                best = r.second;
+                len = r.first.prefix_length();
+            }
+        }
+        return best;
+    }
+
+    void
+    testRandom()
+    {
+        // compare with a linear search, using
+        // few distinct top bits so that the
+        // networks nest and share prefixes
+        std::mt19937 g(7);
+        for(int round = 0; round < 20; ++round)
+        {
+            ip_matcher m;
+            std::vector<std::pair<ipv4_network, bool>> r4;
+            std::vector<std::pair<ipv6_network, bool>> r6;
+            int const n = 1 + round * 50;
+            for(int i = 0; i < n; ++i)
+            {
+                bool const match = g() % 3 != 0;
+                std::uint32_t const a =
+                    (g() % 4) << 30 | (g() & 0x3fffffff);
+                ipv4_network const n4(
+                    ipv4_address(a), g() % 33);
+                m.insert(n4, match);
+                r4.push_back({ n4, match });
+
+                ipv6_address::bytes_type b;
+                for(auto& c : b)
+                    c = static_cast<unsigned char>(g());
+                b[0] &= 0x81;
+                ipv6_network const n6(
+                    ipv6_address(b), g() % 129);
+                m.insert(n6, match);
+                r6.push_back({ n6, match });
+            }
+            for(int i = 0; i < 2000; ++i)
+            {
+                std::uint32_t const a =
+                    (g() % 4) << 30 | (g() & 0x3fffffff);
+                // near a network address
+                std::uint32_t const a4 = i % 2 ? a :
+                    r4[g() % r4.size()].first.address().to_uint() ^
+                        (1u << (g() % 32));
+                BOOST_TEST_EQ(
+                    m.matches(ipv4_address(a4)),
+                    linear_find(r4, ipv4_address(a4)) == 1);
+
+                ipv6_address::bytes_type b;
+                if(i % 2)
+                {
+                    for(auto& c : b)
+                        c = static_cast<unsigned char>(g());
+                    b[0] &= 0x81;
+                }
+                else
+                {
+                    b = r6[g() % r6.size()].first.address().to_bytes();
+                    unsigned const bit = g() % 128;
+                    b[bit / 8] ^= static_cast<unsigned char>(
+                        0x80 >> (bit % 8));
+                }
+                ipv6_address const a6(b);
+                BOOST_TEST_EQ(
+                    m.matches(a6),
+                    linear_find(r6, a6) == 1);
+            }
+
+            // distinct networks are counted
+            std::vector<ipv4_network> d4;
+            std::vector<ipv6_network> d6;
+            for(auto const& r : r4)
+                if(std::find(d4.begin(), d4.end(), r.first) == d4.end())
+                    d4.push_back(r.first);
+            for(auto const& r : r6)
+                if(std::find(d6.begin(), d6.end(), r.first) == d6.end())
+                    d6.push_back(r.first);
+            BOOST_TEST_EQ(m.size(), d4.size() + d6.size());
+        }
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testMatch();
+        testMapped();
+        testRandom();
+    }
+};
+
+TEST_SUITE(
+    ip_matcher_test,
+    "boost.url.ip_matcher");
+
+} // urls
+} // boost
@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/ipv4_network.hpp>
+
+#include "test_suite.hpp"
+#include <sstream>
+
+namespace boost {
+namespace urls {
+
+class ipv4_network_test
+{
+public:
+    void
+    testMembers()
+    {
+        // ipv4_network()
+        {
+            ipv4_network n;
+            BOOST_TEST_EQ(n.address(), ipv4_address());
+            BOOST_TEST_EQ(n.prefix_length(), 0u);
+            BOOST_TEST_EQ(n.netmask(), ipv4_address());
+            BOOST_TEST(n.contains(ipv4_address(0xffffffff)));
+            BOOST_TEST_EQ(n.to_string(), "0.0.0.0/0");
+        }
+
+        // ipv4_network(ipv4_address, std::size_t)
+        {
+            ipv4_network n(ipv4_address("10.1.2.3"), 8);
+            BOOST_TEST_EQ(n.address(), ipv4_address("10.0.0.0"));
+            BOOST_TEST_EQ(n.prefix_length(), 8u);
+            BOOST_TEST_EQ(n.netmask(), ipv4_address("255.0.0.0"));
+            BOOST_TEST_EQ(
+                ipv4_network(ipv4_address("10.1.2.3"), 32).address(),
+                ipv4_address("10.1.2.3"));
+            BOOST_TEST_EQ(
+                ipv4_network(ipv4_address("10.1.2.3"), 0).address(),
+                ipv4_address());
+            BOOST_TEST_THROWS(
+                ipv4_network(ipv4_address(), 33),
+                system::system_error);
+        }
+
+        // ipv4_network(core::string_view)
+        {
+            ipv4_network n("172.16.0.0/12");
+            BOOST_TEST_EQ(n.address(), ipv4_address("172.16.0.0"));
+            BOOST_TEST_EQ(n.prefix_length(), 12u);
+            BOOST_TEST_EQ(n.netmask(), ipv4_address("255.240.0.0"));
+            BOOST_TEST_THROWS(
+                ipv4_network("x"),
+                system::system_error);
+        }
+
+        // contains
+        {
+            ipv4_network n("192.168.0.0/16");
+            BOOST_TEST(n.contains(ipv4_address("192.168.0.0")));
+            BOOST_TEST(n.contains(ipv4_address("192.168.255.255")));
+            BOOST_TEST(! n.contains(ipv4_address("192.169.0.0")));
+            BOOST_TEST(! n.contains(ipv4_address("192.167.255.255")));
+            BOOST_TEST(n.contains(n));
+            BOOST_TEST(n.contains(ipv4_network("192.168.10.0/24")));
+            BOOST_TEST(! n.contains(ipv4_network("192.0.0.0/8")));
+            BOOST_TEST(! n.contains(ipv4_network("10.0.0.0/24")));
+            BOOST_TEST(ipv4_network().contains(n));
+            ipv4_network h("1.2.3.4/32");
+            BOOST_TEST(h.contains(ipv4_address("1.2.3.4")));
+            BOOST_TEST(! h.contains(ipv4_address("1.2.3.5")));
+        }
+
+        // comparison
+        {
+            BOOST_TEST_EQ(
+                ipv4_network("10.0.0.0/8"),
+                ipv4_network(ipv4_address("10.9.9.9"), 8));
+            BOOST_TEST_NE(
+                ipv4_network("10.0.0.0/8"),
+                ipv4_network("10.0.0.0/9"));
+        }
+
+        // to_buffer, operator<<
+        {
+            char buf[ipv4_network::max_str_len];
+            ipv4_network n("255.255.255.255/32");
+            BOOST_TEST_EQ(
+                n.to_buffer(buf, sizeof(buf)),
+                "255.255.255.255/32");
+            BOOST_TEST_THROWS(
+                n.to_buffer(buf, sizeof(buf) - 1),
+                system::system_error);
+            std::stringstream ss;
+            ss << ipv4_network("10.0.0.0/8");
+            BOOST_TEST_EQ(ss.str(), "10.0.0.0/8");
+        }
+    }
+
+    void
+    testParse()
+    {
+        auto const good = [](
+            core::string_view s,
+            ipv4_address::uint_type addr,
+            std::size_t len)
+        {
+            auto rv = parse_ipv4_network(s);
+            if(! BOOST_TEST(rv.has_value()))
+                return;
+            BOOST_TEST_EQ(rv->address().to_uint(), addr);
+            BOOST_TEST_EQ(rv->prefix_length(), len);
+            BOOST_TEST_EQ(rv->to_string(), s);
+        };
+
+        auto const bad = [](
+            core::string_view s)
+        {
+            BOOST_TEST(parse_ipv4_network(s).has_error());
+        };
+
+        good("0.0.0.0/0", 0, 0);
+        good("10.0.0.0/8", 0x0a000000, 8);
+        good("100.64.0.0/10", 0x64400000, 10);
+        good("169.254.0.0/16", 0xa9fe0000, 16);
+        good("192.0.2.0/24", 0xc0000200, 24);
+        good("203.0.113.7/32", 0xcb007107, 32);
+
+        bad("");
+        bad("/8");
+        bad("10.0.0.0");
+        bad("10.0.0.0/");
+        bad("10.0.0.0/33");
+        bad("10.0.0.0/100");
+        bad("10.0.0.0/08");
+        bad("10.0.0.0/8x");
+        bad("10.0.0.0/-8");
+        bad("10.0.0.0/ 8");
+        bad("10.0.0/8");
+        bad("10.0.0.0.0/8");
+        bad("10.0.0.0/8/8");
+        bad("::/0");
+
+        // host bits
+        bad("10.0.0.1/8");
+        bad("0.0.0.1/0");
+        bad("192.168.1.0/23");
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testParse();
+    }
+};
+
+TEST_SUITE(
+    ipv4_network_test,
+    "boost.url.ipv4_network");
+
+} // urls
+} // boost
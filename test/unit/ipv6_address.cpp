@@ -12,7 +12,10 @@
 
 #include <boost/url/ipv4_address.hpp>
 #include "test_suite.hpp"
+#include <cstdio>
+#include <random>
 #include <sstream>
+#include <string>
 
 namespace boost {
 namespace urls {
@@ -297,6 +300,21 @@ public:
               "1234:1234:1234:1234:1234:1234:ffff:ffff");
         trip("0:0:0:0:0:ffff:1.2.3.4", "::ffff:1.2.3.4");
 
+        // rfc5952
+        trip("1:0:2:3:4:5:6:7", "1:0:2:3:4:5:6:7");
+        trip("0:1:2:3:4:5:6:7", "0:1:2:3:4:5:6:7");
+        trip("1:2:3:4:5:6:7:0", "1:2:3:4:5:6:7:0");
+        trip("2001:db8:0:1:1:1:1:1", "2001:db8:0:1:1:1:1:1");
+        trip("2001:0:0:1:0:0:0:1", "2001:0:0:1::1");
+        trip("2001:db8:0:0:1:0:0:1", "2001:db8::1:0:0:1");
+        trip("2001:0db8::0001", "2001:db8::1");
+        trip("2001:DB8::AAAA", "2001:db8::aaaa");
+        trip("0:0:1:0:0:1:0:0", "::1:0:0:1:0:0");
+        trip("1:0:0:2:0:0:3:4", "1::2:0:0:3:4");
+        trip("1:0:0:2:0:0:0:4", "1:0:0:2::4");
+        trip("ffff:fff:ff:f:0:10:100:1000",
+             "ffff:fff:ff:f:0:10:100:1000");
+
         check("1:2:3:4:5:6:7:8", 0x0001000200030004, 0x0005000600070008);
         check("::2:3:4:5:6:7:8", 0x0000000200030004, 0x0005000600070008);
         check("1::3:4:5:6:7:8",  0x0001000000030004, 0x0005000600070008);
@@ -402,12 +420,58 @@ public:
                 "::ffff:127.0.0.1");
     }
 
+    void
+    testRandom()
+    {
+        // the text of random addresses
+        // round-trips, in every form
+        std::minstd_rand g(1);
+        for(int i = 0; i < 10000; ++i)
+        {
+            ipv6_address::bytes_type b;
+            for(std::size_t j = 0; j < 16; j += 2)
+            {
+                unsigned const w = g() % 3 == 0 ?
+                    0 : g() % 0x10000 >> (g() % 16);
+                b[j] = static_cast<unsigned char>(w >> 8);
+                b[j + 1] = static_cast<unsigned char>(w);
+            }
+            ipv6_address const a(b);
+            std::string const s = a.to_string();
+            BOOST_TEST_EQ(ipv6_address(s), a);
+            BOOST_TEST_LE(s.size(), 39u);
+
+            // full form, uppercase
+            std::string t;
+            for(std::size_t j = 0; j < 16; j += 2)
+            {
+                char buf[6];
+                std::snprintf(buf, sizeof(buf), "%04X",
+                    b[j] * 256U + b[j + 1]);
+                if(j != 0)
+                    t.push_back(':');
+                t += buf;
+            }
+            BOOST_TEST_EQ(ipv6_address(t), a);
+            BOOST_TEST_EQ(ipv6_address(t).to_string(), s);
+
+            // with an IPv4address
+            std::string const u = t.substr(0, 30) +
+                std::to_string(b[12]) + "." +
+                std::to_string(b[13]) + "." +
+                std::to_string(b[14]) + "." +
+                std::to_string(b[15]);
+            BOOST_TEST_EQ(ipv6_address(u), a);
+        }
+    }
+
     void
     run()
     {
         testMembers();
         testIO();
         testIpv4();
+        testRandom();
     }
 };
 
@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/ipv6_network.hpp>
+
+#include "test_suite.hpp"
+#include <sstream>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class ipv6_network_test
+{
+public:
+    void
+    testMembers()
+    {
+        // ipv6_network()
+        {
+            ipv6_network n;
+            BOOST_TEST_EQ(n.address(), ipv6_address());
+            BOOST_TEST_EQ(n.prefix_length(), 0u);
+            BOOST_TEST_EQ(n.netmask(), ipv6_address());
+            BOOST_TEST(n.contains(ipv6_address("ffff::1")));
+            BOOST_TEST_EQ(n.to_string(), "::/0");
+        }
+
+        // ipv6_network(ipv6_address, std::size_t)
+        {
+            ipv6_network n(ipv6_address("2001:db8:1:2::3"), 32);
+            BOOST_TEST_EQ(n.address(), ipv6_address("2001:db8::"));
+            BOOST_TEST_EQ(n.prefix_length(), 32u);
+            BOOST_TEST_EQ(n.netmask(), ipv6_address("ffff:ffff::"));
+            BOOST_TEST_EQ(
+                ipv6_network(ipv6_address("fe80::1"), 10).address(),
+                ipv6_address("fe80::"));
+            BOOST_TEST_EQ(
+                ipv6_network(ipv6_address("fe80::1"), 127).address(),
+                ipv6_address("fe80::"));
+            BOOST_TEST_EQ(
+                ipv6_network(ipv6_address("fe80::1"), 128).address(),
+                ipv6_address("fe80::1"));
+            BOOST_TEST_THROWS(
+                ipv6_network(ipv6_address(), 129),
+                system::system_error);
+        }
+
+        // ipv6_network(core::string_view)
+        {
+            ipv6_network n("fe80::/10");
+            BOOST_TEST_EQ(n.address(), ipv6_address("fe80::"));
+            BOOST_TEST_EQ(n.prefix_length(), 10u);
+            BOOST_TEST_EQ(n.netmask(), ipv6_address("ffc0::"));
+            BOOST_TEST_THROWS(
+                ipv6_network("x"),
+                system::system_error);
+        }
+
+        // contains
+        {
+            ipv6_network n("fc00::/7");
+            BOOST_TEST(n.contains(ipv6_address("fc00::")));
+            BOOST_TEST(n.contains(ipv6_address("fdff:ffff::1")));
+            BOOST_TEST(! n.contains(ipv6_address("fe00::")));
+            BOOST_TEST(! n.contains(ipv6_address("fbff::")));
+            BOOST_TEST(n.contains(n));
+            BOOST_TEST(n.contains(ipv6_network("fd00::/8")));
+            BOOST_TEST(! n.contains(ipv6_network("fc00::/6")));
+            BOOST_TEST(ipv6_network().contains(n));
+            ipv6_network h("::1/128");
+            BOOST_TEST(h.contains(ipv6_address("::1")));
+            BOOST_TEST(! h.contains(ipv6_address("::2")));
+            ipv6_network m("::ffff:0:0/96");
+            BOOST_TEST(m.contains(ipv6_address("::ffff:1.2.3.4")));
+            BOOST_TEST(! m.contains(ipv6_address("::1.2.3.4")));
+        }
+
+        // comparison
+        {
+            BOOST_TEST_EQ(
+                ipv6_network("2001:db8::/32"),
+                ipv6_network(ipv6_address("2001:db8::1"), 32));
+            BOOST_TEST_NE(
+                ipv6_network("2001:db8::/32"),
+                ipv6_network("2001:db8::/33"));
+        }
+
+        // to_buffer, operator<<
+        {
+            char buf[ipv6_network::max_str_len];
+            ipv6_network n(
+                "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128");
+            BOOST_TEST_EQ(
+                n.to_buffer(buf, sizeof(buf)),
+                "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128");
+            BOOST_TEST_THROWS(
+                n.to_buffer(buf, sizeof(buf) - 1),
+                system::system_error);
+            std::stringstream ss;
+            ss << ipv6_network("2001:db8::/32");
+            BOOST_TEST_EQ(ss.str(), "2001:db8::/32");
+        }
+    }
+
+    void
+    testParse()
+    {
+        auto const good = [](
+            core::string_view s,
+            core::string_view addr,
+            std::size_t len)
+        {
+            auto rv = parse_ipv6_network(s);
+            if(! BOOST_TEST(rv.has_value()))
+                return;
+            BOOST_TEST_EQ(rv->address(), ipv6_address(addr));
+            BOOST_TEST_EQ(rv->prefix_length(), len);
+            BOOST_TEST_EQ(
+                rv->to_string(),
+                rv->address().to_string() + "/" +
+                    std::to_string(len));
+        };
+
+        auto const bad = [](
+            core::string_view s)
+        {
+            BOOST_TEST(parse_ipv6_network(s).has_error());
+        };
+
+        good("::/0", "::", 0);
+        good("::1/128", "::1", 128);
+        good("2001:db8::/32", "2001:db8::", 32);
+        good("2001:DB8:0::/48", "2001:db8::", 48);
+        good("fe80::/10", "fe80::", 10);
+        good("::ffff:0.0.0.0/96", "::ffff:0:0", 96);
+        good("::ffff:10.0.0.0/104", "::ffff:10.0.0.0", 104);
+        good("64:ff9b::/96", "64:ff9b::", 96);
+
+        bad("");
+        bad("/8");
+        bad("::1");
+        bad("::1/");
+        bad("::1/129");
+        bad("::1/0128");
+        bad("::/1000");
+        bad("::/1x");
+        bad("[::1]/128");
+        bad("::1/128%eth0");
+        bad("10.0.0.0/8");
+
+        // host bits
+        bad("::1/127");
+        bad("2001:db8::1/32");
+        bad("fe80::/8");
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testParse();
+    }
+};
+
+TEST_SUITE(
+    ipv6_network_test,
+    "boost.url.ipv6_network");
+
+} // urls
+} // boost
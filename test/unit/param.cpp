@@ -343,6 +343,65 @@ struct param_test
         }
     }
 
+    void
+    testParamDecodeView()
+    {
+        // param_decode_view()
+        {
+            param_decode_view qp;
+            BOOST_TEST(qp.key.empty());
+            BOOST_TEST(qp.value.empty());
+            BOOST_TEST(! qp.has_value);
+        }
+
+        // param_decode_view(param_pct_view, encoding_opts)
+        {
+            param_decode_view qp(
+                param_pct_view("first%20name", "John+Doe"));
+            BOOST_TEST_EQ(qp.key, "first name");
+            BOOST_TEST_EQ(qp.value, "John+Doe");
+            BOOST_TEST(qp.has_value);
+            encoding_opts opt;
+            opt.space_as_plus = true;
+            qp = param_decode_view(
+                param_pct_view("k", "John+Doe"), opt);
+            BOOST_TEST_EQ(qp.value, "John Doe");
+        }
+        {
+            param_decode_view qp(
+                param_pct_view("key", no_value));
+            BOOST_TEST_EQ(qp.key, "key");
+            BOOST_TEST(! qp.has_value);
+        }
+
+        // param_decode_view(decode_view, decode_view, bool)
+        {
+            param_decode_view qp(
+                decode_view("a%20"), decode_view("b"), false);
+            BOOST_TEST_EQ(qp.key, "a ");
+            BOOST_TEST(qp.value.empty());
+            BOOST_TEST(! qp.has_value);
+        }
+
+        // operator param()
+        {
+            param_decode_view qp(
+                param_pct_view("k%3D", "v%26"));
+            param p(qp);
+            BOOST_TEST_EQ(p.key, "k=");
+            BOOST_TEST_EQ(p.value, "v&");
+            BOOST_TEST(p.has_value);
+        }
+
+        // javadoc
+        {
+        param_decode_view qp( param_pct_view( "first%20name", "John%20Doe" ) );
+
+        assert( qp.key == "first name" );
+        assert( qp.value == "John Doe" );
+        }
+    }
+
     void
     testNatvis()
     {
@@ -371,6 +430,7 @@ struct param_test
         testParam();
         testParamView();
         testParamPctView();
+        testParamDecodeView();
         testNatvis();
     }
 };
@@ -88,6 +88,23 @@ struct params_base_test
             }
             while(it1 != init.begin());
         }
+        // decoded
+        {
+            auto const r = p.decoded();
+            BOOST_TEST_EQ(r.size(), init.size());
+            auto it2 = r.begin();
+            for(auto const& v : init)
+            {
+                param_decode_view const d = *it2;
+                BOOST_TEST_EQ(d.key, v.key);
+                BOOST_TEST_EQ(d.has_value, v.has_value);
+                if(v.has_value)
+                    BOOST_TEST_EQ(d.value, v.value);
+                BOOST_TEST_EQ(it2->key.size(), v.key.size());
+                ++it2;
+            }
+            BOOST_TEST(it2 == r.end());
+        }
     }
 
     static
@@ -354,6 +371,54 @@ struct params_base_test
         }
     }
 
+    void
+    testDecoded()
+    {
+        // escapes are decoded on the fly
+        {
+            url_view u("?first%20name=John+Doe&k&=%3D");
+            auto const r = u.params().decoded();
+            BOOST_TEST_EQ(r.size(), 3u);
+            auto it = r.begin();
+            BOOST_TEST_EQ(it->key, "first name");
+            BOOST_TEST_EQ(it->value, "John Doe");
+            BOOST_TEST(it->has_value);
+            ++it;
+            BOOST_TEST_EQ(it->key, "k");
+            BOOST_TEST(! it->has_value);
+            ++it;
+            BOOST_TEST_EQ(it->key, "");
+            BOOST_TEST_EQ(it->value, "=");
+            BOOST_TEST(++it == r.end());
+            BOOST_TEST_EQ((--it)->value, "=");
+        }
+
+        // encoding options
+        {
+            url_view u("?a=b+c");
+            encoding_opts opt;
+            opt.space_as_plus = false;
+            BOOST_TEST_EQ(
+                u.params(opt).decoded().begin()->value, "b+c");
+        }
+
+        // conversion to param
+        {
+            url_view u("?k%20=v%20");
+            param p(*u.params().decoded().begin());
+            BOOST_TEST_EQ(p.key, "k ");
+            BOOST_TEST_EQ(p.value, "v ");
+            BOOST_TEST(p.has_value);
+        }
+
+        // default constructed
+        {
+            params_base::decoded_range r;
+            BOOST_TEST(r.empty());
+            BOOST_TEST(r.begin() == r.end());
+        }
+    }
+
     void
     testRange()
     {
@@ -443,6 +508,7 @@ struct params_base_test
         testObservers();
         testIterator();
         testRange();
+        testDecoded();
         testJavadocs();
     }
 };
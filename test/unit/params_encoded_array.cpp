@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/params_encoded_array.hpp>
+
+#include <boost/url/parse_query.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/static_assert.hpp>
+
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+BOOST_CORE_STATIC_ASSERT(
+    std::is_same<
+        std::iterator_traits<
+            params_encoded_array::iterator>::iterator_category,
+        std::random_access_iterator_tag>::value);
+
+struct params_encoded_array_test
+{
+    // the array must agree with
+    // iteration of the view
+    static
+    void
+    check(core::string_view s)
+    {
+        url_view u(s);
+        params_encoded_view ps =
+            u.encoded_params();
+        params_encoded_array pa(ps);
+        BOOST_TEST_EQ(pa.size(), ps.size());
+        BOOST_TEST_EQ(pa.empty(), ps.empty());
+        BOOST_TEST_EQ(pa.buffer(), ps.buffer());
+        std::size_t i = 0;
+        for(auto it = ps.begin();
+            it != ps.end(); ++it, ++i)
+        {
+            param_pct_view const p0 = pa[i];
+            param_pct_view const p1 = *it;
+            BOOST_TEST_EQ(p0.key, p1.key);
+            BOOST_TEST_EQ(p0.key.data(), p1.key.data());
+            BOOST_TEST_EQ(
+                p0.key.decoded_size(),
+                p1.key.decoded_size());
+            BOOST_TEST_EQ(p0.has_value, p1.has_value);
+            BOOST_TEST_EQ(p0.value, p1.value);
+            BOOST_TEST_EQ(
+                p0.value.decoded_size(),
+                p1.value.decoded_size());
+        }
+    }
+
+    void
+    testMembers()
+    {
+        // params_encoded_array()
+        {
+            params_encoded_array pa;
+            BOOST_TEST(pa.empty());
+            BOOST_TEST(pa.begin() == pa.end());
+        }
+
+        // operator[], front, back
+        {
+            url_view u("?a=1&b=2&c=3");
+            params_encoded_array pa(u.encoded_params());
+            BOOST_TEST_EQ(pa.size(), 3u);
+            BOOST_TEST_EQ(pa[1].key, "b");
+            BOOST_TEST_EQ(pa[1].value, "2");
+            BOOST_TEST_EQ(pa.front().key, "a");
+            BOOST_TEST_EQ(pa.back().value, "3");
+            BOOST_TEST_EQ((pa.end() - 1)->value, "3");
+        }
+
+        // keys without values
+        {
+            url_view u("?k&v=&=%3D");
+            params_encoded_array pa(u.encoded_params());
+            BOOST_TEST(! pa[0].has_value);
+            BOOST_TEST(pa[0].value.empty());
+            BOOST_TEST(pa[1].has_value);
+            BOOST_TEST(pa[1].value.empty());
+            BOOST_TEST_EQ(pa[2].key, "");
+            BOOST_TEST_EQ(pa[2].value, "%3D");
+            BOOST_TEST_EQ(pa[2].value.decoded_size(), 1u);
+        }
+
+        // random access iteration
+        {
+            url_view u("?d=4&b=2&c=3&a=1");
+            params_encoded_array pa(u.encoded_params());
+            auto it = pa.begin() + 3;
+            BOOST_TEST_EQ(it->key, "a");
+            BOOST_TEST_EQ(it[-1].key, "c");
+            BOOST_TEST_EQ(it - pa.begin(), 3);
+            auto const found = std::find_if(
+                pa.begin(), pa.end(),
+                [](param_pct_view const& p)
+                {
+                    return p.key == "c";
+                });
+            BOOST_TEST_EQ(found.index(), 2u);
+        }
+
+        // from parse_query
+        {
+            auto rv = parse_query("x=1&y=2");
+            if(BOOST_TEST(rv.has_value()))
+            {
+                params_encoded_array pa(*rv);
+                BOOST_TEST_EQ(pa.size(), 2u);
+                BOOST_TEST_EQ(pa[1].value, "2");
+            }
+        }
+    }
+
+    void
+    testEquivalence()
+    {
+        check("");
+        check("?");
+        check("?&");
+        check("?key");
+        check("?key=");
+        check("?key=value");
+        check("?first=John&last=Doe");
+        check("?key=value&");
+        check("?&key=value");
+        check("?a=b=c");
+        check("?===");
+        check("?a%20b=c%26d&e+f=g#frag");
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testEquivalence();
+    }
+};
+
+TEST_SUITE(
+    params_encoded_array_test,
+    "boost.url.params_encoded_array");
+
+} // urls
+} // boost
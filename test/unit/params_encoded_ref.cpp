@@ -694,6 +694,65 @@ struct params_encoded_ref_test
             check(f, "?k0&k1=&k2=key", "k0&k1=%26%23&k2=key",
                 { {"k0",no_value}, {"k1","%26%23"}, {"k2","key"} });
         }
+
+        // remove_if(Predicate)
+        {
+            auto const f = [](params_encoded_ref qp)
+            {
+                auto n = qp.remove_if(
+                    [](param_pct_view const& p)
+                    {
+                        return p.key.starts_with("utm_");
+                    });
+                BOOST_TEST_EQ(n, 2u);
+            };
+            check(f, "?utm_source=x&id=1&utm_medium=y&q=%26",
+                "id=1&q=%26", { {"id","1"}, {"q","%26"} });
+            check(f, "?utm_a&utm_b", "", {});
+        }
+        {
+            url u("/?a=1&b=%20#f");
+            BOOST_TEST_EQ(u.encoded_params().remove_if(
+                [](param_pct_view const& p) { return p.key == "a"; }), 1u);
+            BOOST_TEST_EQ(u.buffer(), "/?b=%20#f");
+            BOOST_TEST_EQ(u.encoded_query().decoded_size(), 3u);
+        }
+
+        // retain(Predicate)
+        {
+            auto const f = [](params_encoded_ref qp)
+            {
+                qp.retain(
+                    [](param_pct_view const& p)
+                    {
+                        return p.value.decode() == "&";
+                    });
+            };
+            check(f, "?k0=%26&k1=x&k2=%26", "k0=%26&k2=%26",
+                { {"k0","%26"}, {"k2","%26"} });
+        }
+
+        // transform_values(Function)
+        {
+            auto const f = [](params_encoded_ref qp)
+            {
+                qp.transform_values(
+                    [](param_pct_view const&)
+                    {
+                        return "%26#";
+                    });
+            };
+            check(f, "", "", {});
+            check(f, "?a&b=1", "a=%26%23&b=%26%23",
+                { {"a","%26%23"}, {"b","%26%23"} });
+        }
+        {
+            url u("?a=1");
+            BOOST_TEST_THROWS(u.encoded_params().transform_values(
+                [](param_pct_view const&) { return "%"; }),
+                system::system_error);
+            BOOST_TEST_EQ(u.encoded_query(), "a=1");
+        }
     }
 
     void
@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/params_index.hpp>
+
+#include <boost/url/parse_query.hpp>
+#include <boost/url/url_view.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct params_index_test
+{
+    // the index must agree with
+    // the linear scans of params_view
+    static
+    void
+    check(
+        params_view const& ps,
+        core::string_view key)
+    {
+        params_index ix(ps);
+        BOOST_TEST_EQ(ix.size(), ps.size());
+        BOOST_TEST(ix.find(key) == ps.find(key));
+        BOOST_TEST(
+            ix.find(key, ignore_case) ==
+            ps.find(key, ignore_case));
+        BOOST_TEST_EQ(ix.count(key), ps.count(key));
+        BOOST_TEST_EQ(
+            ix.count(key, ignore_case),
+            ps.count(key, ignore_case));
+        BOOST_TEST_EQ(
+            ix.contains(key), ps.contains(key));
+        BOOST_TEST_EQ(
+            ix.get_or(key, "-"), ps.get_or(key, "-"));
+        BOOST_TEST_EQ(
+            ix.get_or(key, "-", ignore_case),
+            ps.get_or(key, "-", ignore_case));
+    }
+
+    void
+    testMembers()
+    {
+        // params_index()
+        {
+            params_index ix;
+            BOOST_TEST(ix.empty());
+            BOOST_TEST_EQ(ix.size(), 0u);
+            BOOST_TEST(ix.find("k") == ix.params().end());
+            BOOST_TEST_EQ(ix.count("k"), 0u);
+            BOOST_TEST_EQ(ix.get_or("k", "v"), "v");
+        }
+
+        // find, count, contains, get_or
+        {
+            url_view u("/?utm_source=x&id=42&lang=en&ID=43&id&%69d=44");
+            params_index ix(u.params());
+            BOOST_TEST_EQ(ix.size(), 6u);
+            BOOST_TEST_EQ((*ix.find("lang")).value, "en");
+            BOOST_TEST_EQ((*ix.find("ID")).value, "43");
+            BOOST_TEST_EQ((*ix.find("ID", ignore_case)).value, "42");
+            BOOST_TEST_EQ(ix.count("id"), 3u);
+            BOOST_TEST_EQ(ix.count("Id"), 0u);
+            BOOST_TEST_EQ(ix.count("iD", ignore_case), 4u);
+            BOOST_TEST(ix.contains("utm_source"));
+            BOOST_TEST(! ix.contains("utm_medium"));
+            BOOST_TEST(! ix.contains("UTM_SOURCE"));
+            BOOST_TEST(ix.contains("UTM_SOURCE", ignore_case));
+            BOOST_TEST_EQ(ix.get_or("lang"), "en");
+            BOOST_TEST_EQ(ix.get_or("missing", "n/a"), "n/a");
+        }
+
+        // keys without values
+        {
+            url_view u("?a&b=&c=1");
+            params_index ix(u.params());
+            BOOST_TEST(ix.contains("a"));
+            BOOST_TEST_EQ(ix.get_or("a", "n/a"), "");
+            BOOST_TEST_EQ(ix.get_or("b", "n/a"), "");
+            BOOST_TEST(! (*ix.find("a")).has_value);
+        }
+
+        // encoding options
+        {
+            url_view u("?k=a+b");
+            encoding_opts opt;
+            opt.space_as_plus = false;
+            BOOST_TEST_EQ(
+                params_index(u.params()).get_or("k"), "a b");
+            BOOST_TEST_EQ(
+                params_index(u.params(opt)).get_or("k"), "a+b");
+        }
+
+        // from parse_query
+        {
+            auto rv = parse_query("a=1&b=2&a=3");
+            if(BOOST_TEST(rv.has_value()))
+            {
+                params_index ix{params_view(*rv)};
+                BOOST_TEST_EQ(ix.count("a"), 2u);
+                BOOST_TEST_EQ(ix.get_or("b"), "2");
+            }
+        }
+    }
+
+    void
+    testEquivalence()
+    {
+        char const* const queries[] = {
+            "",
+            "?",
+            "?&",
+            "?a",
+            "?a=1&A=2&a=3",
+            "?%61=1&a=2&%41=3",
+            "?x=1&y=2&z=3&=4&&x",
+            };
+        char const* const keys[] = {
+            "", "a", "A", "x", "y", "z", "w" };
+        for(auto q : queries)
+        {
+            url_view u(q);
+            for(auto k : keys)
+                check(u.params(), k);
+        }
+
+        // enough keys to fill
+        // and grow the table
+        std::string s = "?";
+        for(int i = 0; i < 300; ++i)
+        {
+            s += "k";
+            s += std::to_string(i % 97);
+            s += "=";
+            s += std::to_string(i);
+            s += "&";
+        }
+        url_view u(s);
+        params_index ix(u.params());
+        BOOST_TEST_EQ(ix.size(), 301u);
+        for(int i = 0; i < 100; ++i)
+            check(u.params(), "k" + std::to_string(i));
+        BOOST_TEST_EQ(ix.count("k3"), 4u);
+        BOOST_TEST_EQ(ix.get_or("k3"), "3");
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testEquivalence();
+    }
+};
+
+TEST_SUITE(
+    params_index_test,
+    "boost.url.params_index");
+
+} // urls
+} // boost
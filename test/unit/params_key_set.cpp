@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/params_key_set.hpp>
+
+#include <boost/url/filtered_params.hpp>
+#include <boost/url/url_view.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct params_key_set_test
+{
+    void
+    testContains()
+    {
+        params_key_set const s(
+            { "utm_source", "utm_medium", "fbclid", "a", "" });
+        BOOST_TEST_EQ(s.size(), 5u);
+        BOOST_TEST(! s.empty());
+        BOOST_TEST(s.contains("utm_source"));
+        BOOST_TEST(s.contains("utm_medium"));
+        BOOST_TEST(s.contains("fbclid"));
+        BOOST_TEST(s.contains("a"));
+        BOOST_TEST(s.contains(""));
+        BOOST_TEST(! s.contains("UTM_SOURCE"));
+        BOOST_TEST(! s.contains("utm_sourc"));
+        BOOST_TEST(! s.contains("utm_sourcee"));
+        BOOST_TEST(! s.contains("b"));
+
+        // decoded keys
+        BOOST_TEST(s.contains(*pct_string_view("%66bclid")));
+        BOOST_TEST(s.contains(*pct_string_view("utm%5Fmedium")));
+        BOOST_TEST(! s.contains(*pct_string_view("fbcl%69")));
+
+        // ignore case
+        params_key_set const ci(
+            { "utm_source", "FBCLID" }, ignore_case);
+        BOOST_TEST_EQ(ci.size(), 2u);
+        BOOST_TEST(ci.contains("UTM_Source"));
+        BOOST_TEST(ci.contains("fbclid"));
+        BOOST_TEST(ci.contains(*pct_string_view("%46bCLid")));
+        BOOST_TEST(! ci.contains("fbclid2"));
+    }
+
+    void
+    testConstruct()
+    {
+        // empty
+        {
+            params_key_set s;
+            BOOST_TEST(s.empty());
+            BOOST_TEST_EQ(s.size(), 0u);
+            BOOST_TEST(! s.contains(""));
+            BOOST_TEST(! s.contains("a"));
+            params_key_set s2({});
+            BOOST_TEST(s2.empty());
+            BOOST_TEST(! s2.contains(""));
+        }
+
+        // duplicates
+        {
+            params_key_set s({ "a", "b", "a" });
+            BOOST_TEST_EQ(s.size(), 2u);
+            params_key_set ci({ "a", "A", "b" }, ignore_case);
+            BOOST_TEST_EQ(ci.size(), 2u);
+            BOOST_TEST(ci.contains("A"));
+        }
+
+        // iterators, and many keys
+        {
+            std::vector<std::string> keys;
+            for(std::size_t i = 0; i < 1000; ++i)
+                keys.push_back("key" + std::to_string(i));
+            params_key_set s(keys.begin(), keys.end());
+            BOOST_TEST_EQ(s.size(), 1000u);
+            std::size_t found = 0;
+            for(auto const& k : keys)
+                found += s.contains(k);
+            BOOST_TEST_EQ(found, 1000u);
+            std::size_t false_positives = 0;
+            for(std::size_t i = 1000; i < 3000; ++i)
+                false_positives += s.contains(
+                    "key" + std::to_string(i));
+            BOOST_TEST_EQ(false_positives, 0u);
+        }
+
+        // copy
+        {
+            params_key_set s({ "a", "b" });
+            params_key_set s2(s);
+            BOOST_TEST(s2.contains("a"));
+            s = params_key_set({ "c" });
+            BOOST_TEST(s.contains("c"));
+            BOOST_TEST(! s.contains("a"));
+            BOOST_TEST(s2.contains("b"));
+        }
+    }
+
+    void
+    testPredicate()
+    {
+        params_key_set const tracking(
+            { "utm_source", "utm_medium", "fbclid" },
+            ignore_case);
+        url_view u(
+            "?id=1&UTM_Source=x&q=2&%66bclid=y&utm_medium");
+
+        std::vector<std::string> v;
+        for(param_pct_view p : filter_params(
+                u.encoded_params(), tracking))
+            v.emplace_back(p.key);
+        BOOST_TEST((v == std::vector<std::string>{
+            "UTM_Source", "%66bclid", "utm_medium"}));
+
+        v.clear();
+        for(decode_view k : filter_params(
+                u.params().decoded(), tracking, param_key))
+            v.emplace_back(k.begin(), k.end());
+        BOOST_TEST((v == std::vector<std::string>{
+            "UTM_Source", "fbclid", "utm_medium"}));
+
+        std::size_t n = 0;
+        for(param const& p : filter_params(
+                u.params(), tracking))
+            n += ! p.key.empty();
+        BOOST_TEST_EQ(n, 3u);
+    }
+
+    void
+    run()
+    {
+        testContains();
+        testConstruct();
+        testPredicate();
+    }
+};
+
+TEST_SUITE(params_key_set_test, "boost.url.params_key_set");
+
+} // urls
+} // boost
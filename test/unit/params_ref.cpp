@@ -20,6 +20,7 @@
 #include "test_suite.hpp"
 
 #include <iterator>
+#include <stdexcept>
 
 #ifdef assert
 #undef assert
@@ -875,6 +876,122 @@ struct params_ref_test
             BOOST_TEST_EQ(u.encoded_query().decoded_size(), 7u);
             BOOST_TEST_EQ(u.encoded_target(), "?x=y&a=b");
         }
+
+        //
+        // remove_if(Predicate)
+        //
+
+        {
+            auto const f = [](params_ref qp)
+            {
+                auto n = qp.remove_if(
+                    [](param const& p)
+                    {
+                        return p.key.compare(0, 4, "utm_") == 0;
+                    });
+                BOOST_TEST_EQ(n, 2u);
+            };
+            check(f, "?utm_source=x&id=1&utm_medium=y&q=a+b",
+                "id=1&q=a+b", { {"id","1"}, {"q","a b"} });
+            check(f, "?id=1&utm_source=x&utm_medium=y",
+                "id=1", { {"id","1"} });
+        }
+        {
+            // remove nothing
+            url u("?a=1&b");
+            BOOST_TEST_EQ(u.params().remove_if(
+                [](param const&) { return false; }), 0u);
+            BOOST_TEST_EQ(u.encoded_query(), "a=1&b");
+        }
+        {
+            // remove everything
+            url u("http://x/?a=1&b&c=%20");
+            BOOST_TEST_EQ(u.params().remove_if(
+                [](param const&) { return true; }), 3u);
+            BOOST_TEST(! u.has_query());
+            BOOST_TEST_EQ(u.buffer(), "http://x/");
+        }
+        {
+            // the new first param gets the '?'
+            url u("/path?a=1&b=2%202#frag");
+            BOOST_TEST_EQ(u.params().remove_if(
+                [](param const& p) { return p.key == "a"; }), 1u);
+            BOOST_TEST_EQ(u.buffer(), "/path?b=2%202#frag");
+            BOOST_TEST_EQ(u.encoded_query().decoded_size(), 5u);
+            BOOST_TEST_EQ(u.encoded_target(), "/path?b=2%202");
+            BOOST_TEST_EQ(u.encoded_fragment(), "frag");
+        }
+        {
+            // empty params
+            url u("?&a&");
+            BOOST_TEST_EQ(u.params().remove_if(
+                [](param const& p) { return p.key.empty(); }), 2u);
+            BOOST_TEST_EQ(u.encoded_query(), "a");
+            BOOST_TEST_EQ(u.params().size(), 1u);
+        }
+
+        {
+            // exceptions thrown by the
+            // predicate leave the query intact
+            url u("/p?utm_a=1&b=2&utm_c=3&d#f");
+            std::size_t n = 0;
+            BOOST_TEST_THROWS(u.params().remove_if(
+                [&n](param const& p)
+                {
+                    if(++n == 4)
+                        throw std::runtime_error("");
+                    return p.key.compare(0, 4, "utm_") == 0;
+                }), std::runtime_error);
+            BOOST_TEST_EQ(u.buffer(), "/p?utm_a=1&b=2&utm_c=3&d#f");
+            BOOST_TEST_EQ(u.params().size(), 4u);
+            BOOST_TEST_EQ(u.encoded_query().decoded_size(), 21u);
+        }
+
+        //
+        // retain(Predicate)
+        //
+
+        {
+            auto const f = [](params_ref qp)
+            {
+                qp.retain(
+                    [](param const& p)
+                    {
+                        return p.has_value;
+                    });
+            };
+            check(f, "?a&b=1&c&d=", "b=1&d=",
+                { {"b","1"}, {"d",""} });
+            check(f, "?a&b", "", {});
+        }
+
+        //
+        // transform_values(Function)
+        //
+
+        {
+            auto const f = [](params_ref qp)
+            {
+                qp.transform_values(
+                    [](param const& p) -> std::string
+                    {
+                        return p.value + "!";
+                    });
+            };
+            check(f, "", "", {});
+            check(f, "?a=1&b&c=x%20y", "a=1!&b=!&c=x+y!",
+                { {"a","1!"}, {"b","!"}, {"c","x y!"} });
+        }
+        {
+            // values are encoded per the
+            // options of the container
+            url u("?k=v");
+            encoding_opts opt;
+            opt.space_as_plus = false;
+            u.params(opt).transform_values(
+                [](param const&) { return "a b&c"; });
+            BOOST_TEST_EQ(u.encoded_query(), "k=a%20b%26c");
+        }
     }
 
     static
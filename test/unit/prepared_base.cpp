@@ -0,0 +1,266 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/prepared_base.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/static_url.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct prepared_base_test
+{
+    // dest must hold the same url, with
+    // the same parts, as parsing its string
+    static
+    void
+    checkParts(url_view_base const& u)
+    {
+        auto rv = parse_uri_reference(u.buffer());
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        url_view const v = *rv;
+        BOOST_TEST_EQ(u.encoded_path(), v.encoded_path());
+        BOOST_TEST_EQ(u.encoded_query(), v.encoded_query());
+        BOOST_TEST_EQ(u.encoded_fragment(), v.encoded_fragment());
+        BOOST_TEST_EQ(u.has_query(), v.has_query());
+        BOOST_TEST_EQ(u.has_fragment(), v.has_fragment());
+        BOOST_TEST_EQ(u.segments().size(), v.segments().size());
+        BOOST_TEST_EQ(u.params().size(), v.params().size());
+        BOOST_TEST_EQ(u.path().size(), v.path().size());
+        BOOST_TEST_EQ(u.query().size(), v.query().size());
+        BOOST_TEST_EQ(u.fragment().size(), v.fragment().size());
+        BOOST_TEST_EQ(u.host_type(), v.host_type());
+        BOOST_TEST_EQ(u.port_number(), v.port_number());
+        BOOST_TEST_EQ(u.scheme_id(), v.scheme_id());
+    }
+
+    void
+    testRfc()
+    {
+        // RFC 3986 5.4
+        prepared_base const pb(
+            url_view("http://a/b/c/d;p?q"));
+        url dest;
+        auto check = [&](
+            core::string_view r,
+            core::string_view m)
+        {
+            auto rv = pb.resolve(
+                url_view(r), dest);
+            if(! BOOST_TEST(rv.has_value()))
+                return;
+            BOOST_TEST_EQ(dest.buffer(), m);
+            checkParts(dest);
+        };
+
+        check("g:h"          , "g:h");
+        check("g"            , "http://a/b/c/g");
+        check("./g"          , "http://a/b/c/g");
+        check("g/"           , "http://a/b/c/g/");
+        check("/g"           , "http://a/g");
+        check("//g"          , "http://g");
+        check("?y"           , "http://a/b/c/d;p?y");
+        check("g?y"          , "http://a/b/c/g?y");
+        check("#s"           , "http://a/b/c/d;p?q#s");
+        check("g#s"          , "http://a/b/c/g#s");
+        check("g?y#s"        , "http://a/b/c/g?y#s");
+        check(";x"           , "http://a/b/c/;x");
+        check("g;x"          , "http://a/b/c/g;x");
+        check("g;x?y#s"      , "http://a/b/c/g;x?y#s");
+        check(""             , "http://a/b/c/d;p?q");
+        check("."            , "http://a/b/c/");
+        check("./"           , "http://a/b/c/");
+        check(".."           , "http://a/b/");
+        check("%2E%2E"       , "http://a/b/");
+        check("../"          , "http://a/b/");
+        check("../g"         , "http://a/b/g");
+        check("../.."        , "http://a/");
+        check("../../"       , "http://a/");
+        check("../../g"      , "http://a/g");
+        check("../../../g"   , "http://a/../g");
+        check("../../../../g", "http://a/../../g");
+        check("/./g"         , "http://a/g");
+        check("/../g"        , "http://a/../g");
+        check("g."           , "http://a/b/c/g.");
+        check(".g"           , "http://a/b/c/.g");
+        check("g.."          , "http://a/b/c/g..");
+        check("..g"          , "http://a/b/c/..g");
+        check("./../g"       , "http://a/b/g");
+        check("./g/."        , "http://a/b/c/g/");
+        check("g/./h"        , "http://a/b/c/g/h");
+        check("g/../h"       , "http://a/b/c/h");
+        check("g;x=1/./y"    , "http://a/b/c/g;x=1/y");
+        check("g;x=1/../y"   , "http://a/b/c/y");
+        check("g?y/./x"      , "http://a/b/c/g?y/./x");
+        check("g#s/../x"     , "http://a/b/c/g#s/../x");
+        check("http:g"       , "http://a/b/c/g");
+    }
+
+    void
+    testEquivalence()
+    {
+        // every base and reference gives
+        // the same result as resolve()
+        core::string_view const bases[] = {
+            "http://a/b/c/d;p?q",
+            "http://a",
+            "http://a/",
+            "http://a?q#f",
+            "http://u:p@a:81/b/./c/../d/e",
+            "http://a/%2E%2E/b/%7e/c",
+            "http://a/../../b",
+            "http://a//b//c",
+            "http://a/b/c/",
+            "http://a/b/..",
+            "http://a/b/.",
+            "http://a/b/%2e%2E",
+            "http://a/b/../c/..",
+            "http://a/..",
+            "HTTP://A/B%2fC/d",
+            "file:///etc/hosts",
+            "http://[::1]:8080/x/y",
+            "mailto:a@b",
+            "urn:a:b:c",
+            "x:/a/b/c",
+            "x:a/b",
+            "x:",
+            "/a/b",
+        };
+        core::string_view const refs[] = {
+            "", ".", "..", "./", "../", "g", "g/",
+            "/g", "//g", "//g/./h", "?", "?y", "#",
+            "#s", "?y#s", "g?y#s", "./g", "../g",
+            "../../g", "../../../g", "/./g", "/../g",
+            "/../../g/.", "g/./h/../i", "%2e/%2E%2e/g",
+            "%7e/%41", ".//g", "g//h", "a:b",
+            "./a:b", "x:g", "http:g", "https:g",
+            "g;x=1/../y", "/", "//", "///",
+            "g%2F/../h", "..%2F", "a/b/c/../../..",
+            "a/b/c/../../../..", "../..//g",
+        };
+        for(auto b : bases)
+        {
+            url_view const bv(b);
+            prepared_base const pb(bv);
+            url dest;
+            static_url<1024> sdest;
+            for(auto r : refs)
+            {
+                url_view const rv(r);
+                url expect;
+                auto r0 = urls::resolve(bv, rv, expect);
+                auto r1 = pb.resolve(rv, dest);
+                auto r2 = pb.resolve(rv, sdest);
+                BOOST_TEST_EQ(r0.has_value(), r1.has_value());
+                BOOST_TEST_EQ(r0.has_value(), r2.has_value());
+                if(! r0)
+                {
+                    BOOST_TEST(r1.error() == r0.error());
+                    continue;
+                }
+                if(! BOOST_TEST_EQ(dest.buffer(), expect.buffer()))
+                    test_suite::log << b << " + " << r << "\n";
+                BOOST_TEST_EQ(sdest.buffer(), expect.buffer());
+                checkParts(dest);
+                checkParts(sdest);
+                auto s = pb.resolve(rv);
+                if(BOOST_TEST(s.has_value()))
+                    BOOST_TEST_EQ(*s, expect.buffer());
+            }
+        }
+    }
+
+    void
+    testReuse()
+    {
+        prepared_base const pb(
+            url_view("http://example.com/docs/a/index.html"));
+        BOOST_TEST_EQ(pb.base().buffer(),
+            "http://example.com/docs/a/index.html");
+
+        // destination capacity is reused
+        url dest;
+        dest.reserve(256);
+        auto const cap = dest.capacity();
+        char const* const p = dest.data();
+        for(int i = 0; i < 100; ++i)
+        {
+            BOOST_TEST(pb.resolve(
+                url_view("../b/img.png?v=1#top"), dest));
+            BOOST_TEST(pb.resolve(
+                url_view("/root"), dest));
+            BOOST_TEST(pb.resolve(
+                url_view("?x"), dest));
+        }
+        BOOST_TEST_EQ(dest.buffer(),
+            "http://example.com/docs/a/index.html?x");
+        BOOST_TEST_EQ(dest.capacity(), cap);
+        BOOST_TEST(dest.data() == p);
+
+        // ref is a view of dest
+        BOOST_TEST(pb.resolve(url_view("c/d"), dest));
+        BOOST_TEST(pb.resolve(url_view(dest), dest));
+        BOOST_TEST_EQ(dest.buffer(),
+            "http://example.com/docs/a/c/d");
+        BOOST_TEST(pb.resolve(dest, dest));
+        BOOST_TEST_EQ(dest.buffer(),
+            "http://example.com/docs/a/c/d");
+
+        // string token
+        {
+            std::string s;
+            auto rv = pb.resolve(url_view("x/../y"),
+                string_token::assign_to(s));
+            BOOST_TEST(rv.has_value());
+            BOOST_TEST_EQ(s, "http://example.com/docs/a/y");
+        }
+    }
+
+    void
+    testNotABase()
+    {
+        {
+            prepared_base pb;
+            url dest;
+            auto rv = pb.resolve(url_view("g"), dest);
+            BOOST_TEST(rv.has_error());
+            BOOST_TEST(rv.error() == error::not_a_base);
+        }
+        {
+            prepared_base pb(url_view("/a/b"));
+            auto rv = pb.resolve(url_view("g"));
+            BOOST_TEST(rv.has_error());
+            BOOST_TEST(rv.error() == error::not_a_base);
+        }
+    }
+
+    void
+    run()
+    {
+        testRfc();
+        testEquivalence();
+        testReuse();
+        testNotABase();
+    }
+};
+
+TEST_SUITE(
+    prepared_base_test,
+    "boost.url.prepared_base");
+
+} // urls
+} // boost
@@ -0,0 +1,320 @@
+//
+// Copyright (c) 2023 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/public_suffix_list.hpp>
+
+#include <boost/url/url_view.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct public_suffix_list_test
+{
+    // an excerpt of the list, with the
+    // rules used by its own test cases
+    static constexpr char const* rules =
+        "// ===BEGIN ICANN DOMAINS===\n"
+        "\n"
+        "// com : https://en.wikipedia.org/wiki/.com\n"
+        "com\n"
+        "\n"
+        "biz\n"
+        "uk\n"
+        "co.uk\n"
+        "ac.jp\n"
+        "jp\n"
+        "kyoto.jp\n"
+        "ide.kyoto.jp\n"
+        "*.kobe.jp\n"
+        "!city.kobe.jp\n"
+        "*.ck\n"
+        "!www.ck\n"
+        "us\n"
+        "ak.us\n"
+        "k12.ak.us\n"
+        "cn\n"
+        "\xe5\x85\xac\xe5\x8f\xb8.cn   trailing text\r\n"
+        "xn--55qx5d.cn\n"
+        "// ===END ICANN DOMAINS===\n"
+        "// ===BEGIN PRIVATE DOMAINS===\n"
+        "github.io\n"
+        "*.compute.amazonaws.com\n"
+        "// ===END PRIVATE DOMAINS===";
+
+    static
+    void
+    check(
+        public_suffix_list const& psl,
+        core::string_view host,
+        core::string_view suffix,
+        core::string_view domain)
+    {
+        BOOST_TEST_EQ(psl.public_suffix(host), suffix);
+        BOOST_TEST_EQ(psl.registrable_domain(host), domain);
+    }
+
+    static
+    void
+    checkList(public_suffix_list const& psl)
+    {
+        // unlisted tld
+        check(psl, "example", "example", "");
+        check(psl, "example.example", "example", "example.example");
+        check(psl, "b.example.example", "example", "example.example");
+        check(psl, "a.b.example.example", "example", "example.example");
+
+        // tld with only one rule
+        check(psl, "biz", "biz", "");
+        check(psl, "domain.biz", "biz", "domain.biz");
+        check(psl, "b.domain.biz", "biz", "domain.biz");
+        check(psl, "a.b.domain.biz", "biz", "domain.biz");
+
+        // tld with some 2-level rules
+        check(psl, "com", "com", "");
+        check(psl, "example.com", "com", "example.com");
+        check(psl, "b.example.com", "com", "example.com");
+        check(psl, "a.b.example.com", "com", "example.com");
+        check(psl, "uk.com", "com", "uk.com");
+        check(psl, "example.uk.com", "com", "uk.com");
+        check(psl, "co.uk", "co.uk", "");
+        check(psl, "www.example.co.uk", "co.uk", "example.co.uk");
+
+        // more complex tld
+        check(psl, "jp", "jp", "");
+        check(psl, "test.jp", "jp", "test.jp");
+        check(psl, "www.test.jp", "jp", "test.jp");
+        check(psl, "ac.jp", "ac.jp", "");
+        check(psl, "test.ac.jp", "ac.jp", "test.ac.jp");
+        check(psl, "www.test.ac.jp", "ac.jp", "test.ac.jp");
+        check(psl, "kyoto.jp", "kyoto.jp", "");
+        check(psl, "test.kyoto.jp", "kyoto.jp", "test.kyoto.jp");
+        check(psl, "ide.kyoto.jp", "ide.kyoto.jp", "");
+        check(psl, "b.ide.kyoto.jp", "ide.kyoto.jp", "b.ide.kyoto.jp");
+        check(psl, "a.b.ide.kyoto.jp", "ide.kyoto.jp", "b.ide.kyoto.jp");
+
+        // wildcards and exceptions
+        check(psl, "c.kobe.jp", "c.kobe.jp", "");
+        check(psl, "b.c.kobe.jp", "c.kobe.jp", "b.c.kobe.jp");
+        check(psl, "a.b.c.kobe.jp", "c.kobe.jp", "b.c.kobe.jp");
+        check(psl, "city.kobe.jp", "kobe.jp", "city.kobe.jp");
+        check(psl, "www.city.kobe.jp", "kobe.jp", "city.kobe.jp");
+        check(psl, "ck", "ck", "");
+        check(psl, "test.ck", "test.ck", "");
+        check(psl, "b.test.ck", "test.ck", "b.test.ck");
+        check(psl, "a.b.test.ck", "test.ck", "b.test.ck");
+        check(psl, "www.ck", "ck", "www.ck");
+        check(psl, "www.www.ck", "ck", "www.ck");
+        check(psl, "x.compute.amazonaws.com",
+            "x.compute.amazonaws.com", "");
+        check(psl, "y.x.compute.amazonaws.com",
+            "x.compute.amazonaws.com",
+            "y.x.compute.amazonaws.com");
+        check(psl, "amazonaws.com", "com", "amazonaws.com");
+
+        // us k12
+        check(psl, "us", "us", "");
+        check(psl, "test.us", "us", "test.us");
+        check(psl, "www.test.us", "us", "test.us");
+        check(psl, "ak.us", "ak.us", "");
+        check(psl, "test.ak.us", "ak.us", "test.ak.us");
+        check(psl, "k12.ak.us", "k12.ak.us", "");
+        check(psl, "test.k12.ak.us", "k12.ak.us", "test.k12.ak.us");
+        check(psl, "www.test.k12.ak.us", "k12.ak.us", "test.k12.ak.us");
+
+        // idn labels, decoded and punycode
+        check(psl, "%E5%85%AC%E5%8F%B8.cn",
+            "%E5%85%AC%E5%8F%B8.cn", "");
+        check(psl, "xn--85x722f.%e5%85%ac%e5%8f%b8.cn",
+            "%e5%85%ac%e5%8f%b8.cn",
+            "xn--85x722f.%e5%85%ac%e5%8f%b8.cn");
+        check(psl, "shishi.xn--55qx5d.cn",
+            "xn--55qx5d.cn", "shishi.xn--55qx5d.cn");
+        check(psl, "shishi.xn--55qx5d.xn--55qx5d",
+            "xn--55qx5d", "xn--55qx5d.xn--55qx5d");
+
+        // private domains
+        check(psl, "github.io", "github.io", "");
+        check(psl, "user.github.io", "github.io", "user.github.io");
+
+        // case and escapes
+        check(psl, "WWW.Example.CO.UK",
+            "CO.UK", "Example.CO.UK");
+        check(psl, "a.%63om", "%63om", "a.%63om");
+        check(psl, "a.c%25om", "c%25om", "a.c%25om");
+
+        // trailing dot
+        check(psl, "www.example.co.uk.",
+            "co.uk", "example.co.uk");
+        check(psl, "co.uk.", "co.uk", "");
+
+        // invalid hosts
+        check(psl, "", "", "");
+        check(psl, ".", "", "");
+        check(psl, "com..", "", "");
+        check(psl, ".com", "com", "");
+        check(psl, "example..com", "com", "");
+        check(psl, "a..example.com", "com", "example.com");
+    }
+
+    void
+    testCompile()
+    {
+        auto psl = public_suffix_list::compile(rules);
+        checkList(psl);
+
+        // rules are case insensitive
+        auto psl2 = public_suffix_list::compile(
+            "CO.UK\n*.Kobe.JP\n!City.KOBE.jp");
+        check(psl2, "a.b.co.uk", "co.uk", "b.co.uk");
+        check(psl2, "www.city.kobe.jp", "kobe.jp", "city.kobe.jp");
+        check(psl2, "b.c.kobe.jp", "c.kobe.jp", "b.c.kobe.jp");
+
+        // a single wildcard
+        auto psl3 = public_suffix_list::compile("*");
+        check(psl3, "a.b.c", "c", "b.c");
+
+        // invalid rules
+        for (core::string_view s: {
+            "a..b", ".a", "a.", "!", "*.", "*a",
+            "a.*.b", "a*", "**" })
+        {
+            BOOST_TEST_THROWS(
+                public_suffix_list::compile(s),
+                system::system_error);
+        }
+        BOOST_TEST_THROWS(
+            public_suffix_list::compile(
+                std::string(256, 'a')),
+            system::system_error);
+        BOOST_TEST_NO_THROW(
+            public_suffix_list::compile(
+                std::string(255, 'a')));
+    }
+
+    void
+    testLoad()
+    {
+        auto const psl =
+            public_suffix_list::compile(rules);
+        std::string const bytes = psl.data();
+
+        // borrowed buffer
+        auto const psl2 = public_suffix_list::load(
+            bytes.data(), bytes.size());
+        BOOST_TEST_EQ(psl2.data().data(), bytes.data());
+        checkList(psl2);
+
+        // compiling is deterministic
+        BOOST_TEST_EQ(public_suffix_list::compile(
+            rules).data(), bytes);
+
+        // corrupted buffers
+        BOOST_TEST_THROWS(public_suffix_list::load(
+            bytes.data(), 0), system::system_error);
+        BOOST_TEST_THROWS(public_suffix_list::load(
+            bytes.data(), bytes.size() - 1),
+            system::system_error);
+        std::string bad = bytes;
+        bad[0] = 'X';
+        BOOST_TEST_THROWS(public_suffix_list::load(
+            bad.data(), bad.size()), system::system_error);
+        bad = bytes;
+        bad += 'x';
+        BOOST_TEST_THROWS(public_suffix_list::load(
+            bad.data(), bad.size()), system::system_error);
+        bad = bytes;
+        // first child of the root
+        bad[16 + 4] = '\0';
+        BOOST_TEST_THROWS(public_suffix_list::load(
+            bad.data(), bad.size()), system::system_error);
+        bad = bytes;
+        // label of the first child
+        bad[16 + 12 + 2] = '\x7f';
+        BOOST_TEST_THROWS(public_suffix_list::load(
+            bad.data(), bad.size()), system::system_error);
+    }
+
+    void
+    testSpecial()
+    {
+        // empty
+        {
+            public_suffix_list psl;
+            check(psl, "www.example.co.uk", "uk", "co.uk");
+            check(psl, "uk", "uk", "");
+            auto psl2 = public_suffix_list::load(
+                psl.data().data(), psl.data().size());
+            check(psl2, "www.example.co.uk", "uk", "co.uk");
+            BOOST_TEST_EQ(public_suffix_list::compile(
+                "").data(), psl.data());
+            BOOST_TEST_EQ(public_suffix_list::compile(
+                "// comment\n\n").data(), psl.data());
+        }
+
+        // copy and move
+        {
+            auto psl = public_suffix_list::compile(rules);
+            public_suffix_list psl2(psl);
+            BOOST_TEST_NE(psl2.data().data(), psl.data().data());
+            check(psl2, "a.b.co.uk", "co.uk", "b.co.uk");
+            public_suffix_list psl3(std::move(psl2));
+            check(psl3, "a.b.co.uk", "co.uk", "b.co.uk");
+            check(psl2, "a.b.co.uk", "uk", "co.uk");
+            psl2 = psl3;
+            check(psl2, "a.b.co.uk", "co.uk", "b.co.uk");
+            psl3 = std::move(psl);
+            check(psl3, "a.b.co.uk", "co.uk", "b.co.uk");
+            check(psl, "a.b.co.uk", "uk", "co.uk");
+
+            // copies of a borrowed buffer
+            // share the buffer
+            std::string const bytes = psl3.data();
+            auto psl4 = public_suffix_list::load(
+                bytes.data(), bytes.size());
+            public_suffix_list psl5(psl4);
+            BOOST_TEST_EQ(psl5.data().data(), bytes.data());
+        }
+
+        // urls
+        {
+            auto psl = public_suffix_list::compile(rules);
+            url_view u("https://user@www.Example.co.uk:8080/path");
+            BOOST_TEST_EQ(psl.public_suffix(u), "co.uk");
+            BOOST_TEST_EQ(psl.registrable_domain(u), "Example.co.uk");
+
+            // ip addresses have no suffix
+            u = url_view("http://192.168.0.1/");
+            BOOST_TEST_EQ(psl.public_suffix(u), "");
+            BOOST_TEST_EQ(psl.registrable_domain(u), "");
+            u = url_view("http://[::1]/");
+            BOOST_TEST_EQ(psl.public_suffix(u), "");
+            u = url_view("/path");
+            BOOST_TEST_EQ(psl.public_suffix(u), "");
+            BOOST_TEST_EQ(psl.registrable_domain(u), "");
+        }
+    }
+
+    void
+    run()
+    {
+        testCompile();
+        testLoad();
+        testSpecial();
+    }
+};
+
+TEST_SUITE(public_suffix_list_test, "boost.url.public_suffix_list");
+
+} // urls
+} // boost
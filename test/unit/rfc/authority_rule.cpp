@@ -10,10 +10,16 @@
 // Test that header file is self-contained.
 #include <boost/url/rfc/authority_rule.hpp>
 
+#include <boost/url/rfc/detail/host_rule.hpp>
+#include <boost/url/rfc/detail/reg_name_rule.hpp>
+#include <boost/url/rfc/ipv4_address_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
 
 #include "test_rule.hpp"
 
+#include <cstring>
+#include <random>
+#include <string>
 #include <type_traits>
 
 namespace boost {
@@ -22,6 +28,129 @@ namespace urls {
 class authority_rule_test
 {
 public:
+    // the host of s, found by trying
+    // IPv4address and then reg-name
+    static
+    system::result<detail::host_rule_t::value_type>
+    host_backtracking(
+        char const*& it,
+        char const* end)
+    {
+        detail::host_rule_t::value_type t;
+        auto const it0 = it;
+        auto rv = grammar::parse(
+            it, end, ipv4_address_rule);
+        if(rv)
+        {
+            auto const it02 = it;
+            auto rv2 = grammar::parse(
+                it, end, detail::reg_name_rule);
+            if(rv2 && ! rv2->empty())
+            {
+                t.name = make_pct_string_view_unsafe(
+                    it0, it - it0, (it02 - it0) +
+                        rv2->decoded_size());
+                t.host_type = host_type::name;
+                t.match = t.name;
+                return t;
+            }
+            it = it02;
+            auto const b = rv->to_bytes();
+            std::memcpy(t.addr, b.data(), 4);
+            t.host_type = host_type::ipv4;
+            t.match = make_pct_string_view_unsafe(
+                it0, it - it0, it - it0);
+            return t;
+        }
+        it = it0;
+        auto rv2 = grammar::parse(
+            it, end, detail::reg_name_rule);
+        if(! rv2)
+            return rv2.error();
+        t.name = *rv2;
+        t.host_type = host_type::name;
+        t.match = *rv2;
+        return t;
+    }
+
+    static
+    void
+    checkHost(core::string_view s)
+    {
+        char const* it0 = s.data();
+        char const* const end = it0 + s.size();
+        auto rv0 = host_backtracking(it0, end);
+        char const* it = s.data();
+        auto rv = detail::host_rule.parse(it, end);
+        if(! BOOST_TEST_EQ(
+                rv.has_value(), rv0.has_value()))
+        {
+            BOOST_TEST_EQ(s, "");
+            return;
+        }
+        BOOST_TEST_EQ(it - s.data(), it0 - s.data());
+        if(! rv)
+            return;
+        BOOST_TEST(rv->host_type == rv0->host_type);
+        BOOST_TEST_EQ(rv->match, rv0->match);
+        BOOST_TEST_EQ(rv->match.decoded_size(),
+            rv0->match.decoded_size());
+        BOOST_TEST_EQ(rv->name, rv0->name);
+        BOOST_TEST_EQ(rv->name.decoded_size(),
+            rv0->name.decoded_size());
+        BOOST_TEST(std::memcmp(rv->addr,
+            rv0->addr, sizeof(rv->addr)) == 0);
+    }
+
+    void
+    testHost()
+    {
+        for(core::string_view s : {
+            "", "1.2.3.4", "1.2.3.4.example",
+            "1.2.3.4:80", "1.2.3.4/x", "1.2.3.4%41",
+            "1.2.3.4%zz", "1.2.3.4a%zz", "1.2.3.4%",
+            "01.2.3.4", "1.2.3", "256.1.1.1",
+            "255.255.255.255", "255.255.255.255.",
+            "255.255.255.2555", "1.2.3.4.5.6.7.8",
+            "www.example.com", "%41.b", "a%zz", "%",
+            "1%2e2.3.4", "1.2.3.4-x", "1.2.3.4!",
+            "1.2.3.4[" })
+            checkHost(s);
+
+        char const alphabet[] = "0123456789...%%2Fz:/";
+        std::minstd_rand g(1);
+        for(int i = 0; i < 20000; ++i)
+        {
+            std::string s;
+            std::size_t const n = g() % 20;
+            for(std::size_t j = 0; j < n; ++j)
+                s.push_back(alphabet[
+                    g() % (sizeof(alphabet) - 1)]);
+            checkHost(s);
+        }
+
+        // the classification is visible
+        // through authority_rule
+        auto rv = grammar::parse(
+            "1.2.3.4:80", authority_rule);
+        if(BOOST_TEST(rv.has_value()))
+        {
+            BOOST_TEST(rv->host_type() ==
+                host_type::ipv4);
+            BOOST_TEST_EQ(rv->host_ipv4_address(),
+                ipv4_address(0x01020304));
+        }
+        rv = grammar::parse(
+            "1.2.3.4.example:80", authority_rule);
+        if(BOOST_TEST(rv.has_value()))
+        {
+            BOOST_TEST(rv->host_type() ==
+                host_type::name);
+            BOOST_TEST_EQ(rv->host_name(),
+                "1.2.3.4.example");
+        }
+    }
+
     void
     run()
     {
@@ -85,6 +214,8 @@ public:
                 BOOST_TEST_EQ(rv->port_number(), 0);
             }
         }
+
+        testHost();
     }
 };
 
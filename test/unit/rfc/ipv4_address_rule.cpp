@@ -10,13 +10,113 @@
 // Test that header file is self-contained.
 #include <boost/url/rfc/ipv4_address_rule.hpp>
 
+#include <boost/url/grammar/dec_octet_rule.hpp>
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+
 #include "test_rule.hpp"
 
+#include <random>
+#include <string>
+
 namespace boost {
 namespace urls {
 
 struct ipv4_address_rule_test
 {
+    // compare with a sequence of
+    // dec-octet separated by dots
+    static
+    void
+    check(core::string_view s)
+    {
+        using namespace grammar;
+        char const* it0 = s.data();
+        char const* const end = it0 + s.size();
+        auto rv0 = grammar::parse(
+            it0, end, tuple_rule(
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule));
+        char const* it = s.data();
+        auto rv = grammar::parse(
+            it, end, ipv4_address_rule);
+        if(! BOOST_TEST_EQ(
+                rv.has_value(), rv0.has_value()))
+        {
+            BOOST_TEST_EQ(s, "");
+            return;
+        }
+        if(! rv)
+        {
+            BOOST_TEST(rv.error() == rv0.error());
+            return;
+        }
+        BOOST_TEST_EQ(it - s.data(), it0 - s.data());
+        std::array<unsigned char, 4> const b =
+            rv->to_bytes();
+        BOOST_TEST_EQ(b[0], std::get<0>(*rv0));
+        BOOST_TEST_EQ(b[1], std::get<1>(*rv0));
+        BOOST_TEST_EQ(b[2], std::get<2>(*rv0));
+        BOOST_TEST_EQ(b[3], std::get<3>(*rv0));
+    }
+
+    void
+    testParse()
+    {
+        for(core::string_view s : {
+            "", "x", ".", "0", "1.2.3", "1.2.3.",
+            "0.0.0.0", "1.2.3.4", "255.255.255.255",
+            "256.0.0.0", "0.256.0.0", "0.0.256.0",
+            "0.0.0.256", "1.2.3.4.5", "1.2.3.4:80",
+            "01.2.3.4", "1.02.3.4", "1.2.003.4",
+            "1.2.3.04", "1.2.3.0", "1.2.3.4567",
+            "1000.2.3.4", "1..2.3", ".1.2.3.4",
+            "1.2.3.4/", "1.2.3.4a", "1.2.3.a",
+            "192.168.0.1", "192.168.100.200x",
+            "255.255.255.2555", "255.255.255.255.",
+            "255.255.255.255.255", "9.99.199.249",
+            "299.1.1.1", "1.2.3.-4", "1,2.3.4",
+            "1.2.3.4\x80" })
+            check(s);
+
+        // inputs near 16 bytes, which
+        // have garbage after them
+        std::string const buf =
+            "100.200.250.255.1.2.3.4.5.6.7.8";
+        for(std::size_t i = 0; i < buf.size(); ++i)
+            for(std::size_t n = 0; n <= buf.size() - i; ++n)
+                check(core::string_view(
+                    buf.data() + i, n));
+
+        // random inputs
+        char const alphabet[] = "0123456789...:a";
+        std::minstd_rand g(1);
+        for(int i = 0; i < 20000; ++i)
+        {
+            std::string s;
+            std::size_t const n = g() % 20;
+            for(std::size_t j = 0; j < n; ++j)
+                s.push_back(alphabet[
+                    g() % (sizeof(alphabet) - 1)]);
+            check(s);
+        }
+
+        // every octet
+        for(unsigned v = 0; v < 1000; ++v)
+        {
+            std::string const o = std::to_string(v);
+            check(o + ".1.2.3");
+            check("1." + o + ".2.3");
+            check("1.2." + o + ".3");
+            check("1.2.3." + o);
+            check("0" + o + ".1.2.3");
+            check("1.2.3.0" + o);
+        }
+    }
+
     void
     run()
     {
@@ -25,6 +125,8 @@ struct ipv4_address_rule_test
             system::result< ipv4_address > rv = grammar::parse( "192.168.0.1", ipv4_address_rule );
             (void)rv;
         }
+
+        testParse();
     }
 };
 
@@ -8,14 +8,13 @@
 //
 
 // Test that header file is self-contained.
-#ifndef BOOST_URL_SOURCE
-#define BOOST_URL_SOURCE
-#endif
-
-#include "router.hpp"
+#include <boost/url/router.hpp>
 
+#include <boost/url/rfc/ipv4_address_rule.hpp>
 #include "test_suite.hpp"
 
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 
 namespace boost {
@@ -260,10 +259,336 @@ struct router_test
         BOOST_TEST_THROWS(r.insert(pattern, 0), system::system_error);
     };
 
+    // find a route for a string
+    template <class T, std::size_t N>
+    static
+    T const*
+    find(
+        router<T> const& r,
+        core::string_view path,
+        matches_storage<N>& m)
+    {
+        return r.find(path, m);
+    }
+
+    static
+    void
+    testTable()
+    {
+        // many siblings at each level
+        router<int> r;
+        for (int i = 0; i < 1000; ++i)
+        {
+            std::string p = "/api/v" + std::to_string(i % 3);
+            p += "/r" + std::to_string(i);
+            r.insert(p, i);
+            r.insert(p + "/{id}", 1000 + i);
+            r.insert(p + "/{id}/items/{item?}", 2000 + i);
+        }
+        r.insert("/api/{version}/{*}", -1);
+        BOOST_TEST_EQ(r.size(), 3001u);
+
+        matches m;
+        for (int i = 0; i < 1000; ++i)
+        {
+            std::string p = "/api/v" + std::to_string(i % 3);
+            p += "/r" + std::to_string(i);
+            int const* v = find(r, p, m);
+            if (!BOOST_TEST(v))
+                continue;
+            BOOST_TEST_EQ(*v, i);
+            BOOST_TEST(m.empty());
+
+            std::string const p1 = p + "/42";
+            v = find(r, p1, m);
+            if (!BOOST_TEST(v))
+                continue;
+            BOOST_TEST_EQ(*v, 1000 + i);
+            BOOST_TEST_EQ(m["id"], "42");
+
+            std::string const p2 = p + "/42/items";
+            v = find(r, p2, m);
+            if (!BOOST_TEST(v))
+                continue;
+            BOOST_TEST_EQ(*v, 2000 + i);
+            BOOST_TEST_EQ(m.size(), 2u);
+            BOOST_TEST_EQ(m["item"], "");
+        }
+        {
+            int const* v = find(r, "/api/v1/nothing/here", m);
+            if (BOOST_TEST(v))
+            {
+                BOOST_TEST_EQ(*v, -1);
+                BOOST_TEST_EQ(m["version"], "v1");
+                BOOST_TEST_EQ(m[1], "nothing/here");
+            }
+        }
+        {
+            // escaped literal among many siblings
+            int const* v = find(r, "/api/v1/%72%31", m);
+            if (BOOST_TEST(v))
+                BOOST_TEST_EQ(*v, 1);
+            v = find(r, "/api/v2/r%35", m);
+            if (BOOST_TEST(v))
+                BOOST_TEST_EQ(*v, 5);
+        }
+        BOOST_TEST_NOT(find(r, "/other", m));
+        BOOST_TEST(m.empty());
+    }
+
+    static
+    void
+    testInsert()
+    {
+        // replace a resource
+        {
+            router<std::string> r;
+            r.insert("/a/{x}", "1");
+            r.insert("/b", "2");
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/a/z", m), "1");
+            r.insert("a/{y}", "3");
+            BOOST_TEST_EQ(r.size(), 2u);
+            BOOST_TEST_EQ(*find(r, "/a/z", m), "3");
+            BOOST_TEST_EQ(*find(r, "/b", m), "2");
+        }
+
+        // insert after find
+        {
+            router<int> r;
+            matches m;
+            BOOST_TEST_NOT(find(r, "/a", m));
+            BOOST_TEST_NOT(find(r, "", m));
+            r.insert("/a", 1);
+            BOOST_TEST_EQ(*find(r, "/a", m), 1);
+            r.insert("/a/b", 2);
+            BOOST_TEST_EQ(*find(r, "/a/b", m), 2);
+            BOOST_TEST_EQ(*find(r, "/a", m), 1);
+        }
+
+        // invalid routes leave the router unchanged
+        {
+            router<int> r;
+            r.insert("/a", 1);
+            BOOST_TEST_THROWS(
+                r.insert("/a/../..", 2),
+                system::system_error);
+            BOOST_TEST_EQ(r.size(), 1u);
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/a", m), 1);
+            BOOST_TEST_NOT(find(r, "/b", m));
+        }
+
+        // a throwing replacement leaves
+        // the routes in a valid state
+        {
+            struct resource
+            {
+                int n;
+
+                resource(int n_) : n(n_) {}
+                resource(resource const&) = default;
+
+                resource&
+                operator=(resource&& other)
+                {
+                    if (other.n < 0)
+                        throw std::runtime_error("");
+                    n = other.n;
+                    return *this;
+                }
+            };
+            router<resource> r;
+            r.insert("/a", 1);
+            r.insert("/b", 2);
+            BOOST_TEST_THROWS(
+                r.insert("/a", -1),
+                std::runtime_error);
+            BOOST_TEST_EQ(r.size(), 2u);
+            matches m;
+            BOOST_TEST_EQ(find(r, "/a", m)->n, 1);
+            BOOST_TEST_EQ(find(r, "/b", m)->n, 2);
+            r.insert("/a", 3);
+            BOOST_TEST_EQ(r.size(), 2u);
+            BOOST_TEST_EQ(find(r, "/a", m)->n, 3);
+        }
+
+        // moves
+        {
+            router<int> r0;
+            r0.insert("/a/{x}", 1);
+            router<int> r1(std::move(r0));
+            matches m;
+            BOOST_TEST_EQ(*find(r1, "/a/b", m), 1);
+            r0 = std::move(r1);
+            BOOST_TEST_EQ(*find(r0, "/a/b", m), 1);
+            BOOST_TEST_EQ(m["x"], "b");
+            r1.insert("/c", 2);
+            BOOST_TEST_EQ(*find(r1, "/c", m), 2);
+        }
+
+        // custom capacity
+        {
+            router<int> r;
+            r.insert("/{a}/{b}/{c}", 1);
+            matches_storage<3> m;
+            BOOST_TEST_EQ(*find(r, "/x/y/z", m), 1);
+            BOOST_TEST_EQ(m.size(), 3u);
+            BOOST_TEST_EQ(m.capacity(), 3u);
+            BOOST_TEST_EQ(m["c"], "z");
+        }
+    }
+
+    static
+    void
+    testRules()
+    {
+        // uint64
+        {
+            router<int> r;
+            r.insert("/users/{name}", 1);
+            r.insert("/users/{id:uint64}", 2);
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/users/42", m), 2);
+            BOOST_TEST_EQ(m["id"], "42");
+            BOOST_TEST_EQ(m.integer("id"), 42u);
+            BOOST_TEST_EQ(m.integer(0), 42u);
+            BOOST_TEST_EQ(*find(r, "/users/%34%32", m), 2);
+            BOOST_TEST_EQ(m.integer("id"), 42u);
+            BOOST_TEST_EQ(*find(r, "/users/18446744073709551615", m), 2);
+            BOOST_TEST_EQ(m.integer("id"), 18446744073709551615u);
+            BOOST_TEST_EQ(*find(r, "/users/18446744073709551616", m), 1);
+            BOOST_TEST_EQ(m.integer("name"), 0u);
+            BOOST_TEST_EQ(*find(r, "/users/042", m), 1);
+            BOOST_TEST_EQ(*find(r, "/users/john", m), 1);
+            BOOST_TEST_EQ(m["name"], "john");
+            BOOST_TEST_THROWS(m.integer("id"), std::out_of_range);
+            BOOST_TEST_THROWS(m.integer(1), std::out_of_range);
+        }
+
+        // containers without values
+        {
+            struct strings_only
+                : matches_base
+            {
+                core::string_view m_[1] = { "42" };
+                core::string_view i_[1] = { "id" };
+
+                core::string_view const* matches() const override { return m_; }
+                core::string_view const* ids() const override { return i_; }
+                core::string_view* matches() override { return m_; }
+                core::string_view* ids() override { return i_; }
+                std::size_t size() const override { return 1; }
+                std::size_t capacity() const override { return 1; }
+                void resize(std::size_t) override {}
+            };
+            strings_only m;
+            BOOST_TEST_EQ(m["id"], "42");
+            BOOST_TEST(m.values() == nullptr);
+            BOOST_TEST_THROWS(m.integer("id"), std::out_of_range);
+            BOOST_TEST_THROWS(m.integer(0), std::out_of_range);
+        }
+
+        // a mismatched rule prunes the branch
+        {
+            router<int> r;
+            r.insert("/a/{x:digits}/b", 1);
+            r.insert("/a/{y}/c", 2);
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/a/12/b", m), 1);
+            BOOST_TEST_EQ(*find(r, "/a/12/c", m), 2);
+            BOOST_TEST_EQ(m["y"], "12");
+            BOOST_TEST_EQ(*find(r, "/a/x/c", m), 2);
+            BOOST_TEST(!find(r, "/a/x/b", m));
+            BOOST_TEST(!find(r, "/a//b", m));
+        }
+
+        // character classes
+        {
+            router<int> r;
+            r.insert("/alpha/{x:alpha}", 1);
+            r.insert("/alnum/{x:alnum}", 2);
+            r.insert("/hex/{x:hex}", 3);
+            r.insert("/uuid/{x:uuid}", 4);
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/alpha/abcXYZ", m), 1);
+            BOOST_TEST(!find(r, "/alpha/abc1", m));
+            BOOST_TEST_EQ(*find(r, "/alnum/abc1", m), 2);
+            BOOST_TEST(!find(r, "/alnum/abc-1", m));
+            BOOST_TEST_EQ(*find(r, "/hex/00ffAB", m), 3);
+            BOOST_TEST(!find(r, "/hex/0x1", m));
+            BOOST_TEST_EQ(*find(r, "/uuid/f81d4fae-7dec-11d0-a765-00a0c91e6bf6", m), 4);
+            BOOST_TEST_EQ(*find(r, "/uuid/F81D4FAE-7DEC-11D0-A765-00A0C91E6BF%36", m), 4);
+            BOOST_TEST(!find(r, "/uuid/f81d4fae-7dec-11d0-a765-00a0c91e6bf", m));
+            BOOST_TEST(!find(r, "/uuid/f81d4fae-7dec-11d0-a765x00a0c91e6bf6", m));
+            BOOST_TEST(!find(r, "/uuid/g81d4fae-7dec-11d0-a765-00a0c91e6bf6", m));
+        }
+
+        // optional fields
+        {
+            router<int> r;
+            r.insert("/p/{n:uint64?}", 1);
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/p", m), 1);
+            BOOST_TEST_EQ(m["n"], "");
+            BOOST_TEST_EQ(m.integer("n"), 0u);
+            BOOST_TEST_EQ(*find(r, "/p/5", m), 1);
+            BOOST_TEST_EQ(m.integer("n"), 5u);
+            BOOST_TEST(!find(r, "/p/x", m));
+        }
+
+        // custom rules
+        {
+            router<int> r;
+            r.add_rule("ipv4", ipv4_address_rule);
+            r.insert("/hosts/{host:ipv4}", 1);
+            r.insert("/hosts/{name}", 2);
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/hosts/127.0.0.1", m), 1);
+            BOOST_TEST_EQ(m["host"], "127.0.0.1");
+            BOOST_TEST_EQ(*find(r, "/hosts/127.0.0", m), 2);
+            BOOST_TEST_THROWS(r.add_rule("ipv4", ipv4_address_rule), system::system_error);
+            BOOST_TEST_THROWS(r.add_rule("uint64", ipv4_address_rule), system::system_error);
+            BOOST_TEST_THROWS(r.add_rule("", ipv4_address_rule), system::system_error);
+            BOOST_TEST_THROWS(r.add_rule("a b", ipv4_address_rule), system::system_error);
+            r.add_rule("ip-v4_2", ipv4_address_rule);
+        }
+
+        // invalid rules
+        {
+            router<int> r;
+            BOOST_TEST_THROWS(r.insert("/a/{x:unknown}", 1), system::system_error);
+            BOOST_TEST_THROWS(r.insert("/a/{x:digits*}", 1), system::system_error);
+            BOOST_TEST_THROWS(r.insert("/a/{x:digits+}", 1), system::system_error);
+            BOOST_TEST_EQ(r.size(), 0u);
+            matches m;
+            BOOST_TEST(!find(r, "/a/1", m));
+        }
+
+        // the same field with other rules
+        // is another node
+        {
+            router<int> r;
+            r.insert("/v/{x:digits}/a", 1);
+            r.insert("/v/{x:alpha}/a", 2);
+            r.insert("/v/{x}/a", 3);
+            r.insert("/v/{x:digits}/b", 4);
+            matches m;
+            BOOST_TEST_EQ(*find(r, "/v/1/a", m), 1);
+            BOOST_TEST_EQ(*find(r, "/v/x/a", m), 2);
+            BOOST_TEST_EQ(*find(r, "/v/-/a", m), 3);
+            BOOST_TEST_EQ(*find(r, "/v/1/b", m), 4);
+            BOOST_TEST(!find(r, "/v/x/b", m));
+        }
+    }
+
     void
     run()
     {
         testPatterns();
+        testTable();
+        testInsert();
+        testRules();
     }
 };
 
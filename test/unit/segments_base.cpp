@@ -107,6 +107,23 @@ struct segments_base_test
             }
             while(it0 != begin);
         }
+        // decoded
+        {
+            auto const r = ps.decoded();
+            BOOST_TEST_EQ(r.size(), match.size());
+            BOOST_TEST_EQ(r.empty(), match.size() == 0);
+            auto it0 = r.begin();
+            auto it1 = match.begin();
+            for(; it0 != r.end(); ++it0, ++it1)
+            {
+                decode_view const v = *it0;
+                BOOST_TEST_EQ(v, *it1);
+                BOOST_TEST_EQ(v.size(), it1->size());
+            }
+            BOOST_TEST(it1 == match.end());
+            while(it0 != r.begin())
+                BOOST_TEST_EQ(*--it0, *--it1);
+        }
         // ostream
         {
             std::stringstream ss;
@@ -232,6 +249,34 @@ struct segments_base_test
         check( "fast//",  { "fast", "", "" });
     }
 
+    void
+    testDecoded()
+    {
+        // escapes are decoded on the fly
+        {
+            url_view u("/a%2Fb/c%20d/");
+            auto const r = u.segments().decoded();
+            auto it = r.begin();
+            BOOST_TEST_EQ(*it, "a/b");
+            BOOST_TEST_EQ(*++it, "c d");
+            BOOST_TEST_EQ(*++it, "");
+            BOOST_TEST(++it == r.end());
+        }
+
+        // plus is not a space
+        {
+            url_view u("/a+b");
+            BOOST_TEST_EQ(*u.segments().decoded().begin(), "a+b");
+        }
+
+        // default constructed
+        {
+            segments_base::decoded_range r;
+            BOOST_TEST(r.empty());
+            BOOST_TEST(r.begin() == r.end());
+        }
+    }
+
     void
     testJavadoc()
     {
@@ -296,6 +341,7 @@ struct segments_base_test
     {
         testObservers();
         testRange();
+        testDecoded();
         testFrontBackNonEmpty();
         testJavadoc();
     }
@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/segments_encoded_array.hpp>
+
+#include <boost/url/parse.hpp>
+#include <boost/url/parse_path.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/core/detail/static_assert.hpp>
+
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace boost {
+namespace urls {
+
+BOOST_CORE_STATIC_ASSERT(
+    std::is_same<
+        std::iterator_traits<
+            segments_encoded_array::iterator>::iterator_category,
+        std::random_access_iterator_tag>::value);
+
+struct segments_encoded_array_test
+{
+    // the array must agree with
+    // iteration of the view
+    static
+    void
+    check(core::string_view s)
+    {
+        auto rv = parse_uri_reference(s);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        segments_encoded_view ps =
+            rv->encoded_segments();
+        segments_encoded_array sa(ps);
+        BOOST_TEST_EQ(sa.size(), ps.size());
+        BOOST_TEST_EQ(sa.empty(), ps.empty());
+        BOOST_TEST_EQ(sa.buffer(), ps.buffer());
+        BOOST_TEST_EQ(
+            static_cast<std::size_t>(
+                sa.end() - sa.begin()), ps.size());
+        std::size_t i = 0;
+        for(auto it = ps.begin();
+            it != ps.end(); ++it, ++i)
+        {
+            BOOST_TEST_EQ(sa[i], *it);
+            BOOST_TEST_EQ(sa[i].data(), (*it).data());
+            BOOST_TEST_EQ(
+                sa[i].decoded_size(),
+                (*it).decoded_size());
+            BOOST_TEST_EQ(sa.begin()[i], *it);
+        }
+        if(! sa.empty())
+        {
+            BOOST_TEST_EQ(sa.front(), ps.front());
+            BOOST_TEST_EQ(sa.back(), ps.back());
+        }
+    }
+
+    void
+    testMembers()
+    {
+        // segments_encoded_array()
+        {
+            segments_encoded_array sa;
+            BOOST_TEST(sa.empty());
+            BOOST_TEST_EQ(sa.size(), 0u);
+            BOOST_TEST(sa.begin() == sa.end());
+        }
+
+        // operator[], front, back
+        {
+            url_view u("/api/v1/users/42/posts");
+            segments_encoded_array sa(u.encoded_segments());
+            BOOST_TEST_EQ(sa.size(), 5u);
+            BOOST_TEST_EQ(sa[0], "api");
+            BOOST_TEST_EQ(sa[3], "42");
+            BOOST_TEST_EQ(sa.front(), "api");
+            BOOST_TEST_EQ(sa.back(), "posts");
+            BOOST_TEST_EQ(*(sa.end() - 1), "posts");
+        }
+
+        // escapes are kept
+        {
+            url_view u("/a%20b/%2F");
+            segments_encoded_array sa(u.encoded_segments());
+            BOOST_TEST_EQ(sa[0], "a%20b");
+            BOOST_TEST_EQ(sa[0].decoded_size(), 3u);
+            BOOST_TEST_EQ(sa[1].decode(), "/");
+        }
+
+        // random access iteration
+        {
+            url_view u("/c/a/d/b");
+            segments_encoded_array sa(u.encoded_segments());
+            auto it = sa.begin();
+            it += 3;
+            BOOST_TEST_EQ(*it, "b");
+            it -= 2;
+            BOOST_TEST_EQ(*it, "a");
+            BOOST_TEST_EQ(it[2], "b");
+            BOOST_TEST_EQ(it->size(), 1u);
+            BOOST_TEST(sa.begin() < it);
+            BOOST_TEST(it <= it);
+            BOOST_TEST(sa.end() > it);
+            BOOST_TEST_EQ(sa.end() - it, 3);
+            BOOST_TEST_EQ(*(2 + sa.begin()), "d");
+            BOOST_TEST_EQ(*--sa.end(), "b");
+            BOOST_TEST(std::is_sorted(
+                sa.begin(), sa.begin() + 2) == false);
+            auto const n = std::count_if(
+                sa.begin(), sa.end(),
+                [](pct_string_view s)
+                {
+                    return s < "c";
+                });
+            BOOST_TEST_EQ(n, 2);
+        }
+
+        // from parse_path
+        {
+            auto rv = parse_path("x/y/z");
+            if(BOOST_TEST(rv.has_value()))
+            {
+                segments_encoded_array sa(*rv);
+                BOOST_TEST_EQ(sa.size(), 3u);
+                BOOST_TEST_EQ(sa[1], "y");
+                BOOST_TEST_EQ(sa.view().buffer(), "x/y/z");
+            }
+        }
+    }
+
+    void
+    testEquivalence()
+    {
+        check("");
+        check("/");
+        check("./");
+        check(".//");
+        check("/./");
+        check("/.//");
+        check("%2E/");
+        check("./usr");
+        check("/index.htm");
+        check("/images/cat-pic.gif");
+        check("images/cat-pic.gif");
+        check("/fast//query");
+        check("fast//");
+        check("http://h/a/%2F/b?q#f");
+        check("http://h");
+        check("x:a:b/c");
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testEquivalence();
+    }
+};
+
+TEST_SUITE(
+    segments_encoded_array_test,
+    "boost.url.segments_encoded_array");
+
+} // urls
+} // boost
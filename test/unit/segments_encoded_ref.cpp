@@ -761,6 +761,51 @@ struct segments_encoded_ref_test
             check(f, "x://y/.///",  "/.//",  {"", ""});
         }
 
+        //
+        // remove_if
+        //
+        {
+            auto const f = [](segments_encoded_ref ps)
+            {
+                ps.remove_if(
+                    [](pct_string_view s)
+                    {
+                        return s == "." || s == "%2E";
+                    });
+            };
+            check(f, "", "", {});
+            check(f, "/a/./b/%2E", "/a/b", {"a", "b"});
+            check(f, "/./.", "/", {});
+            check(f, "x/./y:z", "x/y:z", {"x", "y:z"});
+        }
+        {
+            auto const f = [](segments_encoded_ref ps)
+            {
+                ps.remove_if(
+                    [](pct_string_view s)
+                    {
+                        return s.decoded_size() == 2;
+                    });
+            };
+            check(f, "%41%42/a:b/c", "./a:b/c", {"a:b", "c"});
+            check(f, "/ab/cd//e", "/.//e", {"", "e"});
+        }
+
+        //
+        // retain
+        //
+        {
+            auto const f = [](segments_encoded_ref ps)
+            {
+                ps.retain(
+                    [](pct_string_view s)
+                    {
+                        return s.decode() != "x";
+                    });
+            };
+            check(f, "/x/%78/a/x", "/a", {"a"});
+            check(f, "/a/b", "/a/b", {"a", "b"});
+        }
     }
 
     void
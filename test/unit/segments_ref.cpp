@@ -18,6 +18,9 @@
 
 #include "test_suite.hpp"
 
+#include <stdexcept>
+#include <string>
+
 #ifdef assert
 #undef assert
 #endif
@@ -795,6 +798,102 @@ struct segments_ref_test
             check(f, "x://y/.//",  "/./",  {""});
             check(f, "x://y/.///",  "/.//",  {"", ""});
         }
+
+        //
+        // remove_if
+        //
+        {
+            auto const f = [](segments_ref ps)
+            {
+                ps.remove_if(
+                    [](decode_view s)
+                    {
+                        return s == ".";
+                    });
+            };
+            check(f, "", "", {});
+            check(f, "/", "/", {});
+            check(f, "/a/./b/c", "/a/b/c", {"a", "b", "c"});
+            check(f, "/a/b/./.", "/a/b", {"a", "b"});
+            check(f, "./a/%2E/b", "./a/b", {"a", "b"});
+            check(f, "/./.", "/", {});
+            check(f, "./.", "", {});
+        }
+        {
+            auto const f = [](segments_ref ps)
+            {
+                auto n = ps.remove_if(
+                    [](decode_view s)
+                    {
+                        return s == "x";
+                    });
+                BOOST_TEST_EQ(n, 1u);
+            };
+            check(f, "/x/a/b", "/a/b", {"a", "b"});
+            check(f, "x/a:b/c", "./a:b/c", {"a:b", "c"});
+            check(f, "/x//b", "/.//b", {"", "b"});
+            check(f, "x//b", ".//b", {"", "b"});
+            check(f, "/a/x/b%20c", "/a/b%20c", {"a", "b c"});
+        }
+        {
+            url u("http://h/a/b/c?q#f");
+            BOOST_TEST_EQ(u.segments().remove_if(
+                [](decode_view) { return true; }), 3u);
+            BOOST_TEST_EQ(u.buffer(), "http://h?q#f");
+            BOOST_TEST(u.segments().empty());
+        }
+
+        //
+        // retain
+        //
+        {
+            auto const f = [](segments_ref ps)
+            {
+                ps.retain(
+                    [](decode_view s)
+                    {
+                        return ! s.empty();
+                    });
+            };
+            check(f, "/a//b/", "/a/b", {"a", "b"});
+            check(f, "//h//a", "/a", {"a"});
+        }
+
+        //
+        // exceptions thrown by the
+        // predicate leave the path intact
+        //
+        {
+            url u("http://h/x/a/x/b?q");
+            std::size_t n = 0;
+            BOOST_TEST_THROWS(u.segments().remove_if(
+                [&n](decode_view s)
+                {
+                    if(++n == 4)
+                        throw std::runtime_error("");
+                    return s == "x";
+                }), std::runtime_error);
+            BOOST_TEST_EQ(u.buffer(), "http://h/x/a/x/b?q");
+            BOOST_TEST_EQ(u.segments().size(), 4u);
+        }
+
+        // more segments than fit in
+        // the results without allocating
+        {
+            std::string s;
+            std::string r;
+            for(int i = 0; i < 600; ++i)
+            {
+                s += i % 3 ? "/k" : "/x";
+                if(i % 3)
+                    r += "/k";
+            }
+            url u(s);
+            BOOST_TEST_EQ(u.segments().remove_if(
+                [](decode_view v) { return v == "x"; }), 200u);
+            BOOST_TEST_EQ(u.encoded_path(), r);
+            BOOST_TEST_EQ(u.segments().size(), 400u);
+        }
     }
 
     static
@@ -0,0 +1,369 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/uri_template.hpp>
+
+#include <boost/url/static_url.hpp>
+
+#include "test_suite.hpp"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+struct uri_template_test
+{
+    // the variables of the examples
+    // in rfc6570 section 3.2
+    std::vector<std::string> list =
+        { "red", "green", "blue" };
+    std::vector<std::string> dom =
+        { "example", "com" };
+    std::vector<std::pair<std::string, std::string>> keys =
+        { { "semi", ";" }, { "dot", "." }, { "comma", "," } };
+    std::vector<std::string> empty_list;
+    std::map<std::string, std::string> empty_keys;
+
+    std::string
+    expand(core::string_view s)
+    {
+        uri_template const t(s);
+        BOOST_TEST_EQ(t.str(), s);
+        return t.expand({
+            { "count", { "one", "two", "three" } },
+            { "dom", dom },
+            { "dub", "me/too" },
+            { "hello", "Hello World!" },
+            { "half", "50%" },
+            { "var", "value" },
+            { "who", "fred" },
+            { "base", "http://example.com/home/" },
+            { "path", "/foo/bar" },
+            { "list", list },
+            { "keys", keys },
+            { "v", 6 },
+            { "x", 1024 },
+            { "y", "768" },
+            { "empty", "" },
+            { "empty_list", empty_list },
+            { "empty_keys", empty_keys },
+            { "undef", {} } },
+            string_token::return_string{});
+    }
+
+    void
+    check(
+        core::string_view s,
+        core::string_view expect)
+    {
+        BOOST_TEST_EQ(expand(s), expect);
+    }
+
+    void
+    testLevels()
+    {
+        // level 1
+        check("{var}", "value");
+        check("{hello}", "Hello%20World%21");
+
+        // level 2
+        check("{+var}", "value");
+        check("{+hello}", "Hello%20World!");
+        check("{+path}/here", "/foo/bar/here");
+        check("here?ref={+path}", "here?ref=/foo/bar");
+        check("X{#var}", "X#value");
+        check("X{#hello}", "X#Hello%20World!");
+
+        // level 3
+        check("map?{x,y}", "map?1024,768");
+        check("{x,hello,y}", "1024,Hello%20World%21,768");
+        check("{+x,hello,y}", "1024,Hello%20World!,768");
+        check("{+path,x}/here", "/foo/bar,1024/here");
+        check("{#x,hello,y}", "#1024,Hello%20World!,768");
+        check("{#path,x}/here", "#/foo/bar,1024/here");
+        check("X{.var}", "X.value");
+        check("X{.x,y}", "X.1024.768");
+        check("{/var}", "/value");
+        check("{/var,x}/here", "/value/1024/here");
+        check("{;x,y}", ";x=1024;y=768");
+        check("{;x,y,empty}", ";x=1024;y=768;empty");
+        check("{?x,y}", "?x=1024&y=768");
+        check("{?x,y,empty}", "?x=1024&y=768&empty=");
+        check("?fixed=yes{&x}", "?fixed=yes&x=1024");
+        check("{&x,y,empty}", "&x=1024&y=768&empty=");
+
+        // level 4
+        check("{var:3}", "val");
+        check("{var:30}", "value");
+        check("{list}", "red,green,blue");
+        check("{list*}", "red,green,blue");
+        check("{keys}", "semi,%3B,dot,.,comma,%2C");
+        check("{keys*}", "semi=%3B,dot=.,comma=%2C");
+        check("{+path:6}/here", "/foo/b/here");
+        check("{+list}", "red,green,blue");
+        check("{+list*}", "red,green,blue");
+        check("{+keys}", "semi,;,dot,.,comma,,");
+        check("{+keys*}", "semi=;,dot=.,comma=,");
+        check("{#path:6}/here", "#/foo/b/here");
+        check("{#list}", "#red,green,blue");
+        check("{#list*}", "#red,green,blue");
+        check("{#keys}", "#semi,;,dot,.,comma,,");
+        check("{#keys*}", "#semi=;,dot=.,comma=,");
+        check("X{.var:3}", "X.val");
+        check("X{.list}", "X.red,green,blue");
+        check("X{.list*}", "X.red.green.blue");
+        check("X{.keys}", "X.semi,%3B,dot,.,comma,%2C");
+        check("X{.keys*}", "X.semi=%3B.dot=..comma=%2C");
+        check("{/var:1,var}", "/v/value");
+        check("{/list}", "/red,green,blue");
+        check("{/list*}", "/red/green/blue");
+        check("{/list*,path:4}", "/red/green/blue/%2Ffoo");
+        check("{/keys}", "/semi,%3B,dot,.,comma,%2C");
+        check("{/keys*}", "/semi=%3B/dot=./comma=%2C");
+        check("{;hello:5}", ";hello=Hello");
+        check("{;list}", ";list=red,green,blue");
+        check("{;list*}", ";list=red;list=green;list=blue");
+        check("{;keys}", ";keys=semi,%3B,dot,.,comma,%2C");
+        check("{;keys*}", ";semi=%3B;dot=.;comma=%2C");
+        check("{?var:3}", "?var=val");
+        check("{?list}", "?list=red,green,blue");
+        check("{?list*}", "?list=red&list=green&list=blue");
+        check("{?keys}", "?keys=semi,%3B,dot,.,comma,%2C");
+        check("{?keys*}", "?semi=%3B&dot=.&comma=%2C");
+        check("{&var:3}", "&var=val");
+        check("{&list}", "&list=red,green,blue");
+        check("{&list*}", "&list=red&list=green&list=blue");
+        check("{&keys}", "&keys=semi,%3B,dot,.,comma,%2C");
+        check("{&keys*}", "&semi=%3B&dot=.&comma=%2C");
+    }
+
+    void
+    testOperators()
+    {
+        // rfc6570 3.2.2 - 3.2.9
+        check("{count}", "one,two,three");
+        check("{count*}", "one,two,three");
+        check("{/count}", "/one,two,three");
+        check("{/count*}", "/one/two/three");
+        check("{;count}", ";count=one,two,three");
+        check("{;count*}", ";count=one;count=two;count=three");
+        check("{?count}", "?count=one,two,three");
+        check("{?count*}", "?count=one&count=two&count=three");
+        check("{&count*}", "&count=one&count=two&count=three");
+        check("{half}", "50%25");
+        check("O{empty}X", "OX");
+        check("O{undef}X", "OX");
+        check("?{x,empty}", "?1024,");
+        check("?{x,undef}", "?1024");
+        check("?{undef,y}", "?768");
+        check("{+half}", "50%25");
+        check("{base}index", "http%3A%2F%2Fexample.com%2Fhome%2Findex");
+        check("{+base}index", "http://example.com/home/index");
+        check("O{+empty}X", "OX");
+        check("O{+undef}X", "OX");
+        check("up{+path}{var}/here", "up/foo/barvalue/here");
+        check("{#half}", "#50%25");
+        check("foo{#empty}", "foo#");
+        check("foo{#undef}", "foo");
+        check("{.who}", ".fred");
+        check("{.who,who}", ".fred.fred");
+        check("{.half,who}", ".50%25.fred");
+        check("www{.dom*}", "www.example.com");
+        check("X{.empty}", "X.");
+        check("X{.undef}", "X");
+        check("X{.empty_keys}", "X");
+        check("X{.empty_keys*}", "X");
+        check("X{.empty_list}", "X");
+        check("{/who}", "/fred");
+        check("{/who,who}", "/fred/fred");
+        check("{/half,who}", "/50%25/fred");
+        check("{/who,dub}", "/fred/me%2Ftoo");
+        check("{/var,empty}", "/value/");
+        check("{/var,undef}", "/value");
+        check("{;who}", ";who=fred");
+        check("{;half}", ";half=50%25");
+        check("{;empty}", ";empty");
+        check("{;v,empty,who}", ";v=6;empty;who=fred");
+        check("{;v,bar,who}", ";v=6;who=fred");
+        check("{;x,y,undef}", ";x=1024;y=768");
+        check("{?who}", "?who=fred");
+        check("{?half}", "?half=50%25");
+        check("{?x,y,undef}", "?x=1024&y=768");
+        check("{&who}", "&who=fred");
+        check("{&half}", "&half=50%25");
+    }
+
+    void
+    testLiterals()
+    {
+        check("", "");
+        check("http://example.com/a/b", "http://example.com/a/b");
+        check("/a%20b/{var}", "/a%20b/value");
+        check("/%C3%A9", "/%C3%A9");
+        check("/\xc3\xa9/{var}", "/%C3%A9/value");
+        check("/[]@!$&()*+,;=:/?#", "/[]@!$&()*+,;=:/?#");
+
+        // prefixes count characters
+        {
+            uri_template const t("{var:2}");
+            BOOST_TEST_EQ(t.expand(
+                { { "var", "\xc3\xa9\xc3\xa9\xc3\xa9" } },
+                string_token::return_string{}),
+                "%C3%A9%C3%A9");
+        }
+        // values with escapes
+        {
+            uri_template const t("{+a}/{b}");
+            BOOST_TEST_EQ(t.expand(
+                { { "a", "%20%zz" }, { "b", "%20" } },
+                string_token::return_string{}),
+                "%20%25zz/%2520");
+        }
+        // integers
+        {
+            uri_template const t("{a},{b},{c},{d}");
+            BOOST_TEST_EQ(t.expand({
+                { "a", 0 },
+                { "b", -12 },
+                { "c", static_cast<long long>(-9223372036854775807LL - 1) },
+                { "d", static_cast<unsigned long long>(-1) } },
+                string_token::return_string{}),
+                "0,-12,-9223372036854775808,18446744073709551615");
+        }
+        // names with dots and escapes
+        {
+            uri_template const t("{a.b}{%41}");
+            BOOST_TEST_EQ(t.expand(
+                { { "a.b", "x" }, { "%41", "y" } },
+                string_token::return_string{}),
+                "xy");
+        }
+    }
+
+    void
+    testInvalid()
+    {
+        auto const bad = [](core::string_view s)
+        {
+            BOOST_TEST(parse_uri_template(s).has_error());
+            BOOST_TEST_THROWS(
+                uri_template{s},
+                system::system_error);
+        };
+        bad("{");
+        bad("{}");
+        bad("{x");
+        bad("{x,");
+        bad("{x,}");
+        bad("{,x}");
+        bad("{=x}");
+        bad("{!x}");
+        bad("{|x}");
+        bad("{@x}");
+        bad("{x y}");
+        bad("{x-y}");
+        bad("{x.}");
+        bad("{.}");
+        bad("{x..y}");
+        bad("{x:}");
+        bad("{x:0}");
+        bad("{x:10000}");
+        bad("{x*3}");
+        bad("{x%2}");
+        bad("a}b");
+        bad("a b");
+        bad("a<b");
+        bad("a\"b");
+        bad("a|b");
+        bad("a^b");
+        bad("%");
+        bad("%zz");
+
+        BOOST_TEST(! parse_uri_template("{x:9999}").has_error());
+        BOOST_TEST(! parse_uri_template("{x*,y:1}").has_error());
+        BOOST_TEST(! parse_uri_template("{_0.A%20}").has_error());
+    }
+
+    void
+    testUrl()
+    {
+        uri_template const t(
+            "https://api.example.com{/path*}{?q,page}");
+        std::vector<std::string> path = { "search", "repos" };
+        {
+            url u = t.expand({
+                { "path", path },
+                { "q", "a b" },
+                { "page", 2 } });
+            BOOST_TEST_EQ(u.buffer(),
+                "https://api.example.com/search/repos?q=a%20b&page=2");
+            BOOST_TEST_EQ(u.encoded_host(), "api.example.com");
+            BOOST_TEST_EQ(u.segments().size(), 2u);
+            BOOST_TEST_EQ(u.params().size(), 2u);
+        }
+        {
+            // reused destination
+            static_url<128> u;
+            for(int i = 0; i < 10; ++i)
+            {
+                t.expand_to(u, {
+                    { "path", { "a", "b", "c" } },
+                    { "page", i } });
+            }
+            BOOST_TEST_EQ(u.buffer(),
+                "https://api.example.com/a/b/c?page=9");
+            BOOST_TEST_EQ(u.segments().size(), 3u);
+        }
+        {
+            // arguments from the destination
+            url u("https://www.example.com/x/y");
+            uri_template const t2("{+base}/z");
+            t2.expand_to(u, { { "base", u.buffer() } });
+            BOOST_TEST_EQ(u.buffer(),
+                "https://www.example.com/x/y/z");
+        }
+        {
+            // invalid results throw
+            uri_template const t2("{+x}");
+            url u("http://a/");
+            BOOST_TEST_THROWS(
+                t2.expand_to(u, { { "x", "http://[" } }),
+                system::system_error);
+            BOOST_TEST_EQ(u.buffer(), "http://a/");
+        }
+        {
+            // default constructed
+            uri_template const t2;
+            BOOST_TEST(t2.str().empty());
+            BOOST_TEST(t2.expand({}).empty());
+        }
+    }
+
+    void
+    run()
+    {
+        testLevels();
+        testOperators();
+        testLiterals();
+        testInvalid();
+        testUrl();
+    }
+};
+
+TEST_SUITE(
+    uri_template_test,
+    "boost.url.uri_template");
+
+} // urls
+} // boost
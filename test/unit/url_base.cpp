@@ -11,6 +11,7 @@
 #include <boost/url/url_base.hpp>
 
 #include <boost/url/decode_view.hpp>
+#include <boost/url/static_url.hpp>
 #include <boost/url/url.hpp>
 #include "test_suite.hpp"
 
@@ -1586,6 +1587,63 @@ struct url_base_test
             }
         }
 
+        // sort_params
+        {
+            auto const sort = [](url_base& u)
+            {
+                u.sort_params();
+            };
+            auto const sort_ic = [](url_base& u)
+            {
+                u.sort_params(ignore_case);
+            };
+            modify("", "", sort);
+            modify("?", "?", sort);
+            modify("?b", "?b", sort);
+            modify("?a=1&b=2", "?a=1&b=2", sort);
+            modify("?b=2&a=1", "?a=1&b=2", sort);
+            modify("http://h/p?c=3&b=2&a=1#f", "http://h/p?a=1&b=2&c=3#f", sort);
+            // stable among equal keys
+            modify("?b=1&a=1&b=0&a=0", "?a=1&a=0&b=1&b=0", sort);
+            // empty keys and no values
+            modify("?b&&a=&", "?&&a=&b", sort);
+            // decoded comparison, encoding kept
+            modify("?%62=1&a%20=2&a=3", "?a=3&a%20=2&%62=1", sort);
+            modify("?b=1&B=2&a=3&A=4", "?A=4&B=2&a=3&b=1", sort);
+            modify("?b=1&B=2&a=3&A=4", "?a=3&A=4&b=1&B=2", sort_ic);
+            modify("?ab=1&B=2&a=3", "?a=3&ab=1&B=2", sort_ic);
+        }
+        {
+            // decoding options
+            url u("?a+=1&a%21=2");
+            encoding_opts opt;
+            opt.space_as_plus = false;
+            u.sort_params({}, opt);
+            BOOST_TEST_EQ(u.encoded_query(), "a%21=2&a+=1");
+            opt.space_as_plus = true;
+            u.sort_params({}, opt);
+            BOOST_TEST_EQ(u.encoded_query(), "a+=1&a%21=2");
+            BOOST_TEST_EQ(u.encoded_query().decoded_size(), 9u);
+        }
+        {
+            // custom comparison
+            url u("?b=2&c=3&a=1");
+            u.sort_params(
+                [](decode_view const& k0, decode_view const& k1)
+                {
+                    return k0.compare(k1) > 0;
+                });
+            BOOST_TEST_EQ(u.encoded_query(), "c=3&b=2&a=1");
+            BOOST_TEST_EQ(u.params().size(), 3u);
+            BOOST_TEST_EQ((*u.params().begin()).key, "c");
+        }
+        {
+            // static_url
+            static_url<64> u("/?z=1&y=2");
+            u.sort_params();
+            BOOST_TEST_EQ(u.buffer(), "/?y=2&z=1");
+        }
+
         // self-intersection
         modify(
             "#abracadabra",
@@ -1799,6 +1857,17 @@ struct url_base_test
 
         // remove_query
         assert( url( "http://www.example.com?id=42" ).remove_query().buffer() == "http://www.example.com" );
+        assert( url( "/?b=2&A=1&a=0" ).sort_params().encoded_query() == "A=1&a=0&b=2" );
+        assert( url( "/?b=2&A=1&a=0" ).sort_params( ignore_case ).encoded_query() == "A=1&a=0&b=2" );
+        {
+            url u( "/?b=2&c=3&a=1" );
+            u.sort_params(
+                []( decode_view const& k0, decode_view const& k1 )
+                {
+                    return k0.compare( k1 ) > 0;
+                });
+            assert( u.encoded_query() == "c=3&b=2&a=1" );
+        }
 
         //----------------------------------------
         //
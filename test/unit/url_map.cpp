@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_map.hpp>
+
+#include <boost/url/url.hpp>
+
+#include "test_suite.hpp"
+
+#include <memory>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+template class url_map<int>;
+
+struct url_map_test
+{
+    void
+    testMembers()
+    {
+        // url_map()
+        {
+            url_map<int> m;
+            BOOST_TEST(m.empty());
+            BOOST_TEST_EQ(m.size(), 0u);
+            BOOST_TEST(m.begin() == m.end());
+            BOOST_TEST(! m.contains("/"));
+        }
+
+        // try_emplace, insert
+        {
+            url_map<std::string> m;
+            auto r = m.try_emplace(url_view("http://a.com/x"), 3, 'x');
+            BOOST_TEST(r.second);
+            BOOST_TEST_EQ((*r.first).first.buffer(), "http://a.com/x");
+            BOOST_TEST_EQ((*r.first).second, "xxx");
+            r = m.try_emplace(url_view("http://A.com/%78"), 3, 'y');
+            BOOST_TEST(! r.second);
+            BOOST_TEST_EQ((*r.first).second, "xxx");
+            r = m.insert(url_view("http://a.com/y"), "y");
+            BOOST_TEST(r.second);
+            std::string v = "z";
+            r = m.insert(url_view("http://a.com/z"), v);
+            BOOST_TEST(r.second);
+            BOOST_TEST_EQ(m.size(), 3u);
+        }
+
+        // operator[]
+        {
+            url_map<int> m;
+            ++m[url_view("http://example.com/a")];
+            ++m[url("HTTP://example.com/%61")];
+            ++m[url_view("http://example.com/b/../a")];
+            ++m[url_view("http://example.com/b")];
+            BOOST_TEST_EQ(m.size(), 2u);
+            BOOST_TEST_EQ(m.at(url_view("http://example.com/a")), 3);
+            BOOST_TEST_EQ(m.at("http://example.com/b"), 1);
+        }
+
+        // at
+        {
+            url_map<int> m;
+            m.insert(url_view("/a"), 1);
+            url_map<int> const& cm = m;
+            BOOST_TEST_EQ(m.at("/./a"), 1);
+            BOOST_TEST_EQ(cm.at("/./a"), 1);
+            BOOST_TEST_EQ(cm.at(url_view("/%61")), 1);
+            m.at("/a") = 2;
+            BOOST_TEST_EQ(cm.at("/a"), 2);
+            BOOST_TEST_THROWS(m.at("/b"), system::system_error);
+            BOOST_TEST_THROWS(cm.at(url_view("/b")), system::system_error);
+            BOOST_TEST_THROWS(m.at("http:// x"), system::system_error);
+        }
+
+        // find, contains, count
+        {
+            url_map<int> m;
+            m.insert(url_view("http://a.com/x"), 1);
+            m.insert(url_view("http://a.com/y"), 2);
+            auto it = m.find("HTTP://a.com/%79");
+            BOOST_TEST(it != m.end());
+            BOOST_TEST_EQ((*it).second, 2);
+            (*it).second = 5;
+            url_map<int> const& cm = m;
+            auto cit = cm.find(url_view("http://a.com/y"));
+            BOOST_TEST_EQ((*cit).second, 5);
+            BOOST_TEST(cm.find("http://a.com/z") == cm.end());
+            BOOST_TEST(m.contains(url_view("http://a.com/./x")));
+            BOOST_TEST(! m.contains("http://a.com/X"));
+            BOOST_TEST_EQ(m.count("http://a.com/x"), 1u);
+            BOOST_TEST_EQ(m.count(url_view("http://b.com/x")), 0u);
+        }
+
+        // iterators
+        {
+            url_map<int> m;
+            for(int i = 0; i < 100; ++i)
+                m.insert(url_view(
+                    "/" + std::to_string(i)), i);
+            url_map<int>::const_iterator it = m.begin();
+            BOOST_TEST(it == static_cast<url_map<int> const&>(m).begin());
+            BOOST_TEST_EQ(m.end() - m.begin(), 100);
+            BOOST_TEST_EQ((*(it + 10)).second, 10);
+            BOOST_TEST_EQ(it[20].second, 20);
+            int n = 0;
+            for(auto e : m)
+            {
+                BOOST_TEST_EQ(e.first.buffer(), "/" + std::to_string(n));
+                BOOST_TEST_EQ(e.second, n);
+                e.second = -n;
+                ++n;
+            }
+            BOOST_TEST_EQ(m.at("/7"), -7);
+        }
+
+        // move-only mapped type
+        {
+            url_map<std::unique_ptr<int>> m;
+            m.try_emplace(url_view("/a"), new int(1));
+            m.insert(url_view("/b"), std::unique_ptr<int>(new int(2)));
+            BOOST_TEST_EQ(*m.at("/a"), 1);
+            BOOST_TEST_EQ(*m.at("/b"), 2);
+        }
+
+        // reserve, clear
+        {
+            url_map<int> m(42);
+            m.reserve(10, 100);
+            m[url_view("/a")] = 1;
+            m.clear();
+            BOOST_TEST(m.empty());
+            BOOST_TEST(! m.contains("/a"));
+            m[url_view("/a")] = 2;
+            BOOST_TEST_EQ(m.at("/a"), 2);
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_map
+        {
+        url_map< int > hits;
+        ++hits[ url_view( "http://example.com/a" ) ];
+        ++hits[ url_view( "HTTP://example.com/%61" ) ];
+
+        BOOST_TEST( hits.size() == 1 );
+        BOOST_TEST( hits.at( "http://EXAMPLE.com/./a" ) == 2 );
+        }
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_map_test,
+    "boost.url.url_map");
+
+} // urls
+} // boost
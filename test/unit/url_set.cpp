@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2019 Vinnie Falco (vinnie.falco@gmail.com)
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/boostorg/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/url_set.hpp>
+
+#include <boost/url/url.hpp>
+
+#include "test_suite.hpp"
+
+#include <string>
+
+namespace boost {
+namespace urls {
+
+struct url_set_test
+{
+    void
+    testMembers()
+    {
+        // url_set()
+        {
+            url_set s;
+            BOOST_TEST(s.empty());
+            BOOST_TEST_EQ(s.size(), 0u);
+            BOOST_TEST(s.begin() == s.end());
+            BOOST_TEST(! s.contains("http://example.com"));
+            BOOST_TEST(s.find(url_view("/")) == s.end());
+        }
+
+        // insert(url_view_base const&)
+        {
+            url_set s;
+            auto r = s.insert(url_view("http://example.com/a/b"));
+            BOOST_TEST(r.second);
+            BOOST_TEST(r.first == s.begin());
+            BOOST_TEST_EQ((*r.first).buffer(), "http://example.com/a/b");
+            r = s.insert(url("HTTP://Example.com/a/./%62"));
+            BOOST_TEST(! r.second);
+            BOOST_TEST(r.first == s.begin());
+            // the first key is kept
+            BOOST_TEST_EQ((*r.first).buffer(), "http://example.com/a/b");
+            r = s.insert(url_view("http://example.com/a/B"));
+            BOOST_TEST(r.second);
+            BOOST_TEST_EQ(s.size(), 2u);
+        }
+
+        // insert(core::string_view)
+        {
+            url_set s;
+            BOOST_TEST(s.insert("/x/../y").second);
+            BOOST_TEST(! s.insert("/y").second);
+            BOOST_TEST_THROWS(s.insert("http:// x"), system::system_error);
+            BOOST_TEST_EQ(s.size(), 1u);
+        }
+
+        // find, contains, count
+        {
+            url_set s;
+            s.insert("http://example.com:8080/%7Euser?q=1#f");
+            BOOST_TEST(s.contains("http://EXAMPLE.COM:8080/~user?q=%31#f"));
+            BOOST_TEST(s.contains(url_view("http://example.com:8080/a/../%7euser?q=1#f")));
+            BOOST_TEST(! s.contains("http://example.com/~user?q=1#f"));
+            BOOST_TEST(! s.contains("http://example.com:8080/~user?q=1"));
+            BOOST_TEST(! s.contains("http:// x"));
+            BOOST_TEST_EQ(s.count("http://example.com:8080/~user?q=1#f"), 1u);
+            BOOST_TEST_EQ(s.count("http://example.com:8080/~User?q=1#f"), 0u);
+            BOOST_TEST(s.find("http://example.com:8080/~user?q=1#f") == s.begin());
+            BOOST_TEST(s.find("http://example.com") == s.end());
+        }
+
+        // seed
+        {
+            url_set s0(0);
+            url_set s1(12345);
+            s0.insert("/a/b");
+            s1.insert("/a/b");
+            BOOST_TEST(s0.contains("/a/./b"));
+            BOOST_TEST(s1.contains("/a/./b"));
+        }
+
+        // reserve, clear
+        {
+            url_set s;
+            s.reserve(100, 2000);
+            s.insert("/a");
+            s.insert("/b");
+            BOOST_TEST_EQ(s.size(), 2u);
+            s.clear();
+            BOOST_TEST(s.empty());
+            BOOST_TEST(! s.contains("/a"));
+            BOOST_TEST(s.insert("/b").second);
+            BOOST_TEST(s.contains("/b"));
+        }
+
+        // many keys, insertion order
+        {
+            url_set s;
+            for(int i = 0; i < 1000; ++i)
+            {
+                std::string u = "http://example.com/p/" + std::to_string(i);
+                BOOST_TEST(s.insert(u).second);
+                BOOST_TEST(! s.insert(
+                    "http://example.com/p/./" + std::to_string(i)).second);
+            }
+            BOOST_TEST_EQ(s.size(), 1000u);
+            for(int i = 0; i < 1000; ++i)
+            {
+                std::string u = "HTTP://example.com/q/../p/" + std::to_string(i);
+                auto it = s.find(u);
+                BOOST_TEST(it != s.end());
+                BOOST_TEST_EQ(
+                    static_cast<int>(it - s.begin()), i);
+            }
+            std::size_t n = 0;
+            for(url_view u : s)
+            {
+                BOOST_TEST_EQ(
+                    u.buffer(),
+                    "http://example.com/p/" + std::to_string(n));
+                ++n;
+            }
+            BOOST_TEST_EQ(n, 1000u);
+        }
+    }
+
+    void
+    testJavadocs()
+    {
+        // url_set
+        {
+        url_set seen;
+        seen.insert( "http://example.com/a/b" );
+
+        BOOST_TEST( seen.contains( "HTTP://EXAMPLE.com/a/./%62" ) );
+        BOOST_TEST( ! seen.insert( url_view( "http://example.com/a/c/../b" ) ).second );
+        }
+    }
+
+    void
+    run()
+    {
+        testMembers();
+        testJavadocs();
+    }
+};
+
+TEST_SUITE(
+    url_set_test,
+    "boost.url.url_set");
+
+} // urls
+} // boost
@@ -11,7 +11,11 @@
 #include <boost/url/url_view_base.hpp>
 
 #include <boost/url/url_view.hpp>
+#include <boost/url/detail/wyhash.hpp>
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <functional>
+#include <string>
 
 #include "test_suite.hpp"
 
@@ -148,6 +152,100 @@ struct url_view_base_test
         BOOST_TEST(url_view().encoded_host_address().empty());
     }
 
+    // records the bytes passed to it
+    struct recorder
+    {
+        std::string s;
+        std::size_t calls = 0;
+
+        void
+        operator()(
+            void const* p,
+            std::size_t n) noexcept
+        {
+            s.append(
+                static_cast<char const*>(p), n);
+            ++calls;
+        }
+    };
+
+    void
+    testHash()
+    {
+        // hash_append
+        {
+            auto bytes = [](core::string_view s)
+            {
+                recorder r;
+                url_view(s).hash_append(r);
+                return r.s;
+            };
+            BOOST_TEST_EQ(
+                bytes("HTTP://Example.COM/%7euser/./a/../b?%61#%62"),
+                bytes("http://example.com/~user/b?a#b"));
+            BOOST_TEST_EQ(
+                bytes("http://example.com/a/."),
+                bytes("http://example.com/a/"));
+            BOOST_TEST_EQ(
+                bytes("http://example.com/."),
+                bytes("http://example.com/"));
+            BOOST_TEST_EQ(
+                bytes("/a/./b/%2E/c"),
+                bytes("/a/b/c"));
+            BOOST_TEST_NE(
+                bytes("http://example.com/a"),
+                bytes("http://example.com/A"));
+            BOOST_TEST_NE(
+                bytes("http://example.com?a"),
+                bytes("http://example.com#a"));
+
+            // long urls are passed in blocks
+            std::string s = "http://example.com/";
+            s.append(300, 'x');
+            recorder r;
+            url_view(s).hash_append(r);
+            BOOST_TEST_EQ(r.s.size(), s.size());
+            BOOST_TEST_GT(r.calls, 1u);
+            BOOST_TEST_LT(r.calls, s.size());
+        }
+
+        // std::hash
+        {
+            std::hash<url_view> h;
+            url_view u0("HTTP://Example.com:80/%61/b/../c");
+            url_view u1("http://example.com:80/a/c");
+            url_view u2("http://example.com:81/a/c");
+            BOOST_TEST_EQ(h(u0), h(u1));
+            BOOST_TEST_NE(h(u0), h(u2));
+            std::hash<url_view> h1(1);
+            BOOST_TEST_EQ(h1(u0), h1(u1));
+            BOOST_TEST_NE(h(u0), h1(u0));
+        }
+
+        // the digest does not depend
+        // on how the input is split
+        {
+            std::string s;
+            for(int i = 0; i < 100; ++i)
+                s.push_back(static_cast<char>('a' + i % 26));
+            detail::wyhash h0(7);
+            h0(s.data(), s.size());
+            for(std::size_t k = 1; k < 40; ++k)
+            {
+                detail::wyhash h1(7);
+                for(std::size_t i = 0; i < s.size(); i += k)
+                    h1(s.data() + i, (std::min)(k, s.size() - i));
+                BOOST_TEST_EQ(h0.digest(), h1.digest());
+            }
+            detail::wyhash h2(8);
+            h2(s.data(), s.size());
+            BOOST_TEST_NE(h0.digest(), h2.digest());
+            detail::wyhash h3(7);
+            h3(s.data(), s.size() - 1);
+            BOOST_TEST_NE(h0.digest(), h3.digest());
+        }
+    }
+
     void
     testJavadocs()
     {
@@ -461,6 +559,7 @@ struct url_view_base_test
     run()
     {
         testHost();
+        testHash();
         testJavadocs();
 
         test_suite::log <<